@@ -67,7 +67,7 @@ class AsyncInferQueue:
                     :return: If there is at least one free InferRequest in a pool, returns True.
                     :rtype: bool
         """
-    def set_callback(self, arg0: typing.Callable) -> None:
+    def set_callback(self, callback: typing.Callable, batched: bool = False) -> None:
         """
                     Sets unified callback on all InferRequests from queue's pool.
                     Signature of such function should have two arguments, where
@@ -82,8 +82,15 @@ class AsyncInferQueue:
         
                         async_infer_queue.set_callback(f)
         
+                    In the batched mode the callbacks of the requests completed at the same time
+                    are called one after another by a single thread under a single GIL acquisition,
+                    which reduces the GIL contention for the big number of short inferences.
+                    A request returns to the pool after its callback is called in both modes.
+        
                     :param callback: Any Python defined function that matches callback's requirements.
                     :type callback: function
+                    :param batched: Enables the batched delivery of the callbacks. Default: False
+                    :type batched: bool
         """
     @typing.overload
     def start_async(self, inputs: Tensor, userdata: typing.Any) -> None:
@@ -6,8 +6,11 @@
 #include <pybind11/functional.h>
 #include <pybind11/stl.h>
 
+#include <atomic>
+#include <cassert>
 #include <chrono>
 #include <condition_variable>
+#include <memory>
 #include <mutex>
 #include <queue>
 #include <string>
@@ -19,12 +22,91 @@
 
 namespace py = pybind11;
 
-class AsyncInferQueue {
+namespace {
+/**
+ * @brief Bounded lock-free queue of the idle request handles.
+ *
+ * The queue is filled by the callbacks of the requests and consumed by the Python threads starting the requests.
+ * Every handle is put to the queue at most once, so the queue of size of the pool never overflows.
+ */
+class IdleHandles {
 public:
-    AsyncInferQueue(ov::CompiledModel& model, size_t jobs) {
-        if (jobs == 0) {
-            jobs = static_cast<size_t>(Common::get_optimal_number_of_requests(model));
+    explicit IdleHandles(size_t capacity) : m_capacity(capacity), m_cells(new Cell[capacity]) {
+        for (size_t i = 0; i < m_capacity; i++) {
+            m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    void push(size_t handle) {
+        auto pos = m_tail.load(std::memory_order_relaxed);
+        while (true) {
+            auto& cell = m_cells[pos % m_capacity];
+            const auto sequence = cell.sequence.load(std::memory_order_acquire);
+            if (sequence == pos && m_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                cell.handle = handle;
+                cell.sequence.store(pos + 1, std::memory_order_release);
+                return;
+            } else if (sequence != pos) {
+                pos = m_tail.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool front(size_t& handle) const {
+        const auto pos = m_head.load(std::memory_order_relaxed);
+        const auto& cell = m_cells[pos % m_capacity];
+        if (cell.sequence.load(std::memory_order_acquire) != pos + 1) {
+            return false;
+        }
+        handle = cell.handle;
+        return true;
+    }
+
+    bool pop(size_t& handle) {
+        auto pos = m_head.load(std::memory_order_relaxed);
+        while (true) {
+            auto& cell = m_cells[pos % m_capacity];
+            const auto sequence = cell.sequence.load(std::memory_order_acquire);
+            if (sequence != pos + 1) {
+                if (sequence < pos + 1) {
+                    return false;  // empty
+                }
+                pos = m_head.load(std::memory_order_relaxed);
+            } else if (m_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                handle = cell.handle;
+                cell.sequence.store(pos + m_capacity, std::memory_order_release);
+                return true;
+            }
         }
+    }
+
+    bool empty() const {
+        size_t handle;
+        return !front(handle);
+    }
+
+    size_t capacity() const {
+        return m_capacity;
+    }
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        size_t handle;
+    };
+
+    const size_t m_capacity;
+    std::unique_ptr<Cell[]> m_cells;
+    std::atomic<size_t> m_head{0};
+    std::atomic<size_t> m_tail{0};
+};
+}  // namespace
+
+class AsyncInferQueue {
+public:
+    AsyncInferQueue(ov::CompiledModel& model, size_t jobs)
+        : m_idle_handles(jobs == 0 ? static_cast<size_t>(Common::get_optimal_number_of_requests(model)) : jobs) {
+        jobs = m_idle_handles.capacity();
 
         m_requests.reserve(jobs);
         m_user_ids.reserve(jobs);
@@ -47,28 +129,21 @@ public:
     bool _is_ready() {
         // Check if any request has finished already
         ConditionalGILScopedRelease release;
-        // acquire the mutex to access m_errors and m_idle_handles
-        std::lock_guard<std::mutex> lock(m_mutex);
-        if (m_errors.size() > 0)
-            throw m_errors.front();
-        return !(m_idle_handles.empty());
+        check_errors();
+        return !m_idle_handles.empty();
     }
 
     size_t get_idle_request_id() {
         // Wait for any request to complete and return its id
         // release GIL to avoid deadlock on python callback
         ConditionalGILScopedRelease release;
-        // acquire the mutex to access m_errors and m_idle_handles
-        std::unique_lock<std::mutex> lock(m_mutex);
-        m_cv.wait(lock, [this] {
-            return !(m_idle_handles.empty());
-        });
-        size_t idle_handle = m_idle_handles.front();
-        // wait for request to make sure it returned from callback
-        m_requests[idle_handle].m_request->wait();
-        if (m_errors.size() > 0)
-            throw m_errors.front();
-        return idle_handle;
+        return wait_idle_request(false);
+    }
+
+    size_t pop_idle_request_id() {
+        // The same as get_idle_request_id(), but the handle is taken from the queue of idle handles
+        ConditionalGILScopedRelease release;
+        return wait_idle_request(true);
     }
 
     void wait_all() {
@@ -78,10 +153,14 @@ public:
         for (auto&& request : m_requests) {
             request.m_request->wait();
         }
-        // acquire the mutex to access m_errors
-        std::lock_guard<std::mutex> lock(m_mutex);
-        if (m_errors.size() > 0)
-            throw m_errors.front();
+        {
+            // the batched callbacks may be still delivered by another thread
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cv.wait(lock, [this] {
+                return m_undelivered.load() == 0;
+            });
+        }
+        check_errors();
     }
 
     void set_default_callbacks() {
@@ -90,14 +169,7 @@ public:
 
             m_requests[handle].m_request->set_callback([this, handle /* ... */](std::exception_ptr exception_ptr) {
                 *m_requests[handle].m_end_time = Time::now();
-                {
-                    // acquire the mutex to access m_idle_handles
-                    std::lock_guard<std::mutex> lock(m_mutex);
-                    // Add idle handle to queue
-                    m_idle_handles.push(handle);
-                }
-                // Notify locks in getIdleRequestId()
-                m_cv.notify_one();
+                release_handle(handle);
 
                 try {
                     if (exception_ptr) {
@@ -110,58 +182,164 @@ public:
         }
     }
 
-    void set_custom_callbacks(py::function f_callback) {
+    void set_custom_callbacks(py::function f_callback, bool batched) {
         // need to acquire GIL before py::function deletion
         auto callback_sp = Common::utils::wrap_pyfunction(std::move(f_callback));
 
         for (size_t handle = 0; handle < m_requests.size(); handle++) {
-            m_requests[handle].m_request->set_callback([this, callback_sp, handle](std::exception_ptr exception_ptr) {
-                *m_requests[handle].m_end_time = Time::now();
-                if (exception_ptr == nullptr) {
-                    // Acquire GIL, execute Python function
-                    ConditionalGILScopedAcquire acquire;
-                    try {
-                        (*callback_sp)(m_requests[handle], m_user_ids[handle]);
-                    } catch (const py::error_already_set& py_error) {
-                        // This should behave the same as assert(!PyErr_Occurred())
-                        // since constructor for pybind11's error_already_set is
-                        // performing PyErr_Fetch which clears error indicator and
-                        // saves it inside itself.
-                        assert(py_error.type());
-                        // acquire the mutex to access m_errors
-                        std::lock_guard<std::mutex> lock(m_mutex);
-                        m_errors.push(py_error);
+            m_requests[handle].m_request->set_callback(
+                [this, callback_sp, handle, batched](std::exception_ptr exception_ptr) {
+                    *m_requests[handle].m_end_time = Time::now();
+                    if (exception_ptr == nullptr && batched) {
+                        deliver_batched(callback_sp, handle);
+                        return;
+                    }
+                    if (exception_ptr == nullptr) {
+                        // Acquire GIL, execute Python function
+                        ConditionalGILScopedAcquire acquire;
+                        call_callback(*callback_sp, handle);
                     }
-                }
 
-                {
-                    // acquire the mutex to access m_idle_handles
-                    std::lock_guard<std::mutex> lock(m_mutex);
-                    // Add idle handle to queue
-                    m_idle_handles.push(handle);
-                }
-                // Notify locks in getIdleRequestId()
-                m_cv.notify_one();
+                    release_handle(handle);
 
-                try {
-                    if (exception_ptr) {
-                        std::rethrow_exception(exception_ptr);
+                    try {
+                        if (exception_ptr) {
+                            std::rethrow_exception(exception_ptr);
+                        }
+                    } catch (const std::exception& e) {
+                        OPENVINO_THROW(e.what());
                     }
-                } catch (const std::exception& e) {
-                    OPENVINO_THROW(e.what());
-                }
-            });
+                });
         }
     }
 
     // AsyncInferQueue is the owner of all requests. When AsyncInferQueue is destroyed,
     // all of requests are destroyed as well.
     std::vector<InferRequestWrapper> m_requests;
-    std::queue<size_t> m_idle_handles;
+    IdleHandles m_idle_handles;
     std::vector<py::object> m_user_ids;  // user ID can be any Python object
     std::mutex m_mutex;
     std::condition_variable m_cv;
     std::queue<py::error_already_set> m_errors;
+    std::atomic<bool> m_has_errors{false};
+    std::atomic<size_t> m_waiters{0};
+
+    // completed requests waiting for the batched callback
+    std::mutex m_completed_mutex;
+    std::vector<size_t> m_completed;
+    bool m_delivering = false;
+    std::atomic<size_t> m_undelivered{0};
+
+private:
+    size_t wait_idle_request(bool pop) {
+        size_t handle;
+        auto ready = [&] {
+            return pop ? m_idle_handles.pop(handle) : m_idle_handles.front(handle);
+        };
+        if (!ready()) {
+            // slow path, the mutex is taken only to sleep until the callbacks return a handle
+            m_waiters.fetch_add(1);
+            // pairs with the fence in release_handle(): either the releaser sees the waiter or the waiter sees the
+            // returned handle
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_cv.wait(lock, ready);
+            }
+            m_waiters.fetch_sub(1);
+        }
+        // wait for request to make sure it returned from callback
+        m_requests[handle].m_request->wait();
+        try {
+            check_errors();
+        } catch (...) {
+            if (pop) {
+                release_handle(handle);
+            }
+            throw;
+        }
+        return handle;
+    }
+
+    void check_errors() {
+        if (m_has_errors.load()) {
+            // acquire the mutex to access m_errors
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_errors.size() > 0)
+                throw m_errors.front();
+        }
+    }
+
+    void release_handle(size_t handle) {
+        // Add idle handle to queue
+        m_idle_handles.push(handle);
+        // the store of the handle must not be reordered with the load of the waiters
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        // Notify locks in getIdleRequestId() if there are threads sleeping there
+        if (m_waiters.load() > 0) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_cv.notify_all();
+        }
+    }
+
+    void call_callback(const py::function& callback, size_t handle) {
+        // GIL must be held by the caller
+        try {
+            callback(m_requests[handle], m_user_ids[handle]);
+        } catch (const py::error_already_set& py_error) {
+            // This should behave the same as assert(!PyErr_Occurred())
+            // since constructor for pybind11's error_already_set is
+            // performing PyErr_Fetch which clears error indicator and
+            // saves it inside itself.
+            assert(py_error.type());
+            // acquire the mutex to access m_errors
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_errors.push(py_error);
+            m_has_errors.store(true);
+        }
+    }
+
+    void deliver_batched(const std::shared_ptr<py::function>& callback, size_t handle) {
+        m_undelivered.fetch_add(1);
+        {
+            std::lock_guard<std::mutex> lock(m_completed_mutex);
+            m_completed.push_back(handle);
+            if (m_delivering) {
+                // the thread which is delivering the callbacks now takes this request as well
+                return;
+            }
+            m_delivering = true;
+        }
+
+        // The callbacks of all the requests completed meanwhile are called under the single GIL acquisition
+        std::vector<size_t> batch;
+        ConditionalGILScopedAcquire acquire;
+        while (true) {
+            {
+                std::lock_guard<std::mutex> lock(m_completed_mutex);
+                if (m_completed.empty()) {
+                    m_delivering = false;
+                    break;
+                }
+                batch.swap(m_completed);
+            }
+            for (auto completed : batch) {
+                call_callback(*callback, completed);
+            }
+            for (auto completed : batch) {
+                // the request delivering the callbacks is busy until the delivery is over
+                if (completed != handle) {
+                    release_handle(completed);
+                }
+            }
+            if (m_undelivered.fetch_sub(batch.size()) == batch.size()) {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_cv.notify_all();
+            }
+            batch.clear();
+        }
+        release_handle(handle);
+    }
 };
 
 void regclass_AsyncInferQueue(py::module m) {
@@ -189,11 +367,7 @@ void regclass_AsyncInferQueue(py::module m) {
         [](AsyncInferQueue& self, const ov::Tensor& inputs, py::object userdata) {
             // getIdleRequestId function has an intention to block InferQueue
             // until there is at least one idle (free to use) InferRequest
-            auto handle = self.get_idle_request_id();
-            {
-                std::lock_guard<std::mutex> lock(self.m_mutex);
-                self.m_idle_handles.pop();
-            }
+            auto handle = self.pop_idle_request_id();
             // Set new inputs label/id from user
             self.m_user_ids[handle] = userdata;
             // Update inputs if there are any
@@ -235,11 +409,7 @@ void regclass_AsyncInferQueue(py::module m) {
         [](AsyncInferQueue& self, const py::dict& inputs, py::object userdata) {
             // getIdleRequestId function has an intention to block InferQueue
             // until there is at least one idle (free to use) InferRequest
-            auto handle = self.get_idle_request_id();
-            {
-                std::lock_guard<std::mutex> lock(self.m_mutex);
-                self.m_idle_handles.pop();
-            }
+            auto handle = self.pop_idle_request_id();
             // Set new inputs label/id from user
             self.m_user_ids[handle] = userdata;
             // Update inputs if there are any
@@ -303,6 +473,8 @@ void regclass_AsyncInferQueue(py::module m) {
 
     cls.def("set_callback",
             &AsyncInferQueue::set_custom_callbacks,
+            py::arg("callback"),
+            py::arg("batched") = false,
             R"(
             Sets unified callback on all InferRequests from queue's pool.
             Signature of such function should have two arguments, where
@@ -317,8 +489,15 @@ void regclass_AsyncInferQueue(py::module m) {
 
                 async_infer_queue.set_callback(f)
 
+            In the batched mode the callbacks of the requests completed at the same time
+            are called one after another by a single thread under a single GIL acquisition,
+            which reduces the GIL contention for the big number of short inferences.
+            A request returns to the pool after its callback is called in both modes.
+
             :param callback: Any Python defined function that matches callback's requirements.
             :type callback: function
+            :param batched: Enables the batched delivery of the callbacks. Default: False
+            :type batched: bool
         )");
 
     cls.def(
@@ -57,6 +57,52 @@ def test_infer_queue(device, share_inputs):
     assert all(job["latency"] > 0 for job in jobs_done)
 
 
+@pytest.mark.parametrize("share_inputs", [True, False])
+def test_infer_queue_batched_callback(device, share_inputs):
+    jobs = 64
+    num_request = 4
+    core = Core()
+    param = ops.parameter([10])
+    model = Model(ops.relu(param), [param])
+    compiled_model = core.compile_model(model, device)
+    infer_queue = AsyncInferQueue(compiled_model, num_request)
+    jobs_done = [0 for _ in range(jobs)]
+
+    def callback(request, job_id):
+        jobs_done[job_id] += 1
+        assert np.array_equal(request.get_output_tensor().data, np.maximum(inputs[job_id], 0))
+
+    inputs = [np.arange(-5, 5, dtype=np.float32) * (i + 1) for i in range(jobs)]
+    infer_queue.set_callback(callback, batched=True)
+    for i in range(jobs):
+        infer_queue.start_async({0: inputs[i]}, i, share_inputs=share_inputs)
+    infer_queue.wait_all()
+    assert jobs_done == [1] * jobs
+    assert infer_queue.is_ready()
+
+
+def test_infer_queue_batched_callback_fail(device):
+    jobs = 8
+    num_request = 4
+    core = Core()
+    model = get_relu_model()
+    compiled_model = core.compile_model(model, device)
+    infer_queue = AsyncInferQueue(compiled_model, num_request)
+
+    def callback(request, _):
+        request = request + 21
+
+    img = generate_image()
+    infer_queue.set_callback(callback, batched=True)
+
+    with pytest.raises(TypeError) as e:
+        for _ in range(jobs):
+            infer_queue.start_async({"data": img})
+        infer_queue.wait_all()
+
+    assert "unsupported operand type(s) for +" in str(e.value)
+
+
 def test_infer_queue_iteration(device):
     core = Core()
     param = ops.parameter([10])
@@ -0,0 +1,48 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/op/op.hpp"
+#include "transformations_visibility.hpp"
+
+namespace ov {
+namespace op {
+namespace internal {
+/**
+ * @interface GatheredLora
+ * @brief Low-Rank adaptation, where every batch row uses its own adapter from the stacked tables of adapters.
+ * It has the following inputs, whose order is fixed:
+ * 1. main_flow_input: [batch, S, N] input from original model.
+ * 2. LoRA_input: [batch, S, K] input to which the Low-Rank adaptation is applied.
+ * 3. A: [adapters, rank, K] stacked down-projection matrices.
+ * 4. alpha: [adapters, 1, rank] stacked scales.
+ * 5. B: [adapters, N, rank] stacked up-projection matrices.
+ * 6. indices: [batch] or [1] index of the adapter of every batch row (a single one is used for the whole batch),
+ *    negative values are counted from the end.
+ * The output is main_flow_input + ((LoRA_input x A[i]^T) * alpha[i]) x B[i]^T for every batch row,
+ * where i = indices[row]. The rows with out of range indices are not adapted.
+ */
+class TRANSFORMATIONS_API GatheredLora : public ov::op::Op {
+public:
+    OPENVINO_OP("GatheredLora", "ie_internal_opset");
+
+    GatheredLora() = default;
+    GatheredLora(const Output<Node>& main_flow,
+                 const Output<Node>& lora_input,
+                 const Output<Node>& a,
+                 const Output<Node>& alpha,
+                 const Output<Node>& b,
+                 const Output<Node>& indices);
+
+    bool visit_attributes(ov::AttributeVisitor& visitor) override;
+
+    void validate_and_infer_types() override;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+};
+
+}  // namespace internal
+}  // namespace op
+}  // namespace ov
@@ -0,0 +1,37 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/matcher_pass.hpp"
+#include "transformations_visibility.hpp"
+
+namespace ov {
+namespace pass {
+
+class TRANSFORMATIONS_API GatheredLoraFusion;
+
+}  // namespace pass
+}  // namespace ov
+
+/**
+ * @ingroup ov_transformation_common_api
+ * @brief Fuses the Low-Rank adaptation with an adapter per batch row, expressed by Gather of the stacked tables of
+ * adapters by the indices of the rows, into GatheredLora operation:
+ *
+ *      LoRA_input  Gather(A, indices)
+ *               \  /
+ *              MatMul  Gather(alpha, indices)
+ *                  \   /
+ *                 Multiply  Gather(B, indices)
+ *                       \   /
+ *      main_flow_input  MatMul
+ *                   \   /
+ *                    Add
+ */
+class ov::pass::GatheredLoraFusion : public ov::pass::MatcherPass {
+public:
+    OPENVINO_MATCHER_PASS_RTTI("GatheredLoraFusion");
+    GatheredLoraFusion();
+};
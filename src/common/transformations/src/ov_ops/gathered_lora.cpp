@@ -0,0 +1,71 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ov_ops/gathered_lora.hpp"
+
+#include "itt.hpp"
+
+namespace ov {
+namespace op {
+namespace internal {
+
+GatheredLora::GatheredLora(const Output<Node>& main_flow,
+                           const Output<Node>& lora_input,
+                           const Output<Node>& a,
+                           const Output<Node>& alpha,
+                           const Output<Node>& b,
+                           const Output<Node>& indices)
+    : Op({main_flow, lora_input, a, alpha, b, indices}) {
+    validate_and_infer_types();
+}
+
+bool GatheredLora::visit_attributes(ov::AttributeVisitor&) {
+    return true;
+}
+
+void GatheredLora::validate_and_infer_types() {
+    INTERNAL_OP_SCOPE(internal_GatheredLora_validate_and_infer_types);
+    NODE_VALIDATION_CHECK(this,
+                          get_input_size() == 6,
+                          "GatheredLora must have 6 inputs whereas it has ",
+                          get_input_size());
+    NODE_VALIDATION_CHECK(this,
+                          get_input_element_type(5).is_integral_number(),
+                          "Indices of adapters must be integer, got ",
+                          get_input_element_type(5));
+    const auto& main_flow_shape = get_input_partial_shape(0);
+    const auto& lora_input_shape = get_input_partial_shape(1);
+    NODE_VALIDATION_CHECK(this,
+                          main_flow_shape.rank().compatible(3) && lora_input_shape.rank().compatible(3),
+                          "Main flow and LoRA input must be 3D, got ",
+                          main_flow_shape,
+                          " and ",
+                          lora_input_shape);
+    for (size_t i = 2; i < 5; ++i) {
+        NODE_VALIDATION_CHECK(this,
+                              get_input_partial_shape(i).rank().compatible(3),
+                              "Tables of adapters must be 3D, got ",
+                              get_input_partial_shape(i));
+    }
+    NODE_VALIDATION_CHECK(this,
+                          get_input_partial_shape(5).rank().compatible(1),
+                          "Indices of adapters must be 1D, got ",
+                          get_input_partial_shape(5));
+    set_output_type(0, get_input_element_type(0), main_flow_shape);
+}
+
+std::shared_ptr<Node> GatheredLora::clone_with_new_inputs(const ov::OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(internal_GatheredLora_clone_with_new_inputs);
+    check_new_args_count(this, new_args);
+    return std::make_shared<GatheredLora>(new_args.at(0),
+                                          new_args.at(1),
+                                          new_args.at(2),
+                                          new_args.at(3),
+                                          new_args.at(4),
+                                          new_args.at(5));
+}
+
+}  // namespace internal
+}  // namespace op
+}  // namespace ov
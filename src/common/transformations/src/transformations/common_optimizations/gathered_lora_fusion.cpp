@@ -0,0 +1,96 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformations/common_optimizations/gathered_lora_fusion.hpp"
+
+#include <memory>
+
+#include "itt.hpp"
+#include "openvino/core/rt_info.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/util/gather_base.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+#include "ov_ops/gathered_lora.hpp"
+
+ov::pass::GatheredLoraFusion::GatheredLoraFusion() {
+    MATCHER_SCOPE(GatheredLoraFusion);
+    using namespace pass::pattern;
+    auto indices_m = any_input(rank_equals(1));
+    auto make_gather = [&indices_m]() {
+        auto axis_m = wrap_type<ov::op::v0::Constant>(value_matches("0"));
+        return wrap_type<ov::op::util::GatherBase>({any_input(rank_equals(3)), indices_m, axis_m}, consumers_count(1));
+    };
+
+    auto lora_input_m = any_input(rank_equals(3));
+    auto gather_a_m = make_gather();
+    auto matmul1_m = wrap_type<ov::op::v0::MatMul>({lora_input_m, gather_a_m}, consumers_count(1));
+    auto gather_alpha_m = make_gather();
+    auto multiply_m = wrap_type<ov::op::v1::Multiply>({matmul1_m, gather_alpha_m}, consumers_count(1));
+    auto gather_b_m = make_gather();
+    auto matmul2_m = wrap_type<ov::op::v0::MatMul>({multiply_m, gather_b_m}, consumers_count(1));
+    auto main_flow_m = any_input(rank_equals(3));
+    auto add_m = wrap_type<ov::op::v1::Add>({main_flow_m, matmul2_m});
+
+    ov::matcher_pass_callback callback = [OV_CAPTURE_CPY_AND_THIS](Matcher& m) {
+        const auto& pattern_map = m.get_pattern_value_map();
+        const auto add = pattern_map.at(add_m).get_node_shared_ptr();
+        if (transformation_callback(add)) {
+            return false;
+        }
+
+        // the adapters are applied as x * A^T and x * B^T, as they are stored by the training frameworks
+        for (const auto& matmul_m : {matmul1_m, matmul2_m}) {
+            const auto matmul = ov::as_type_ptr<ov::op::v0::MatMul>(pattern_map.at(matmul_m).get_node_shared_ptr());
+            if (!matmul || matmul->get_transpose_a() || !matmul->get_transpose_b()) {
+                return false;
+            }
+        }
+        for (const auto& gather_m : {gather_a_m, gather_alpha_m, gather_b_m}) {
+            const auto gather =
+                ov::as_type_ptr<ov::op::util::GatherBase>(pattern_map.at(gather_m).get_node_shared_ptr());
+            if (!gather || gather->get_batch_dims() != 0) {
+                return false;
+            }
+        }
+
+        const auto& indices = pattern_map.at(indices_m);
+        const auto& a = pattern_map.at(gather_a_m).get_node()->input_value(0);
+        const auto& alpha = pattern_map.at(gather_alpha_m).get_node()->input_value(0);
+        // alpha holds a factor per adapter rank, broadcasted along the rows of a batch only
+        const auto& alpha_shape = alpha.get_partial_shape();
+        if (!indices.get_element_type().is_integral_number() || alpha_shape[1] != 1 || alpha_shape[2].is_dynamic() ||
+            alpha_shape[2] != a.get_partial_shape()[1]) {
+            return false;
+        }
+        // the fused op does not broadcast the LoRA input and the LoRA output, their rows match the main flow ones,
+        // there is an index per batch and B holds the main flow channels
+        const auto& main_flow = pattern_map.at(main_flow_m);
+        const auto& main_flow_shape = main_flow.get_partial_shape();
+        const auto& lora_input = pattern_map.at(lora_input_m);
+        const auto& lora_input_shape = lora_input.get_partial_shape();
+        const auto& b = pattern_map.at(gather_b_m).get_node()->input_value(0);
+        if (add->get_output_partial_shape(0) != main_flow_shape || lora_input_shape[0] != main_flow_shape[0] ||
+            lora_input_shape[1] != main_flow_shape[1] || indices.get_partial_shape()[0] != lora_input_shape[0] ||
+            b.get_partial_shape()[1] != main_flow_shape[2] ||
+            lora_input.get_element_type() != main_flow.get_element_type()) {
+            return false;
+        }
+
+        const auto lora =
+            std::make_shared<ov::op::internal::GatheredLora>(main_flow, lora_input, a, alpha, b, indices);
+        if (lora->get_output_element_type(0) != add->get_output_element_type(0)) {
+            return false;
+        }
+        lora->set_friendly_name(add->get_friendly_name());
+        ov::copy_runtime_info(m.get_matched_nodes(), lora);
+        ov::replace_node(add, lora);
+        return true;
+    };
+
+    auto m = std::make_shared<Matcher>(add_m, matcher_name);
+    this->register_matcher(m, callback);
+}
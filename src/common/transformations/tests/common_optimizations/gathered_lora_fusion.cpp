@@ -0,0 +1,148 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformations/common_optimizations/gathered_lora_fusion.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "common_test_utils/ov_test_utils.hpp"
+#include "openvino/core/model.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/gather.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/parameter.hpp"
+#include "ov_ops/gathered_lora.hpp"
+
+using namespace testing;
+using namespace ov;
+
+namespace {
+
+constexpr size_t adapters = 4;
+constexpr size_t rank = 8;
+constexpr size_t K = 64;
+constexpr size_t N = 32;
+
+struct GatheredLoraInputs {
+    std::shared_ptr<ov::op::v0::Parameter> x;
+    std::shared_ptr<ov::op::v0::Parameter> indices;
+    std::shared_ptr<ov::op::v0::Parameter> a;
+    std::shared_ptr<ov::op::v0::Parameter> alpha;
+    std::shared_ptr<ov::op::v0::Parameter> b;
+    std::shared_ptr<ov::op::v0::Parameter> w;
+
+    GatheredLoraInputs() {
+        x = std::make_shared<ov::op::v0::Parameter>(element::f32, PartialShape{-1, -1, K});
+        indices = std::make_shared<ov::op::v0::Parameter>(element::i32, PartialShape{-1});
+        a = std::make_shared<ov::op::v0::Parameter>(element::f32, PartialShape{adapters, rank, K});
+        alpha = std::make_shared<ov::op::v0::Parameter>(element::f32, PartialShape{adapters, 1, rank});
+        b = std::make_shared<ov::op::v0::Parameter>(element::f32, PartialShape{adapters, N, rank});
+        w = std::make_shared<ov::op::v0::Parameter>(element::f32, PartialShape{N, K});
+    }
+
+    ParameterVector parameters() const {
+        return {x, indices, a, alpha, b, w};
+    }
+};
+
+std::shared_ptr<Node> make_gathered_lora(const GatheredLoraInputs& inputs,
+                                         const Output<Node>& main_flow,
+                                         bool transpose_b = true) {
+    auto gather = [&](const Output<Node>& table) {
+        return std::make_shared<ov::op::v8::Gather>(table,
+                                                    inputs.indices,
+                                                    ov::op::v0::Constant::create(element::i32, Shape{}, {0}));
+    };
+    auto mm1 = std::make_shared<ov::op::v0::MatMul>(inputs.x, gather(inputs.a), false, true);
+    auto mul = std::make_shared<ov::op::v1::Multiply>(gather(inputs.alpha), mm1);
+    auto mm2 = std::make_shared<ov::op::v0::MatMul>(mul, gather(inputs.b), false, transpose_b);
+    return std::make_shared<ov::op::v1::Add>(main_flow, mm2);
+}
+
+}  // namespace
+
+class GatheredLoraFusionTests : public TransformationTestsF {
+public:
+    GatheredLoraFusionTests() : TransformationTestsF() {
+        comparator.enable(FunctionsComparator::CmpValues::ATTRIBUTES);
+        comparator.enable(FunctionsComparator::CmpValues::NAMES);
+    }
+
+    void SetUp() override {
+        TransformationTestsF::SetUp();
+        manager.register_pass<ov::pass::GatheredLoraFusion>();
+    }
+};
+
+TEST_F(GatheredLoraFusionTests, StandardPattern) {
+    {
+        GatheredLoraInputs inputs;
+        auto main_mm = std::make_shared<ov::op::v0::MatMul>(inputs.x, inputs.w, false, true);
+        main_mm->set_friendly_name("main_mm");
+        auto lora = make_gathered_lora(inputs, main_mm);
+        lora->set_friendly_name("lora");
+        model = std::make_shared<Model>(OutputVector{lora}, inputs.parameters());
+    }
+    {
+        GatheredLoraInputs inputs;
+        auto main_mm = std::make_shared<ov::op::v0::MatMul>(inputs.x, inputs.w, false, true);
+        main_mm->set_friendly_name("main_mm");
+        auto lora = std::make_shared<ov::op::internal::GatheredLora>(main_mm,
+                                                                     inputs.x,
+                                                                     inputs.a,
+                                                                     inputs.alpha,
+                                                                     inputs.b,
+                                                                     inputs.indices);
+        lora->set_friendly_name("lora");
+        model_ref = std::make_shared<Model>(OutputVector{lora}, inputs.parameters());
+    }
+}
+
+TEST_F(GatheredLoraFusionTests, NotTransposedAdapterIsNotFused) {
+    GatheredLoraInputs inputs;
+    inputs.b = std::make_shared<ov::op::v0::Parameter>(element::f32, PartialShape{adapters, rank, N});
+    auto main_mm = std::make_shared<ov::op::v0::MatMul>(inputs.x, inputs.w, false, true);
+    auto lora = make_gathered_lora(inputs, main_mm, false);
+    model = std::make_shared<Model>(OutputVector{lora}, inputs.parameters());
+}
+
+TEST_F(GatheredLoraFusionTests, ScalarAlphaIsNotFused) {
+    GatheredLoraInputs inputs;
+    inputs.alpha = std::make_shared<ov::op::v0::Parameter>(element::f32, PartialShape{adapters, 1, 1});
+    auto main_mm = std::make_shared<ov::op::v0::MatMul>(inputs.x, inputs.w, false, true);
+    auto lora = make_gathered_lora(inputs, main_mm);
+    model = std::make_shared<Model>(OutputVector{lora}, inputs.parameters());
+}
+
+TEST_F(GatheredLoraFusionTests, BroadcastedLoraInputIsNotFused) {
+    GatheredLoraInputs inputs;
+    auto main_x = std::make_shared<ov::op::v0::Parameter>(element::f32, PartialShape{-1, -1, K});
+    inputs.x = std::make_shared<ov::op::v0::Parameter>(element::f32, PartialShape{1, -1, K});
+    auto main_mm = std::make_shared<ov::op::v0::MatMul>(main_x, inputs.w, false, true);
+    auto lora = make_gathered_lora(inputs, main_mm);
+    auto parameters = inputs.parameters();
+    parameters.push_back(main_x);
+    model = std::make_shared<Model>(OutputVector{lora}, parameters);
+}
+
+TEST_F(GatheredLoraFusionTests, SingleIndexForBatchIsNotFused) {
+    GatheredLoraInputs inputs;
+    inputs.x = std::make_shared<ov::op::v0::Parameter>(element::f32, PartialShape{2, -1, K});
+    inputs.indices = std::make_shared<ov::op::v0::Parameter>(element::i32, PartialShape{1});
+    auto main_mm = std::make_shared<ov::op::v0::MatMul>(inputs.x, inputs.w, false, true);
+    auto lora = make_gathered_lora(inputs, main_mm);
+    model = std::make_shared<Model>(OutputVector{lora}, inputs.parameters());
+}
+
+TEST_F(GatheredLoraFusionTests, BroadcastedLoraOutputIsNotFused) {
+    GatheredLoraInputs inputs;
+    inputs.b = std::make_shared<ov::op::v0::Parameter>(element::f32, PartialShape{adapters, 1, rank});
+    auto main_mm = std::make_shared<ov::op::v0::MatMul>(inputs.x, inputs.w, false, true);
+    auto lora = make_gathered_lora(inputs, main_mm);
+    model = std::make_shared<Model>(OutputVector{lora}, inputs.parameters());
+}
@@ -12,6 +12,7 @@
 #include "openvino/op/util/attr_types.hpp"
 #include "openvino/reference/utils/coordinate_index.hpp"
 #include "openvino/reference/utils/coordinate_transform.hpp"
+#include "openvino/reference/utils/parallel_util.hpp"
 
 namespace ov {
 namespace reference {
@@ -71,6 +72,86 @@ inline size_t calculate_fixed_axis(size_t axis, const size_t* strides) {
         --axis;
     return axis;
 }
+
+/**
+ * @brief Apply elementwise function for 2 inputs with NUMPY broadcasting, splitting the output between threads.
+ *
+ * The trailing axes of the same size in both inputs are merged into the contiguous rows, if there are none, the rows
+ * are formed by the last axis broadcasted in one of the inputs. The output is split into the ranges of elements, every
+ * range computes its inputs offsets from the coordinate of its first row, so the ranges may be processed in any order.
+ */
+template <typename T, typename U, typename Functor>
+void numpy_broadcast_binop_rows(const T* arg0,
+                                const T* arg1,
+                                U* out,
+                                const Shape& arg0_shape,
+                                const Shape& arg1_shape,
+                                const Functor& elementwise_functor) {
+    const size_t rank = std::max(arg0_shape.size(), arg1_shape.size());
+    const size_t padding0 = rank - arg0_shape.size();
+    const size_t padding1 = rank - arg1_shape.size();
+
+    // strides of the inputs in the output coordinates, the broadcasted axes do not move the input
+    Shape output_shape(rank);
+    std::vector<size_t> strides0(rank), strides1(rank);
+    for (size_t i = rank, s0 = 1, s1 = 1; i-- > 0;) {
+        const size_t dim0 = value_with_padding_or(arg0_shape, padding0, i, 1);
+        const size_t dim1 = value_with_padding_or(arg1_shape, padding1, i, 1);
+        output_shape[i] = std::max(dim0, dim1);
+        strides0[i] = dim0 == 1 ? 0 : s0;
+        strides1[i] = dim1 == 1 ? 0 : s1;
+        s0 *= dim0;
+        s1 *= dim1;
+    }
+
+    size_t axis = rank;
+    size_t row_size = 1, step0 = 1, step1 = 1;
+    while (axis > 0 && value_with_padding_or(arg0_shape, padding0, axis - 1, 1) ==
+                           value_with_padding_or(arg1_shape, padding1, axis - 1, 1)) {
+        row_size *= output_shape[--axis];
+    }
+    if (axis == rank && rank > 0) {
+        row_size = output_shape[--axis];
+        step0 = strides0[axis];
+        step1 = strides1[axis];
+    }
+    const size_t rows = shape_size(output_shape.begin(), output_shape.begin() + axis);
+
+    if (rows == 0 || row_size == 0) {
+        return;
+    }
+    // the blocks are the ranges of the output elements rather than of the rows, since the inputs of the same shape are
+    // merged into the single row
+    details::parallel_blocks(rows * row_size, details::parallel_grain, [&](size_t begin, size_t end) {
+        size_t row = begin / row_size;
+        size_t j = begin % row_size;
+        std::vector<size_t> coord(axis);
+        size_t offset0 = 0, offset1 = 0;
+        for (size_t i = axis, r = row; i-- > 0;) {
+            coord[i] = r % output_shape[i];
+            r /= output_shape[i];
+            offset0 += coord[i] * strides0[i];
+            offset1 += coord[i] * strides1[i];
+        }
+        for (U* row_out = out + row * row_size; begin < end; row_out += row_size, j = 0) {
+            const size_t row_end = std::min(row_size, j + (end - begin));
+            begin += row_end - j;
+            for (; j < row_end; ++j) {
+                row_out[j] = elementwise_functor(arg0[offset0 + j * step0], arg1[offset1 + j * step1]);
+            }
+            for (size_t i = axis; i-- > 0;) {
+                offset0 += strides0[i];
+                offset1 += strides1[i];
+                if (++coord[i] < output_shape[i]) {
+                    break;
+                }
+                offset0 -= strides0[i] * output_shape[i];
+                offset1 -= strides1[i] * output_shape[i];
+                coord[i] = 0;
+            }
+        }
+    });
+}
 }  // namespace internal
 
 /**
@@ -323,6 +404,44 @@ void autobroadcast_binop(const T* arg0,
     }
 }
 
+/**
+ * @brief Helper function to implement auto broadcasting elementwise binary op references, which splits the output
+ * between threads.
+ *
+ * Unlike autobroadcast_binop, the functor is called concurrently and in no particular order, so it must not have
+ * state. The small outputs are computed in the calling thread.
+ *
+ * @param arg0                Pointer to the buffer for left operand input tensor.
+ * @param arg1                Pointer to the buffer for right operand input tensor.
+ * @param out                 Pointer to the buffer for output tensor.
+ * @param arg0_shape          Shape of arg0.
+ * @param arg1_shape          Shape of arg1.
+ * @param broadcast_spec      Specification of the auto-broadcasting scheme.
+ * @param elementwise_functor Stateless functor implementing the elementwise operation.
+ */
+template <typename T, typename U, typename Functor>
+void parallel_autobroadcast_binop(const T* arg0,
+                                  const T* arg1,
+                                  U* out,
+                                  const Shape& arg0_shape,
+                                  const Shape& arg1_shape,
+                                  const op::AutoBroadcastSpec& broadcast_spec,
+                                  Functor elementwise_functor) {
+    switch (broadcast_spec.m_type) {
+    case op::AutoBroadcastType::NONE:
+        details::parallel_blocks(shape_size(arg0_shape), details::parallel_grain, [&](size_t begin, size_t end) {
+            no_broadcast_binop(arg0 + begin, arg1 + begin, out + begin, end - begin, elementwise_functor);
+        });
+        break;
+    case op::AutoBroadcastType::NUMPY:
+        internal::numpy_broadcast_binop_rows(arg0, arg1, out, arg0_shape, arg1_shape, elementwise_functor);
+        break;
+    default:
+        autobroadcast_binop(arg0, arg1, out, arg0_shape, arg1_shape, broadcast_spec, elementwise_functor);
+        break;
+    }
+}
+
 /**
  *
  * \brief Helper function to implement auto broadcasting elementwise ternary op references.
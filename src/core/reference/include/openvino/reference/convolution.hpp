@@ -4,11 +4,10 @@
 
 #pragma once
 
-#include <future>
-
 #include "openvino/core/coordinate_diff.hpp"
 #include "openvino/core/shape.hpp"
 #include "openvino/core/strides.hpp"
+#include "openvino/reference/utils/parallel_util.hpp"
 
 namespace ov {
 namespace reference {
@@ -328,84 +327,36 @@ void convolution(const T* in,
         extend_to_2D(params, input_shape, filters_shape);
     }
 
-    auto ncores = std::thread::hardware_concurrency() / 2;
-    if (ncores == 0) {
-        ncores = 1;
+    const size_t batches_count = input_shape[in_batch_axis];
+    const Shape batch_shape(++input_shape.begin(), input_shape.end());
+    const size_t batch_size = shape_size(batch_shape);
+    const size_t out_spatial_size =
+        std::accumulate(out_shape.begin() + 2, out_shape.end(), size_t(1), std::multiplies<size_t>());
+
+    const size_t filters_count = filters_shape[filter_out_ch_axis];
+    const Shape filter_shape(++filters_shape.begin(), filters_shape.end());
+    const size_t filter_size = shape_size(filter_shape);
+
+    void (*conv_channels)(const ConvolutionParams&, const T*, const Shape&, const T*, const Shape&, T*);
+    if (input_shape.size() == 5) {
+        conv_channels = &convolve_3D_channels;
+    } else {
+        conv_channels = &convolve_2D_channels;
     }
-    std::vector<std::future<void>> futures(ncores);
-
-    auto ker_callback = [](const int64_t nthr,
-                           const int64_t ithr,
-                           const T* in,
-                           const T* f,
-                           T* out,
-                           const Shape& input_shape,
-                           const Shape& filters_shape,
-                           const Shape& out_shape,
-                           const ConvolutionParams& params) {
-        const size_t batches_count = input_shape[in_batch_axis];
-        const Shape batch_shape(++input_shape.begin(), input_shape.end());
-        const size_t batch_size = shape_size(batch_shape);
-        const size_t out_spatial_size =
-            std::accumulate(out_shape.begin() + 2, out_shape.end(), size_t(1), std::multiplies<size_t>());
-
-        const size_t filters_count = filters_shape[filter_out_ch_axis];
-        const Shape filter_shape(++filters_shape.begin(), filters_shape.end());
-        const size_t filter_size = shape_size(filter_shape);
-
-        const int64_t work_amount = static_cast<int64_t>(batches_count * filters_count);
-        int64_t start = 0, end = 0;
-        if (nthr <= 1 || work_amount == 0) {
-            start = 0;
-            end = work_amount;
-        } else {
-            auto n1 = (work_amount + nthr - 1) / nthr;
-            auto n2 = n1 - 1;
-            auto T1 = work_amount - n2 * nthr;
-            end = ithr < T1 ? n1 : n2;
-            start = ithr <= T1 ? ithr * n1 : T1 * n1 + (ithr - T1) * n2;
-        }
-        end += start;
-        if (start >= end) {
-            return;
-        }
-
-        void (*conv_channels)(const ConvolutionParams&, const T*, const Shape&, const T*, const Shape&, T*);
-        if (input_shape.size() == 5) {
-            conv_channels = &convolve_3D_channels;
-        } else {
-            conv_channels = &convolve_2D_channels;
-        }
-
-        size_t batch_idx = start / filters_count;
-        size_t c_idx = start % filters_count;
 
-        auto in_data = in + batch_size * batch_idx;
-        auto filter = f + filter_size * c_idx;
-        auto out_data = out + out_spatial_size * filters_count * batch_idx + out_spatial_size * c_idx;
-
-        for (; batch_idx < batches_count; ++batch_idx) {
-            for (; c_idx < filters_count && start < end; c_idx++, start++) {
-                conv_channels(params, in_data, batch_shape, filter, filter_shape, out_data);
-                filter += filter_size;
-                out_data += out_spatial_size;
-            }
-            if (start >= end) {
-                break;
-            }
-            filter = f;
-            c_idx = 0;
-            in_data += batch_size;
+    // every output channel of every batch is computed independently, so the pairs are split between the threads
+    details::parallel_blocks(batches_count * filters_count, 1, [&](size_t start, size_t end) {
+        for (size_t idx = start; idx < end; ++idx) {
+            const size_t batch_idx = idx / filters_count;
+            const size_t c_idx = idx % filters_count;
+            conv_channels(params,
+                          in + batch_size * batch_idx,
+                          batch_shape,
+                          f + filter_size * c_idx,
+                          filter_shape,
+                          out + out_spatial_size * idx);
         }
-    };
-
-    for (size_t ithr = 0; ithr < ncores; ithr++) {
-        futures[ithr] =
-            std::async(ker_callback, ncores, ithr, in, f, out, input_shape, filters_shape, out_shape, params);
-    }
-    for (size_t ithr = 0; ithr < ncores; ithr++) {
-        futures[ithr].get();
-    }
+    });
 }
 }  // namespace reference
 }  // namespace ov
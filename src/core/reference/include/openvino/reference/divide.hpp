@@ -57,7 +57,7 @@ std::enable_if_t<std::is_integral_v<T>> divide(const T* arg0,
                                                const op::AutoBroadcastSpec& broadcast_spec,
                                                bool pythondiv) {
     auto div = pythondiv ? func::try_python_div<T> : func::try_div<T>;
-    autobroadcast_binop(arg0, arg1, out, arg0_shape, arg1_shape, broadcast_spec, div);
+    parallel_autobroadcast_binop(arg0, arg1, out, arg0_shape, arg1_shape, broadcast_spec, div);
 }
 
 // In English: return type is void and T must be a standard floating point type, or
@@ -79,7 +79,7 @@ std::enable_if_t<std::is_floating_point_v<T> || std::is_same_v<T, bfloat16> || s
     const Shape& arg1_shape,
     const op::AutoBroadcastSpec& broadcast_spec,
     bool) {
-    autobroadcast_binop(arg0, arg1, out, arg0_shape, arg1_shape, broadcast_spec, func::div<T>);
+    parallel_autobroadcast_binop(arg0, arg1, out, arg0_shape, arg1_shape, broadcast_spec, func::div<T>);
 }
 }  // namespace reference
 }  // namespace ov
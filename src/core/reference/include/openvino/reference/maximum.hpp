@@ -41,7 +41,7 @@ void maximum(const T* arg0,
              const Shape& arg0_shape,
              const Shape& arg1_shape,
              const op::AutoBroadcastSpec& broadcast_spec) {
-    autobroadcast_binop(arg0, arg1, out, arg0_shape, arg1_shape, broadcast_spec, func::max<T>);
+    parallel_autobroadcast_binop(arg0, arg1, out, arg0_shape, arg1_shape, broadcast_spec, func::max<T>);
 }
 }  // namespace reference
 }  // namespace ov
@@ -11,20 +11,14 @@
 #include "openvino/core/shape_util.hpp"
 #include "openvino/reference/utils/coordinate_index.hpp"
 #include "openvino/reference/utils/coordinate_transform.hpp"
+#include "openvino/reference/utils/parallel_util.hpp"
 
 namespace ov {
 namespace reference {
 
-/**
- * @brief Reference implementation of ReduceMax operator.
- *
- * @param in             Input pointer to data.
- * @param out            Output pointer to results.
- * @param in_shape       Input shape.
- * @param reduction_axes Axes on which reduction is applied.
- */
+namespace details {
 template <class T>
-void reduce_max(const T* in, T* out, const Shape& in_shape, const AxisSet& reduction_axes) {
+void reduce_max_block(const T* in, T* out, const Shape& in_shape, const AxisSet& reduction_axes) {
     constexpr auto min_value = std::numeric_limits<T>::lowest();
 
     const auto out_shape = util::reduce(in_shape, reduction_axes);
@@ -42,5 +36,24 @@ void reduce_max(const T* in, T* out, const Shape& in_shape, const AxisSet& reduc
         out[out_idx] = std::max(out[out_idx], in[in_idx]);
     }
 }
+}  // namespace details
+
+/**
+ * @brief Reference implementation of ReduceMax operator.
+ *
+ * @param in             Input pointer to data.
+ * @param out            Output pointer to results.
+ * @param in_shape       Input shape.
+ * @param reduction_axes Axes on which reduction is applied.
+ */
+template <class T>
+void reduce_max(const T* in, T* out, const Shape& in_shape, const AxisSet& reduction_axes) {
+    details::parallel_reduce_blocks(in_shape,
+                                    reduction_axes,
+                                    details::parallel_grain,
+                                    [&](size_t in_offset, size_t out_offset, const Shape& shape, const AxisSet& axes) {
+                                        details::reduce_max_block(in + in_offset, out + out_offset, shape, axes);
+                                    });
+}
 }  // namespace reference
 }  // namespace ov
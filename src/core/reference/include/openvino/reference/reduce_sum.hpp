@@ -12,6 +12,7 @@
 #include "openvino/core/type/float16.hpp"
 #include "openvino/reference/utils/coordinate_index.hpp"
 #include "openvino/reference/utils/coordinate_transform.hpp"
+#include "openvino/reference/utils/parallel_util.hpp"
 #include "openvino/reference/utils/type_util.hpp"
 
 namespace ov {
@@ -60,18 +61,9 @@ T kahan_summation(const T in, const T prev_sum, T& compensation) {
         return in + prev_sum;
     }
 }
-}  // namespace details
 
-/**
- * @brief Reference implementation of ReduceSum operator.
- *
- * @param in             Input pointer to data.
- * @param out            Output pointer to results.
- * @param in_shape       Input shape.
- * @param reduction_axes Axes on which reduction is applied.
- */
 template <typename T>
-void reduce_sum(const T* in, T* out, const Shape& in_shape, const AxisSet& reduction_axes) {
+void reduce_sum_block(const T* in, T* out, const Shape& in_shape, const AxisSet& reduction_axes) {
     const auto out_shape = util::reduce(in_shape, reduction_axes);
 
     const auto out_size = shape_size(out_shape);
@@ -90,5 +82,24 @@ void reduce_sum(const T* in, T* out, const Shape& in_shape, const AxisSet& reduc
         out[out_idx] = details::kahan_summation(in[in_idx], out[out_idx], cs[out_idx]);
     }
 }
+}  // namespace details
+
+/**
+ * @brief Reference implementation of ReduceSum operator.
+ *
+ * @param in             Input pointer to data.
+ * @param out            Output pointer to results.
+ * @param in_shape       Input shape.
+ * @param reduction_axes Axes on which reduction is applied.
+ */
+template <typename T>
+void reduce_sum(const T* in, T* out, const Shape& in_shape, const AxisSet& reduction_axes) {
+    details::parallel_reduce_blocks(in_shape,
+                                    reduction_axes,
+                                    details::parallel_grain,
+                                    [&](size_t in_offset, size_t out_offset, const Shape& shape, const AxisSet& axes) {
+                                        details::reduce_sum_block(in + in_offset, out + out_offset, shape, axes);
+                                    });
+}
 }  // namespace reference
 }  // namespace ov
@@ -0,0 +1,107 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+
+#include "openvino/core/axis_set.hpp"
+#include "openvino/core/parallel.hpp"
+#include "openvino/core/shape.hpp"
+#include "openvino/core/shape_util.hpp"
+
+namespace ov {
+namespace reference {
+namespace details {
+
+// Minimal number of the elementary operations processed by one thread
+constexpr size_t parallel_grain = 1 << 15;
+
+/**
+ * @brief Splits the range [0, count) into the contiguous blocks and processes them in parallel.
+ *
+ * The range is processed in the calling thread if it has less than two grains of work, so the small tensors (e.g.
+ * the constant folding) are not affected by the threading overhead. The exception thrown by any of the blocks is
+ * rethrown in the calling thread.
+ *
+ * @param count Number of the work items.
+ * @param grain Minimal number of the work items processed by one thread.
+ * @param func  Function processing the work items [begin, end).
+ */
+template <class F>
+void parallel_blocks(const size_t count, const size_t grain, const F& func) {
+    const auto max_threads = static_cast<size_t>(std::max(parallel_get_max_threads(), 1));
+    const auto nthr = std::min(max_threads, count / std::max<size_t>(grain, 1));
+    if (nthr <= 1) {
+        func(size_t{0}, count);
+        return;
+    }
+
+    std::exception_ptr error;
+    std::mutex error_mutex;
+    ov::parallel_nt(static_cast<int>(nthr), [&](const int ithr, const int nthr) {
+        size_t begin = 0, end = 0;
+        ov::splitter(count, nthr, ithr, begin, end);
+        if (begin >= end) {
+            return;
+        }
+        try {
+            func(begin, end);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(error_mutex);
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+    });
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+/**
+ * @brief Splits the reduction into the independent blocks of the leading not reduced axes and reduces them in parallel.
+ *
+ * Every block keeps the order of the accumulation of the whole reduction, so the results do not depend on the number
+ * of threads.
+ *
+ * @param in_shape       Input shape.
+ * @param reduction_axes Axes on which reduction is applied.
+ * @param grain          Minimal number of the input elements reduced by one thread.
+ * @param func           Function reducing the block: (input offset, output offset, block shape, block axes).
+ */
+template <class F>
+void parallel_reduce_blocks(const Shape& in_shape, const AxisSet& reduction_axes, const size_t grain, const F& func) {
+    size_t outer_rank = 0;
+    while (outer_rank < in_shape.size() && reduction_axes.count(outer_rank) == 0) {
+        ++outer_rank;
+    }
+    if (outer_rank == 0 || outer_rank == in_shape.size()) {
+        func(size_t{0}, size_t{0}, in_shape, reduction_axes);
+        return;
+    }
+
+    const Shape block_shape(in_shape.begin() + outer_rank, in_shape.end());
+    AxisSet block_axes;
+    for (const auto axis : reduction_axes) {
+        block_axes.insert(axis - outer_rank);
+    }
+    const auto outer_size = shape_size(in_shape.begin(), in_shape.begin() + outer_rank);
+    const auto in_block_size = shape_size(block_shape);
+    const auto out_block_size = shape_size(util::reduce(block_shape, block_axes));
+
+    const auto block_grain = (grain + in_block_size - 1) / std::max<size_t>(in_block_size, 1);
+    parallel_blocks(outer_size, block_grain, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            func(i * in_block_size, i * out_block_size, block_shape, block_axes);
+        }
+    });
+}
+
+}  // namespace details
+}  // namespace reference
+}  // namespace ov
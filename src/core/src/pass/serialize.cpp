@@ -4,10 +4,13 @@
 
 #include "openvino/pass/serialize.hpp"
 
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <cstdint>
 #include <fstream>
+#include <map>
+#include <memory>
 #include <openvino/cc/pass/itt.hpp>
 #include <unordered_map>
 #include <unordered_set>
@@ -118,72 +121,109 @@ public:
         const FilePosition write_pos = m_binary_output.tellp();
         const auto offset = write_pos - m_blob_offset;
         new_size = size;
+        if (compress_to_fp16) {
+            OPENVINO_ASSERT(size % src_type.size() == 0);
+            new_size = size / src_type.size() * ov::element::f16.size();
+        }
 
         if (!m_enable_compression) {
-            if (!compress_to_fp16) {
-                m_binary_output.write(ptr, size);
-            } else {
-                OPENVINO_ASSERT(size % src_type.size() == 0);
-                auto fp16_buffer = compress_data_to_fp16(ptr, size, src_type, new_size);
-                m_binary_output.write(fp16_buffer.get(), new_size);
-            }
+            write_data(ptr, size, compress_to_fp16, src_type);
             return offset;
-        } else {
+        } else if (m_write_hash_value) {
+            // Only the hashes go to the cache key stream, so the compressed data is hashed as it would be written and
+            // the duplicates keep the offset of the first copy. Both must stay stable to keep the cache keys.
             std::unique_ptr<char[]> fp16_buffer = nullptr;
             if (compress_to_fp16) {
-                OPENVINO_ASSERT(size % src_type.size() == 0);
                 fp16_buffer = compress_data_to_fp16(ptr, size, src_type, new_size);
             }
-            const char* ptr_to_write;
-            if (fp16_buffer) {
-                ptr_to_write = fp16_buffer.get();
-            } else {
-                ptr_to_write = ptr;
+            const HashValue hash = ov::runtime::compute_hash(fp16_buffer ? fp16_buffer.get() : ptr, new_size);
+            FilePosition duplicate_offset = 0;
+            if (find_or_insert(m_hash_to_file_positions, hash, ptr, size, ptr_is_temporary, offset, duplicate_offset)) {
+                return duplicate_offset;
             }
-
-            // This hash is weak (but efficient). For example current hash algorithms gives
-            // the same hash for {2, 2} and {0, 128} arrays.
-            // But even strong hashing algorithms sometimes give collisions.
-            // Therefore we always have to compare values when finding a match in the hash multimap.
-            const HashValue hash = ov::runtime::compute_hash(ptr_to_write, new_size);
-
-            auto found = m_hash_to_file_positions.equal_range(hash);
-            // iterate over all matches of the key in the multimap
-            for (auto it = found.first; it != found.second; ++it) {
-                if (memcmp(ptr, it->second.second, size) == 0) {
-                    return it->second.first;
-                }
-            }
-            if (!ptr_is_temporary) {
-                // Since fp16_compressed data will be disposed at exit point and since we cannot reread it from the
-                // ostream, we store pointer to the original uncompressed blob.
-                m_hash_to_file_positions.insert({hash, {offset, static_cast<const void*>(ptr)}});
-            }
-            if (m_write_hash_value) {
-                m_binary_output.write(reinterpret_cast<const char*>(&hash), sizeof(uint64_t));
-            } else {
-                m_binary_output.write(ptr_to_write, new_size);
+            m_binary_output.write(reinterpret_cast<const char*>(&hash), sizeof(uint64_t));
+        } else {
+            // The original data is hashed and compared, so the compressed data is written chunk by chunk and never
+            // allocated as a whole. The same original data gives the same compressed one, but the compressed and not
+            // compressed data must not be mixed, so they are looked up in the separate maps.
+            const HashValue hash = ov::runtime::compute_hash(ptr, size);
+            auto& file_positions =
+                compress_to_fp16 ? m_compressed_hash_to_file_positions[src_type] : m_hash_to_file_positions;
+            FilePosition duplicate_offset = 0;
+            if (find_or_insert(file_positions, hash, ptr, size, ptr_is_temporary, offset, duplicate_offset)) {
+                return duplicate_offset;
             }
+            write_data(ptr, size, compress_to_fp16, src_type);
         }
         return offset;
     }
 
 private:
+    // Returns true and the offset of the same data written before, otherwise remembers the data at the given offset
+    static bool find_or_insert(ConstWritePositions& file_positions,
+                               HashValue hash,
+                               const char* ptr,
+                               size_t size,
+                               bool ptr_is_temporary,
+                               FilePosition offset,
+                               FilePosition& duplicate_offset) {
+        // This hash is weak (but efficient). For example current hash algorithms gives
+        // the same hash for {2, 2} and {0, 128} arrays.
+        // But even strong hashing algorithms sometimes give collisions.
+        // Therefore we always have to compare values when finding a match in the hash multimap.
+        auto found = file_positions.equal_range(hash);
+        // iterate over all matches of the key in the multimap
+        for (auto it = found.first; it != found.second; ++it) {
+            if (memcmp(ptr, it->second.second, size) == 0) {
+                duplicate_offset = it->second.first;
+                return true;
+            }
+        }
+        if (!ptr_is_temporary) {
+            // Since we cannot reread the data from the ostream, we store pointer to the original blob.
+            file_positions.insert({hash, {offset, static_cast<const void*>(ptr)}});
+        }
+        return false;
+    }
+
+    // Number of elements compressed to fp16 at once, the compressed data is written by chunks of 2 MB
+    static constexpr size_t fp16_chunk_elements = 1 << 20;
+
+    void write_data(const char* ptr, size_t size, bool compress_to_fp16, ov::element::Type src_type) {
+        if (!compress_to_fp16) {
+            m_binary_output.write(ptr, size);
+            return;
+        }
+        const auto num_src_elements = size / src_type.size();
+        if (!m_fp16_chunk) {
+            m_fp16_chunk.reset(new ov::float16[fp16_chunk_elements]);
+        }
+        for (size_t i = 0; i < num_src_elements; i += fp16_chunk_elements) {
+            const auto count = std::min(fp16_chunk_elements, num_src_elements - i);
+            compress_to_fp16_chunk(ptr + i * src_type.size(), count, src_type, m_fp16_chunk.get());
+            m_binary_output.write(reinterpret_cast<const char*>(m_fp16_chunk.get()), count * ov::element::f16.size());
+        }
+    }
+
     static std::unique_ptr<char[]> compress_data_to_fp16(const char* ptr,
                                                          size_t size,
                                                          ov::element::Type src_type,
                                                          size_t& compressed_size) {
         auto num_src_elements = size / src_type.size();
         compressed_size = num_src_elements * ov::element::f16.size();
+        auto new_ptr = std::unique_ptr<char[]>(new char[compressed_size]);
+        compress_to_fp16_chunk(ptr, num_src_elements, src_type, reinterpret_cast<ov::float16*>(new_ptr.get()));
+        return new_ptr;
+    }
+
+    static void compress_to_fp16_chunk(const char* ptr,
+                                       size_t num_src_elements,
+                                       ov::element::Type src_type,
+                                       ov::float16* dst_data) {
         if (src_type == ov::element::f32) {
-            auto new_ptr = std::unique_ptr<char[]>(new char[compressed_size]);
-            auto dst_data = reinterpret_cast<ov::float16*>(new_ptr.get());
             auto src_data = reinterpret_cast<const float*>(ptr);
             ov::reference::convert_from_f32_to_f16_with_clamp(src_data, dst_data, num_src_elements);
-            return new_ptr;
         } else if (src_type == ov::element::f64) {
-            auto new_ptr = std::unique_ptr<char[]>(new char[compressed_size]);
-            auto dst_data = reinterpret_cast<ov::float16*>(new_ptr.get());
             auto src_data = reinterpret_cast<const double*>(ptr);
 
             // Reference implementation for fp64 to fp16 conversoin
@@ -199,13 +239,14 @@ private:
                     dst_data[i] = static_cast<ov::float16>(src_data[i]);
                 }
             }
-            return new_ptr;
         } else {
             OPENVINO_THROW("[ INTERNAL ERROR ] Not supported source type for weights compression: ", src_type);
         }
     }
 
     ConstWritePositions m_hash_to_file_positions;
+    std::map<ov::element::Type, ConstWritePositions> m_compressed_hash_to_file_positions;
+    std::unique_ptr<ov::float16[]> m_fp16_chunk;
     std::ostream& m_binary_output;
     bool m_enable_compression;
     bool m_write_hash_value = false;
@@ -1296,7 +1337,12 @@ bool pass::Serialize::run_on_model(const std::shared_ptr<ov::Model>& model) {
     } else {
         ov::util::create_directory_recursive(m_xmlPath);
 
-        std::ofstream bin_file(m_binPath, std::ios::binary);
+        // the small constants are gathered into the large writes, the large ones are written directly
+        constexpr size_t bin_buffer_size = 4 * 1024 * 1024;
+        std::unique_ptr<char[]> bin_buffer(new char[bin_buffer_size]);
+        std::ofstream bin_file;
+        bin_file.rdbuf()->pubsetbuf(bin_buffer.get(), bin_buffer_size);
+        bin_file.open(m_binPath, std::ios::binary);
         OPENVINO_ASSERT(bin_file, "Can't open bin file: \"", m_binPath, "\"");
 
         // create xml file
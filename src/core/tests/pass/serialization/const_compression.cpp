@@ -12,6 +12,7 @@
 #include "openvino/pass/serialize.hpp"
 #include "openvino/runtime/core.hpp"
 #include "transformations/common_optimizations/compress_float_constants.hpp"
+#include "transformations/rt_info/disable_fp16_compression.hpp"
 
 class SerializationConstantCompressionTest : public ov::test::TestsCommon {
 protected:
@@ -382,3 +383,40 @@ TEST_F(SerializationConstantCompressionTest, EmptyAndNotEmptyConstantsDifferentV
     std::tie(success, message) = compare_functions(model_initial, model_imported, true, true, false, true, true);
     ASSERT_TRUE(success) << message;
 }
+
+TEST_F(SerializationConstantCompressionTest, LargeConstantsFP32_COMPRESSED_TO_FP16) {
+    // the compressed data is written by chunks, so the constant takes several of them
+    const ov::Shape shape{3, 1024 * 1024 + 5};
+    std::vector<float> values(ov::shape_size(shape));
+    for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = static_cast<float>(i % 1000) * 0.5f;
+    }
+    auto A = ov::op::v0::Constant::create(ov::element::f32, shape, values);
+    auto B = ov::op::v0::Constant::create(ov::element::f32, shape, values);
+    auto C = ov::op::v0::Constant::create(ov::element::f32, shape, values);
+    ov::disable_fp16_compression(C);
+
+    auto model = std::make_shared<ov::Model>(ov::OutputVector{A, B, C}, ov::ParameterVector{});
+    ov::pass::CompressFloatConstants(/*postponed=*/true).run_on_model(model);
+    ov::pass::Serialize(m_out_xml_path_1, m_out_bin_path_1).run_on_model(model);
+
+    std::ifstream bin_1(m_out_bin_path_1, std::ios::binary);
+    // the compressed and not compressed copies of the same data are not shared
+    ASSERT_EQ(file_size(bin_1), values.size() * (sizeof(ov::float16) + sizeof(float)));
+    bin_1.close();
+
+    ov::Core core;
+    auto model_imported = core.read_model(m_out_xml_path_1, m_out_bin_path_1);
+    size_t compressed = 0;
+    for (const auto& op : model_imported->get_ordered_ops()) {
+        const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(op);
+        if (!constant) {
+            continue;
+        }
+        if (constant->get_element_type() == ov::element::f16) {
+            ++compressed;
+        }
+        ASSERT_EQ(constant->cast_vector<float>(), values);
+    }
+    ASSERT_EQ(compressed, 2);
+}
@@ -0,0 +1,157 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "openvino/core/shape.hpp"
+#include "openvino/reference/add.hpp"
+#include "openvino/reference/autobroadcast_binop.hpp"
+#include "openvino/reference/convolution.hpp"
+#include "openvino/reference/matmul.hpp"
+#include "openvino/reference/reduce_max.hpp"
+#include "openvino/reference/reduce_sum.hpp"
+
+using namespace ov;
+
+// The kernels below are split between the threads above details::parallel_grain, so every test takes a few grains of
+// work and compares the result with the sequential computation.
+
+namespace {
+
+// the values are multiples of 1/16, so the sums below are exact in any order
+std::vector<float> make_data(const Shape& shape) {
+    std::vector<float> data(shape_size(shape));
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<float>(static_cast<int>(i * 7919 % 201) - 100) / 16.0f;
+    }
+    return data;
+}
+
+struct BinopParams {
+    Shape arg0_shape;
+    Shape arg1_shape;
+    op::AutoBroadcastType broadcast;
+};
+
+class ParallelBinopTest : public ::testing::TestWithParam<BinopParams> {};
+
+}  // namespace
+
+TEST_P(ParallelBinopTest, matches_sequential) {
+    const auto& p = GetParam();
+    const auto arg0 = make_data(p.arg0_shape);
+    const auto arg1 = make_data(p.arg1_shape);
+    auto out_shape = p.arg0_shape.size() >= p.arg1_shape.size() ? p.arg0_shape : p.arg1_shape;
+    for (size_t i = 1; i <= std::min(p.arg0_shape.size(), p.arg1_shape.size()); ++i) {
+        out_shape[out_shape.size() - i] =
+            std::max(p.arg0_shape[p.arg0_shape.size() - i], p.arg1_shape[p.arg1_shape.size() - i]);
+    }
+    ASSERT_GT(shape_size(out_shape), 2 * reference::details::parallel_grain);
+
+    std::vector<float> expected(shape_size(out_shape)), result(shape_size(out_shape));
+    reference::autobroadcast_binop(arg0.data(),
+                                   arg1.data(),
+                                   expected.data(),
+                                   p.arg0_shape,
+                                   p.arg1_shape,
+                                   p.broadcast,
+                                   reference::func::add<float>);
+    reference::add(arg0.data(), arg1.data(), result.data(), p.arg0_shape, p.arg1_shape, p.broadcast);
+    EXPECT_EQ(result, expected);
+}
+
+INSTANTIATE_TEST_SUITE_P(reference,
+                         ParallelBinopTest,
+                         ::testing::Values(
+                             // the same shapes are merged into a single row
+                             BinopParams{{1, 32, 64, 64}, {1, 32, 64, 64}, op::AutoBroadcastType::NUMPY},
+                             BinopParams{{1, 32, 64, 64}, {1, 32, 64, 64}, op::AutoBroadcastType::NONE},
+                             BinopParams{{8, 64, 160}, {64, 1}, op::AutoBroadcastType::NUMPY},
+                             BinopParams{{4, 32, 1, 256}, {32, 64, 1}, op::AutoBroadcastType::NUMPY},
+                             BinopParams{{1}, {3, 50000}, op::AutoBroadcastType::NUMPY}));
+
+TEST(ParallelReduceTest, matches_sequential) {
+    const Shape shape{64, 48, 40};
+    const auto in = make_data(shape);
+    for (const auto& axes : {AxisSet{0}, AxisSet{1}, AxisSet{2}, AxisSet{1, 2}, AxisSet{0, 2}}) {
+        const auto out_size = shape_size(util::reduce(shape, axes));
+        std::vector<float> expected(out_size), result(out_size);
+
+        reference::details::reduce_sum_block(in.data(), expected.data(), shape, axes);
+        reference::reduce_sum(in.data(), result.data(), shape, axes);
+        EXPECT_EQ(result, expected) << "ReduceSum over " << axes;
+
+        reference::details::reduce_max_block(in.data(), expected.data(), shape, axes);
+        reference::reduce_max(in.data(), result.data(), shape, axes);
+        EXPECT_EQ(result, expected) << "ReduceMax over " << axes;
+    }
+}
+
+TEST(ParallelMatMulTest, matches_sequential) {
+    // the batches are split for the 3D case and the rows of the single dot product for the 2D one
+    for (const auto& shapes : {std::vector<Shape>{{4, 64, 96}, {96, 80}, {4, 64, 80}},
+                               std::vector<Shape>{{256, 128}, {128, 64}, {256, 64}}}) {
+        const auto& a_shape = shapes[0];
+        const auto& b_shape = shapes[1];
+        const auto& out_shape = shapes[2];
+        const auto a = make_data(a_shape);
+        const auto b = make_data(b_shape);
+        const size_t M = a_shape[a_shape.size() - 2], K = b_shape[0], N = b_shape[1];
+        const size_t batch = shape_size(a_shape) / (M * K);
+
+        std::vector<float> expected(shape_size(out_shape), 0.0f), result(shape_size(out_shape));
+        for (size_t n = 0; n < batch; ++n) {
+            for (size_t i = 0; i < M; ++i) {
+                for (size_t k = 0; k < K; ++k) {
+                    for (size_t j = 0; j < N; ++j) {
+                        expected[(n * M + i) * N + j] += a[(n * M + i) * K + k] * b[k * N + j];
+                    }
+                }
+            }
+        }
+        reference::matmul(a.data(), b.data(), result.data(), a_shape, b_shape, out_shape, false, false);
+        EXPECT_EQ(result, expected) << "MatMul " << a_shape << " x " << b_shape;
+    }
+}
+
+TEST(ParallelConvolutionTest, matches_sequential) {
+    const Shape in_shape{2, 4, 34, 34}, filters_shape{8, 4, 3, 3}, out_shape{2, 8, 32, 32};
+    const auto in = make_data(in_shape);
+    const auto filters = make_data(filters_shape);
+
+    std::vector<float> expected(shape_size(out_shape), 0.0f), result(shape_size(out_shape));
+    for (size_t n = 0; n < out_shape[0]; ++n) {
+        for (size_t oc = 0; oc < out_shape[1]; ++oc) {
+            for (size_t y = 0; y < out_shape[2]; ++y) {
+                for (size_t x = 0; x < out_shape[3]; ++x) {
+                    float acc = 0.0f;
+                    for (size_t ic = 0; ic < in_shape[1]; ++ic) {
+                        for (size_t ky = 0; ky < filters_shape[2]; ++ky) {
+                            for (size_t kx = 0; kx < filters_shape[3]; ++kx) {
+                                acc += in[((n * in_shape[1] + ic) * in_shape[2] + y + ky) * in_shape[3] + x + kx] *
+                                       filters[((oc * in_shape[1] + ic) * filters_shape[2] + ky) * filters_shape[3] +
+                                               kx];
+                            }
+                        }
+                    }
+                    expected[((n * out_shape[1] + oc) * out_shape[2] + y) * out_shape[3] + x] = acc;
+                }
+            }
+        }
+    }
+    reference::convolution(in.data(),
+                           filters.data(),
+                           result.data(),
+                           in_shape,
+                           filters_shape,
+                           out_shape,
+                           Strides{1, 1},
+                           Strides{1, 1},
+                           CoordinateDiff{0, 0},
+                           CoordinateDiff{0, 0});
+    EXPECT_EQ(result, expected);
+}
@@ -4,10 +4,15 @@
 
 #include "ir_deserializer.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <future>
 #include <pugixml.hpp>
 #include <regex>
 #include <stack>
 #include <string_view>
+#include <thread>
 
 #include "openvino/core/descriptor_tensor.hpp"
 #include "openvino/core/except.hpp"
@@ -71,6 +76,60 @@ std::unordered_set<std::string> deserialize_tensor_names(const std::string_view&
 
     return output_names;
 }
+
+// Minimal number of the independent items which are worth to be processed in parallel
+constexpr size_t parallel_items_threshold = 64;
+
+/**
+ * @brief Runs the function for all items in [0, count) on a pool of threads.
+ *
+ * Small ranges are processed in the calling thread. The items are taken by the threads in chunks, and if several items
+ * fail, the exception of the item with the lowest index is rethrown, so the reported error doesn't depend on the
+ * threads scheduling.
+ *
+ * @param count Number of items.
+ * @param func Function processing a single item.
+ */
+template <class F>
+void parallel_items(const size_t count, const F& func) {
+    const auto workers = std::min<size_t>(std::max(std::thread::hardware_concurrency(), 1u),
+                                          count / parallel_items_threshold);
+    if (workers <= 1) {
+        for (size_t i = 0; i < count; ++i) {
+            func(i);
+        }
+        return;
+    }
+
+    constexpr size_t chunk = 16;
+    std::atomic<size_t> next{0};
+    std::vector<std::exception_ptr> errors(count);
+    auto process = [&] {
+        for (auto begin = next.fetch_add(chunk); begin < count; begin = next.fetch_add(chunk)) {
+            for (size_t i = begin; i < std::min(begin + chunk, count); ++i) {
+                try {
+                    func(i);
+                } catch (...) {
+                    errors[i] = std::current_exception();
+                }
+            }
+        }
+    };
+    std::vector<std::future<void>> futures;
+    futures.reserve(workers - 1);
+    for (size_t worker = 1; worker < workers; ++worker) {
+        futures.emplace_back(std::async(std::launch::async, process));
+    }
+    process();
+    for (auto& future : futures) {
+        future.get();
+    }
+    for (const auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
 }  // namespace
 
 ov::XmlDeserializer::IoMap ov::XmlDeserializer::updated_io_map(const pugi::xml_node& node,
@@ -506,8 +565,17 @@ std::shared_ptr<ov::Model> ov::XmlDeserializer::parse_function(const pugi::xml_n
     std::set<size_t> dfs_used_nodes;
     std::map<size_t /*to-layer-id*/, std::vector<Edge>> edges;
     // Read all layers and store their parameters in params map
+    std::vector<pugi::xml_node> layers;
     FOREACH_CHILD (node, root.child("layers"), "layer") {
-        auto node_param = parse_generic_params(node);
+        layers.push_back(node);
+    }
+    std::vector<GenericLayerParams> layers_params(layers.size());
+    parallel_items(layers.size(), [&](size_t i) {
+        layers_params[i] = parse_generic_params(layers[i]);
+    });
+    for (size_t i = 0; i < layers.size(); ++i) {
+        const auto& node = layers[i];
+        auto& node_param = layers_params[i];
         params[node_param.layerId] = {node, node_param};
         if (node_param.type == "Result" || node_param.type == "Assign") {
             outputs.push_back(node_param.layerId);
@@ -562,6 +630,26 @@ std::shared_ptr<ov::Model> ov::XmlDeserializer::parse_function(const pugi::xml_n
     std::map<size_t, std::shared_ptr<ov::Node>> id_to_node;
     std::map<std::string, std::shared_ptr<ov::Node>> variable_id_to_read_value;
 
+    // The constants don't depend on other layers and don't modify them, so they are created in parallel in advance.
+    // The constants created by extensions are created in order, since the extensions can be not thread safe.
+    std::vector<size_t> constants_ids;
+    for (const auto& layer_id : order) {
+        const auto& p = params.at(layer_id).params;
+        if (p.type == "Const" && edges.at(layer_id).empty() &&
+            m_extensions.find(ov::DiscreteTypeInfo("Constant", p.version.c_str())) == m_extensions.end()) {
+            constants_ids.push_back(layer_id);
+        }
+    }
+    std::vector<std::shared_ptr<ov::Node>> constants(constants_ids.size());
+    parallel_items(constants_ids.size(), [&](size_t i) {
+        const auto& p = params.at(constants_ids[i]);
+        constants[i] = create_node({}, p.xml, weights, p.params);
+    });
+    std::unordered_map<size_t, std::shared_ptr<ov::Node>> created_nodes;
+    for (size_t i = 0; i < constants_ids.size(); ++i) {
+        created_nodes.emplace(constants_ids[i], std::move(constants[i]));
+    }
+
     //  Following topological order create OpenVINO operations
     for (auto& layer_id : order) {
         auto& p = params[layer_id];
@@ -586,7 +674,8 @@ std::shared_ptr<ov::Model> ov::XmlDeserializer::parse_function(const pugi::xml_n
             inputs[realInputPortId] = input_node->output(p_output.get_real_output_port_id(e.fromPortId));
         }
 
-        auto node = create_node(inputs, p.xml, weights, p.params);
+        const auto created = created_nodes.find(layer_id);
+        auto node = created != created_nodes.end() ? created->second : create_node(inputs, p.xml, weights, p.params);
         id_to_node[layer_id] = node;
 
         if (const auto& parameter_node = ov::as_type_ptr<ov::op::v0::Parameter>(node)) {
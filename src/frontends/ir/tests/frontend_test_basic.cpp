@@ -2,6 +2,9 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <cstring>
+#include <sstream>
+
 #include "common_test_utils/test_assertions.hpp"
 #include "frontend_test.hpp"
 #include "openvino/op/add.hpp"
@@ -11,6 +14,7 @@
 #include "openvino/opsets/opset1_decl.hpp"
 #include "openvino/opsets/opset3_decl.hpp"
 #include "openvino/opsets/opset6_decl.hpp"
+#include "openvino/pass/serialize.hpp"
 #include "utils.hpp"
 
 class IRFrontendTests : public ::testing::Test, public IRFrontendTestsImpl {
@@ -1805,3 +1809,41 @@ TEST_F(IRFrontendTests, VeryShortValidModel) {
     OV_ASSERT_NO_THROW(version = model->get_rt_info().at("version").as<int64_t>());
     ASSERT_EQ(11, version);
 }
+
+TEST_F(IRFrontendTests, model_with_many_constants) {
+    // the constants of a big model are created in parallel, they must keep their values, names and order of inputs
+    auto param = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::Shape{4});
+    param->set_friendly_name("input");
+    ov::Output<ov::Node> last = param;
+    for (size_t i = 0; i < 1000; ++i) {
+        auto constant = ov::opset1::Constant::create(ov::element::f32,
+                                                     ov::Shape{4},
+                                                     {static_cast<float>(i), 1.f, 2.f, static_cast<float>(i % 7)});
+        constant->set_friendly_name("constant_" + std::to_string(i));
+        auto add = i % 2 ? std::make_shared<ov::opset1::Add>(last, constant)
+                         : std::make_shared<ov::opset1::Add>(constant, last);
+        add->set_friendly_name("add_" + std::to_string(i));
+        last = add;
+    }
+    auto result = std::make_shared<ov::opset1::Result>(last);
+    result->set_friendly_name("output");
+    const auto model_ref = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param});
+
+    std::stringstream xml_stream, bin_stream;
+    ov::pass::Serialize(xml_stream, bin_stream).run_on_model(model_ref);
+    const auto bin = bin_stream.str();
+    ov::Tensor weights(ov::element::u8, ov::Shape{bin.size()});
+    std::memcpy(weights.data(), bin.data(), bin.size());
+
+    std::shared_ptr<ov::Model> model;
+    OV_ASSERT_NO_THROW(model = core.read_model(xml_stream.str(), weights));
+    ASSERT_TRUE(!!model);
+
+    const auto fc = FunctionsComparator::with_default()
+                        .enable(FunctionsComparator::ATTRIBUTES)
+                        .enable(FunctionsComparator::PRECISIONS)
+                        .enable(FunctionsComparator::NAMES)
+                        .enable(FunctionsComparator::CONST_VALUES);
+    const auto res = fc.compare(model, model_ref);
+    EXPECT_TRUE(res.valid) << res.message;
+}
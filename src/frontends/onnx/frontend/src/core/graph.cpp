@@ -4,10 +4,13 @@
 
 #include "core/graph.hpp"
 
+#include <atomic>
 #include <exception>
 #include <functional>
+#include <future>
 #include <numeric>
 #include <sstream>
+#include <thread>
 
 #include "core/node.hpp"
 #include "core/null_node.hpp"
@@ -108,6 +111,52 @@ ov::frontend::ExtensionHolder subgraph_required_extensions(
     extensions.conversions = parent_graph_extensions.conversions;
     return extensions;
 }
+
+/// Creates the Constant nodes of the initializers. The initializers stored in the external files are materialized
+/// in parallel, since their creation is dominated by reading or mapping of the files. The exception thrown by the
+/// creation of a Constant is returned in place of the node, so the caller handles them in the order of initializers.
+std::vector<std::pair<std::shared_ptr<ov::op::v0::Constant>, std::exception_ptr>> make_initializer_constants(
+    const std::vector<Tensor>& tensors) {
+    std::vector<std::pair<std::shared_ptr<ov::op::v0::Constant>, std::exception_ptr>> constants(tensors.size());
+    auto make_constant = [&](size_t idx) {
+        try {
+            constants[idx].first = tensors[idx].get_ov_constant();
+        } catch (...) {
+            constants[idx].second = std::current_exception();
+        }
+    };
+
+    std::vector<size_t> external;
+    for (size_t idx = 0; idx < tensors.size(); ++idx) {
+        if (tensors[idx].has_external_data()) {
+            external.push_back(idx);
+        } else {
+            make_constant(idx);
+        }
+    }
+
+    const auto workers = std::min<size_t>(std::max(std::thread::hardware_concurrency(), 1u), external.size());
+    if (workers <= 1) {
+        for (const auto idx : external) {
+            make_constant(idx);
+        }
+        return constants;
+    }
+    std::atomic<size_t> next{0};
+    std::vector<std::future<void>> futures;
+    futures.reserve(workers);
+    for (size_t worker = 0; worker < workers; ++worker) {
+        futures.emplace_back(std::async(std::launch::async, [&] {
+            for (auto i = next++; i < external.size(); i = next++) {
+                make_constant(external[i]);
+            }
+        }));
+    }
+    for (auto& future : futures) {
+        future.get();
+    }
+    return constants;
+}
 }  // namespace detail
 
 Graph::Graph(const std::string& model_dir,
@@ -133,24 +182,31 @@ Graph::Graph(const std::string& model_dir,
     std::map<std::string, Tensor> initializers;
 
     // Process all initializers in the graph
+    std::vector<Tensor> initializer_tensors;
     for (const auto& initializer_tensor : m_model->get_graph().initializer()) {
         if (initializer_tensor.has_name()) {
-            Tensor tensor = Tensor{initializer_tensor, m_model_dir, m_mmap_cache};
-            std::shared_ptr<ov::op::v0::Constant> ov_constant;
-            // For each initializer create a Constant node and store it in cache
+            initializer_tensors.emplace_back(initializer_tensor, m_model_dir, m_mmap_cache);
+        }
+    }
+    auto constants = detail::make_initializer_constants(initializer_tensors);
+    for (size_t idx = 0; idx < initializer_tensors.size(); ++idx) {
+        const auto& tensor = initializer_tensors[idx];
+        std::shared_ptr<ov::op::v0::Constant> ov_constant = std::move(constants[idx].first);
+        // For each initializer create a Constant node and store it in cache
+        if (constants[idx].second) {
             try {
-                ov_constant = tensor.get_ov_constant();
+                std::rethrow_exception(constants[idx].second);
             } catch (const error::invalid_external_data&) {
                 // invalid external data makes initializers creation impossible
                 throw;
             } catch (const ov::Exception&) {
                 ov_constant = ov::frontend::onnx::common::make_failsafe_constant(tensor.get_ov_type());
             }
-
-            initializers.emplace(initializer_tensor.name(), tensor);
-            ov_constant->get_output_tensor(0).set_names({initializer_tensor.name()});
-            m_cache->emplace_node(initializer_tensor.name(), std::move(ov_constant));
         }
+
+        initializers.emplace(tensor.get_name(), tensor);
+        ov_constant->get_output_tensor(0).set_names({tensor.get_name()});
+        m_cache->emplace_node(tensor.get_name(), std::move(ov_constant));
     }
 
     // Process all ONNX graph inputs, convert them to OV nodes and store in cache
@@ -188,12 +188,12 @@ public:
 
     std::shared_ptr<ov::op::v0::Constant> get_ov_constant() const;
 
-private:
     bool has_external_data() const {
         return m_tensor_proto->has_data_location() &&
                m_tensor_proto->data_location() == TensorProto_DataLocation::TensorProto_DataLocation_EXTERNAL;
     }
 
+private:
     template <typename T>
     std::vector<T> get_external_data() const {
         const auto ext_data = detail::TensorExternalData(*m_tensor_proto);
@@ -320,8 +320,7 @@ ONNXModelEditor::ONNXModelEditor(const std::string& model_path,
                                  const bool enable_mmap,
                                  frontend::ExtensionHolder extensions)
     : m_model_path{model_path},
-      m_mmap_cache{enable_mmap ? std::make_shared<std::map<std::string, std::shared_ptr<ov::MappedMemory>>>()
-                               : nullptr},
+      m_mmap_cache{enable_mmap ? std::make_shared<ov::frontend::onnx::detail::MappedMemoryCache>() : nullptr},
       m_extensions{std::move(extensions)},
       m_pimpl{new ONNXModelEditor::Impl{model_path}, [](Impl* impl) {
                   delete impl;
@@ -333,8 +332,7 @@ ONNXModelEditor::ONNXModelEditor(const std::wstring& model_path,
                                  frontend::ExtensionHolder extensions)
     : m_extensions{std::move(extensions)},
       m_model_path{ov::util::wstring_to_string(model_path)},
-      m_mmap_cache{enable_mmap ? std::make_shared<std::map<std::string, std::shared_ptr<ov::MappedMemory>>>()
-                               : nullptr},
+      m_mmap_cache{enable_mmap ? std::make_shared<ov::frontend::onnx::detail::MappedMemoryCache>() : nullptr},
       m_pimpl{new ONNXModelEditor::Impl{model_path}, [](Impl* impl) {
                   delete impl;
               }} {}
@@ -345,8 +343,7 @@ ONNXModelEditor::ONNXModelEditor(std::istream& model_stream,
                                  const bool enable_mmap,
                                  frontend::ExtensionHolder extensions)
     : m_model_path{model_path},
-      m_mmap_cache{enable_mmap ? std::make_shared<std::map<std::string, std::shared_ptr<ov::MappedMemory>>>()
-                               : nullptr},
+      m_mmap_cache{enable_mmap ? std::make_shared<ov::frontend::onnx::detail::MappedMemoryCache>() : nullptr},
       m_extensions{std::move(extensions)},
       m_pimpl{new ONNXModelEditor::Impl{model_stream}, [](Impl* impl) {
                   delete impl;
@@ -34,27 +34,31 @@ TensorExternalData::TensorExternalData(const TensorProto& tensor) {
 #endif
 }
 
-Buffer<ov::MappedMemory> TensorExternalData::load_external_mmap_data(const std::string& model_dir,
-                                                                     MappedMemoryHandles cache) const {
-    const auto full_path = ov::util::get_absolute_file_path(ov::util::path_join({model_dir, m_data_location}).string());
-    const int64_t file_size = ov::util::file_size(full_path);
-    if (file_size <= 0 || m_offset + m_data_length > static_cast<uint64_t>(file_size)) {
-        throw error::invalid_external_data{*this};
+std::shared_ptr<ov::MappedMemory> MappedMemoryCache::get(const std::string& full_path) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto found = m_mapped_files.find(full_path);
+    if (found != m_mapped_files.end()) {
+        return found->second;
     }
-    auto cached_mapped_memory = cache->find(full_path);
     std::shared_ptr<ov::MappedMemory> mapped_memory;
-    if (cached_mapped_memory != cache->end()) {
-        mapped_memory = cached_mapped_memory->second;
-    } else {
+    if (ov::util::file_size(full_path) > 0) {
         mapped_memory = ov::load_mmap_object(full_path);
-        (*cache)[full_path] = mapped_memory;
     }
-    if (m_data_length > mapped_memory->size() || mapped_memory->size() == 0) {
+    m_mapped_files.emplace(full_path, mapped_memory);
+    return mapped_memory;
+}
+
+Buffer<ov::MappedMemory> TensorExternalData::load_external_mmap_data(const std::string& model_dir,
+                                                                     MappedMemoryHandles cache) const {
+    const auto full_path = ov::util::get_absolute_file_path(ov::util::path_join({model_dir, m_data_location}).string());
+    // the size of the mapping is the size of the file, so the file is queried only once per model
+    const auto mapped_memory = cache->get(full_path);
+    if (!mapped_memory || mapped_memory->size() == 0 || m_offset + m_data_length > mapped_memory->size()) {
         throw error::invalid_external_data{*this};
     }
     return std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::MappedMemory>>>(
         mapped_memory->data() + m_offset,
-        m_data_length > 0 ? m_data_length : static_cast<uint64_t>(file_size) - m_offset,
+        m_data_length > 0 ? m_data_length : static_cast<uint64_t>(mapped_memory->size()) - m_offset,
         mapped_memory);
 }
 
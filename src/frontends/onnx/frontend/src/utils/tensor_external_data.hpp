@@ -6,6 +6,11 @@
 
 #include <onnx/onnx_pb.h>
 
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
 #include "openvino/runtime/aligned_buffer.hpp"
 #include "openvino/runtime/shared_buffer.hpp"
 #include "openvino/util/mmap_object.hpp"
@@ -17,7 +22,26 @@ namespace detail {
 using ::ONNX_NAMESPACE::TensorProto;
 template <class T>
 using Buffer = std::shared_ptr<ov::SharedBuffer<std::shared_ptr<T>>>;
-using MappedMemoryHandles = std::shared_ptr<std::map<std::string, std::shared_ptr<ov::MappedMemory>>>;
+
+/// \brief  Mapped external data files shared by all the initializers of the model
+///
+/// \note   Every file is mapped once and is kept mapped while any constant refers to it, the pages are read from the
+///         disk only when the data is accessed. The cache is safe to be used from several threads.
+class MappedMemoryCache {
+public:
+    /// \brief      Returns the mapping of the file, the file is mapped on the first request
+    ///
+    /// \param      full_path  Absolute path to the file
+    ///
+    /// \return     Mapped memory or nullptr if the file is empty or does not exist
+    std::shared_ptr<ov::MappedMemory> get(const std::string& full_path);
+
+private:
+    std::mutex m_mutex;
+    std::map<std::string, std::shared_ptr<ov::MappedMemory>> m_mapped_files;
+};
+using MappedMemoryHandles = std::shared_ptr<MappedMemoryCache>;
+
 /// \brief  Helper class used to load tensor data from external files
 class TensorExternalData {
 public:
@@ -176,6 +176,24 @@ TEST_P(OnnxFeMmapFixture, onnx_external_two_tensors_data_in_the_same_file) {
     test_case.run();
 }
 
+TEST_P(OnnxFeMmapFixture, onnx_external_multiple_tensors_data_in_the_same_file) {
+    // the initializers are materialized concurrently and share the single mapping of the file
+    const auto path = test::utils::getModelFromTestModelZoo(
+        string(TEST_ONNX_MODELS_DIRNAME) + "external_data/external_data_multiple_tensors_in_the_same_file.onnx");
+    Core core;
+    core.set_property(enable_mmap(GetParam()));
+    const auto model = core.read_model(path);
+    auto test_case = test::TestCase(model);
+    // initializers: {3, 2, 1} at 0, {1, 2, 3} at 4096, {2, 1, 0} at 4, {1, 0, 0} at 8
+    test_case.add_input<int32_t>({10, 20, 30});
+
+    test_case.add_expected_output<int32_t>({13, 22, 31});
+    test_case.add_expected_output<int32_t>({11, 22, 33});
+    test_case.add_expected_output<int32_t>({12, 21, 30});
+    test_case.add_expected_output<int32_t>({11, 20, 30});
+    test_case.run();
+}
+
 TEST_P(OnnxFeMmapFixture, onnx_external_invalid_external_data_exception) {
     try {
         const auto path = test::utils::getModelFromTestModelZoo(string(TEST_ONNX_MODELS_DIRNAME) +
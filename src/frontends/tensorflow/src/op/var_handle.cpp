@@ -9,6 +9,7 @@
 #include "openvino/frontend/tensorflow/variable.hpp"
 #include "openvino/op/constant.hpp"
 #include "openvino/op/reshape.hpp"
+#include "openvino/runtime/aligned_buffer.hpp"
 #include "openvino/runtime/shared_buffer.hpp"
 #include "openvino/util/mmap_object.hpp"
 #include "ov_tensorflow/tensor_bundle.pb.h"
@@ -52,15 +53,25 @@ static std::shared_ptr<ov::Node> read_variable(std::shared_ptr<VariablesIndex> v
                                                                               entry.size(),
                                                                               mapped_memory));
     } else {
-        std::vector<T> var_data;
-        var_data.resize(size);
-        auto fs = var_index->get_data_file(entry.shard_id());
-        if (!fs.get()) {
-            TENSORFLOW_OP_VALIDATION(node, var_index, "[TensorFlow Frontend] Internal error: Cannot get shard file.");
+        // the data read in advance is shared with the constant without copying
+        auto var_data = var_index->get_prefetched_data(entry.shard_id(), entry.offset(), entry.size());
+        if (!var_data) {
+            auto fs = var_index->get_data_file(entry.shard_id());
+            if (!fs.get()) {
+                TENSORFLOW_OP_VALIDATION(node,
+                                         var_index,
+                                         "[TensorFlow Frontend] Internal error: Cannot get shard file.");
+            }
+            var_data = std::make_shared<ov::AlignedBuffer>(static_cast<size_t>(entry.size()));
+            fs->seekg(entry.offset(), std::ios::beg);
+            fs->read(var_data->get_ptr<char>(), entry.size());
         }
-        fs->seekg(entry.offset(), std::ios::beg);
-        fs->read(reinterpret_cast<char*>(var_data.data()), entry.size());
-        return std::make_shared<v0::Constant>(ov_type, shape, var_data);
+        return std::make_shared<v0::Constant>(
+            ov_type,
+            shape,
+            std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::AlignedBuffer>>>(var_data->get_ptr<char>(),
+                                                                                   var_data->size(),
+                                                                                   var_data));
     }
 }
 
@@ -4,8 +4,13 @@
 
 #include <stdlib.h>
 
+#include <algorithm>
+#include <atomic>
 #include <fstream>
+#include <future>
 #include <string>
+#include <thread>
+#include <tuple>
 
 #include "checkpoint_utils.hpp"
 #include "graph_iterator_saved_model.hpp"
@@ -185,6 +190,100 @@ void VariablesIndex::read_checkpointable_object_graph() {
     }
 }
 
+void VariablesIndex::prefetch_variables(const ::tensorflow::GraphDef& graph_def) {
+    m_prefetched_data.clear();
+    if (m_mmap_enabled) {
+        return;
+    }
+
+    struct Item {
+        int32_t shard_id;
+        int64_t offset;
+        int64_t size;
+        std::shared_ptr<ov::AlignedBuffer> data;
+    };
+    std::vector<Item> items;
+    // the variables are resolved the same way as VarHandleOp and VariableV2 translators do
+    auto add_item = [&](const ::tensorflow::NodeDef& node) {
+        if (node.op() != "VarHandleOp" && node.op() != "VariableV2") {
+            return;
+        }
+        const char* entry_data = nullptr;
+        size_t entry_size = 0;
+        if (!get_mapped_variable(node.name(), &entry_data, &entry_size) &&
+            !get_variable(node.name(), &entry_data, &entry_size)) {
+            return;
+        }
+        ::tensorflow::BundleEntryProto entry{};
+        if (!entry.ParseFromArray(entry_data, static_cast<int>(entry_size)) || !entry.slices().empty() ||
+            entry.size() <= 0 || m_data_files.count(entry.shard_id()) == 0) {
+            return;
+        }
+        items.push_back({entry.shard_id(), entry.offset(), entry.size(), nullptr});
+    };
+    for (const auto& node : graph_def.node()) {
+        add_item(node);
+    }
+    for (const auto& function : graph_def.library().function()) {
+        for (const auto& node : function.node_def()) {
+            add_item(node);
+        }
+    }
+    if (items.empty()) {
+        return;
+    }
+    // the variables of a shard are read in the order of their placement in the file, a variable referenced by several
+    // nodes is read once
+    std::sort(items.begin(), items.end(), [](const Item& lhs, const Item& rhs) {
+        return std::tie(lhs.shard_id, lhs.offset) < std::tie(rhs.shard_id, rhs.offset);
+    });
+    items.erase(std::unique(items.begin(),
+                            items.end(),
+                            [](const Item& lhs, const Item& rhs) {
+                                return lhs.shard_id == rhs.shard_id && lhs.offset == rhs.offset;
+                            }),
+                items.end());
+
+    const auto workers = std::min<size_t>(std::max(std::thread::hardware_concurrency(), 1u), items.size());
+    std::atomic<size_t> next{0};
+    auto read_items = [&] {
+        std::map<int32_t, std::ifstream> streams;
+        for (auto i = next++; i < items.size(); i = next++) {
+            auto& item = items[i];
+            auto stream = streams.find(item.shard_id);
+            if (stream == streams.end()) {
+                stream = streams
+                             .emplace(item.shard_id,
+                                      std::ifstream(m_data_files.at(item.shard_id).path,
+                                                    std::ifstream::in | std::ifstream::binary))
+                             .first;
+            }
+            auto& fs = stream->second;
+            fs.clear();
+            fs.seekg(item.offset, std::ios::beg);
+            auto data = std::make_shared<ov::AlignedBuffer>(static_cast<size_t>(item.size));
+            fs.read(data->get_ptr<char>(), item.size);
+            if (fs.gcount() == item.size) {
+                item.data = std::move(data);
+            }
+        }
+    };
+    std::vector<std::future<void>> futures;
+    for (size_t worker = 1; worker < workers; ++worker) {
+        futures.emplace_back(std::async(std::launch::async, read_items));
+    }
+    read_items();
+    for (auto& future : futures) {
+        future.get();
+    }
+
+    for (auto& item : items) {
+        if (item.data) {
+            m_prefetched_data[{item.shard_id, item.offset}] = std::move(item.data);
+        }
+    }
+}
+
 bool VariablesIndex::read_variables(std::ifstream& vi_stream, const std::string& path, const bool is_saved_model) {
     m_variables_index.clear();
     read_variables_index(vi_stream, m_variables_index);
@@ -199,6 +298,7 @@ bool VariablesIndex::read_variables(std::ifstream& vi_stream, const std::string&
         } else {
             fullPath = path + "." + suffix.data();
         }
+        m_data_files[shard].path = ov::util::Path(fullPath);
         if (m_mmap_enabled) {
             m_data_files[shard].mmap = load_mmap_object(fullPath);
             FRONT_END_GENERAL_CHECK(m_data_files[shard].mmap->data(), "Variable index data cannot be mapped");
@@ -228,6 +328,7 @@ bool VariablesIndex::read_variables(std::ifstream& vi_stream, const std::wstring
         } else {
             fullPath = path + L"." + suffix.data();
         }
+        m_data_files[shard].path = ov::util::Path(fullPath);
         if (m_mmap_enabled) {
             m_data_files[shard].mmap = load_mmap_object(fullPath);
             FRONT_END_GENERAL_CHECK(m_data_files[shard].mmap->data(), "Variable index data cannot be mapped");
@@ -8,6 +8,7 @@
 
 #include "graph_iterator_proto.hpp"
 #include "openvino/op/constant.hpp"
+#include "openvino/runtime/aligned_buffer.hpp"
 #include "openvino/util/file_util.hpp"
 #include "openvino/util/mmap_object.hpp"
 #include "ov_tensorflow/saved_model.pb.h"
@@ -23,6 +24,7 @@ struct VIBlock;
 struct VariableStorage {
     std::shared_ptr<std::ifstream> stream;
     std::shared_ptr<ov::MappedMemory> mmap;
+    ov::util::Path path;
 };
 
 // Stores information about variables index
@@ -39,6 +41,8 @@ class VariablesIndex {
     std::map<std::string, std::string> m_variables_map;
     // Flag shows which file storage is using
     bool m_mmap_enabled;
+    // Variables data read in advance from the data files, the key is a pair of shard_id and offset in the shard
+    std::map<std::pair<int32_t, int64_t>, std::shared_ptr<ov::AlignedBuffer>> m_prefetched_data;
 
 public:
     VariablesIndex(bool mmap_enabled = false) : m_mmap_enabled(mmap_enabled) {}
@@ -122,6 +126,30 @@ public:
         return result != m_data_files.end() ? result->second.mmap : nullptr;
     }
 
+    /// \brief Hands over data of a variable which was read in advance from the data file, the index doesn't keep it
+    /// afterwards
+    /// \param shard_id Requested shard_id
+    /// \param offset Offset of the variable in the shard
+    /// \param size Size of the variable
+    /// \returns Valid shared_ptr with the data or nullptr if the variable wasn't read in advance
+    std::shared_ptr<ov::AlignedBuffer> get_prefetched_data(const int32_t shard_id,
+                                                           const int64_t offset,
+                                                           const int64_t size) {
+        auto result = m_prefetched_data.find({shard_id, offset});
+        if (result == m_prefetched_data.end() || static_cast<int64_t>(result->second->size()) != size) {
+            return nullptr;
+        }
+        auto data = std::move(result->second);
+        m_prefetched_data.erase(result);
+        return data;
+    }
+
+    /// \brief Reads data of the variables referenced by VarHandleOp and VariableV2 nodes of the graph in parallel,
+    /// every thread uses its own file streams. Used if mmap is disabled, a variable which cannot be read is skipped
+    /// and is read on demand. Unused variables, like optimizer slots, aren't read.
+    /// \param graph_def Graph which variables are going to be converted
+    void prefetch_variables(const ::tensorflow::GraphDef& graph_def);
+
     /// \brief Adds variable mapping to the variables map
     /// \param var_name Variable full name (from .index file)
     /// \param map_name Mapped name
@@ -168,6 +168,21 @@ TEST_F(FrontEndConversionWithReferenceTestsF, SavedModelMMAPCompare) {
     { model_ref = convert_model("saved_model_variables", nullptr, {}, {}, {}, {}, {}, true); }
 }
 
+TEST_F(FrontEndConversionWithReferenceTestsF, SavedModelUnusedVariablesWithoutMMAP) {
+    // the variables read in advance with mmap disabled must keep their values, the unused one isn't read
+    { model = convert_model("saved_model_unused_variables", nullptr, {}, {}, {}, {}, {}, true); }
+    {
+        // create a reference graph
+        auto x = make_shared<v0::Parameter>(element::f32, Shape{2, 3});
+        auto var1 = make_shared<v0::Constant>(element::f32, Shape{3}, vector<float>{1, 2, 3});
+        auto var2 = make_shared<v0::Constant>(element::f32, Shape{2, 1}, vector<float>{4, 5});
+        auto multiply = make_shared<v1::Multiply>(x, var1);
+        auto add = make_shared<v1::Add>(multiply, var2);
+
+        model_ref = make_shared<Model>(OutputVector{add}, ParameterVector{x});
+    }
+}
+
 TEST_F(FrontEndConversionWithReferenceTestsF, SavedModelWithNumericalNames) {
     comparator.enable(FunctionsComparator::CmpValues::TENSOR_NAMES);
     // The test aims to check that model with only numerical names for operation
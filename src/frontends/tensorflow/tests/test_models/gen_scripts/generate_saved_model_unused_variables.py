@@ -0,0 +1,21 @@
+# Copyright (C) 2025 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+
+import os
+import sys
+
+import tensorflow as tf
+
+# Create the graph and model, the checkpoint keeps a variable which isn't used by the function
+class MulAddVariables(tf.Module):
+  def __init__(self):
+    super(MulAddVariables, self).__init__()
+    self.var1 = tf.Variable([1.0, 2.0, 3.0])
+    self.var2 = tf.Variable([[4.0], [5.0]])
+    self.unused = tf.Variable(tf.ones([16, 16]))
+  @tf.function(input_signature=[tf.TensorSpec([2, 3], tf.float32)])
+  def __call__(self, x):
+    return {'test_output_name': x * self.var1 + self.var2}
+
+module = MulAddVariables()
+tf.saved_model.save(module, os.path.join(sys.argv[1], "saved_model_unused_variables"))
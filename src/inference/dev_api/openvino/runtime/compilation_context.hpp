@@ -20,9 +20,27 @@ class OPENVINO_RUNTIME_API ModelCache {
 public:
     static std::string calculate_file_info(const std::string& filePath);
 
+    /**
+     * @brief Calculates a digest of the model file content. For IR the weights file is hashed as well.
+     * The digest of each file is memoized by the file identity (device, inode, size and modification time), so
+     * repeated calls for unchanged files don't read them again.
+     * @param modelPath Path to the model file
+     * @return Digest of the model files content
+     */
+    static std::string calculate_file_content_info(const std::string& modelPath);
+
     static std::string compute_hash(const std::shared_ptr<const ov::Model>& model, const ov::AnyMap& compileOptions);
 
     static std::string compute_hash(const std::string& modelName, const ov::AnyMap& compileOptions);
+
+    /**
+     * @brief Computes the cache key of the model file by its content rather than by its path, so the key stays
+     * valid for the model copies and changes once the model is redeployed.
+     * @param modelPath Path to the model file
+     * @param compileOptions Compile options affecting the compiled blob
+     * @return Cache key
+     */
+    static std::string compute_content_hash(const std::string& modelPath, const ov::AnyMap& compileOptions);
     static std::string compute_hash(const std::string& modeStr,
                                     const ov::Tensor& data,
                                     const ov::AnyMap& compileOptions);
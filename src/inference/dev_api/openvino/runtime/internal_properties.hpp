@@ -37,6 +37,21 @@ static constexpr Property<std::vector<PropertyName>, PropertyMutability::RO> cac
  */
 static constexpr Property<bool, PropertyMutability::RO> caching_with_mmap{"CACHING_WITH_MMAP"};
 
+/**
+ * @brief Read-write core property to compute the model cache key of compile_model(model_path) from the content of
+ * the model files instead of the model path. The content digest is memoized by the file identity and modification
+ * time, so warm starts don't read the files again.
+ * @ingroup ov_dev_api_plugin_api
+ */
+static constexpr Property<bool, PropertyMutability::RW> cache_hash_model_content{"CACHE_HASH_MODEL_CONTENT"};
+
+/**
+ * @brief Read-write core property to limit the total size of the model cache directory in bytes. Once the limit is
+ * exceeded, the least recently used compiled blobs are removed. 0 (default) means unlimited.
+ * @ingroup ov_dev_api_plugin_api
+ */
+static constexpr Property<uint64_t, PropertyMutability::RW> cache_size_limit{"CACHE_SIZE_LIMIT"};
+
 /**
  * @brief Allow to create exclusive_async_requests with one executor
  * @ingroup ov_dev_api_plugin_api
@@ -12,7 +12,9 @@
 #include <stdint.h>
 
 #include <algorithm>
+#include <functional>
 #include <map>
+#include <utility>
 #include <vector>
 
 #include "openvino/core/except.hpp"
@@ -110,7 +112,22 @@ public:
         return ts_f - rm_ts_f;
     }
 
-    explicit MemorySolver(const std::vector<Box>& boxes) : _boxes(boxes) {
+    /** @brief Algorithm used to place the boxes on the memory axis */
+    enum class Planner {
+        /** Boxes are put from the biggest one, each box is lifted up while it intersects already placed ones */
+        GREEDY_POP_UP,
+        /**
+         * Boxes are put from the biggest one, each box takes the smallest gap between the already placed boxes
+         * alive at the same time. The placed boxes are looked up in a segment tree over the execution order.
+         */
+        BEST_FIT,
+        /** Several orders of boxes are tried with both planners above, the solution with minimal size is kept */
+        BEST_OF,
+    };
+
+    explicit MemorySolver(const std::vector<Box>& boxes, Planner planner = Planner::GREEDY_POP_UP)
+        : _boxes(boxes),
+          _planner(planner) {
         // TODO: add validation of data correctness:
         // 1. Box.start >= 0 and Box.finish >= -1
         // 2. Box.finish >= Box.start (except Box.finish == -1)
@@ -135,19 +152,93 @@ public:
      */
     int64_t solve() {
         max_top_depth();  // at first make sure that we no need more for boxes sorted by box.start
+        _offsets.clear();
+        switch (_planner) {
+        case Planner::GREEDY_POP_UP:
+            return solve_greedy_pop_up(_offsets);
+        case Planner::BEST_FIT:
+            return solve_best_fit(by_size, _offsets);
+        case Planner::BEST_OF: {
+            int64_t min_required = solve_best_fit(by_size, _offsets);
+            std::map<int64_t, int64_t> offsets;
+            auto try_solution = [&](int64_t required) {
+                if (required < min_required) {
+                    min_required = required;
+                    _offsets.swap(offsets);
+                }
+                offsets.clear();
+            };
+            try_solution(solve_best_fit(by_area, offsets));
+            try_solution(solve_best_fit(by_lifetime, offsets));
+            try_solution(solve_greedy_pop_up(offsets));
+            return min_required;
+        }
+        default:
+            OPENVINO_THROW("Unsupported memory solver planner");
+        }
+    }
+
+    /** Provides calculated offset for specified box id */
+    int64_t get_offset(int id) const {
+        auto res = _offsets.find(id);
+        if (res == _offsets.end())
+            OPENVINO_THROW("There are no box for provided ID");
+        return res->second;
+    }
+
+    /** Additional info. Max sum of box sizes required for any time stamp. */
+    int64_t max_depth() {
+        if (_depth == -1)
+            calc_depth();
+        return _depth;
+    }
+    /** Additional info. Max num of boxes required for any time stamp. */
+    int64_t max_top_depth() {
+        if (_top_depth == -1)
+            calc_depth();
+        return _top_depth;
+    }
+
+private:
+    std::vector<Box> _boxes;
+    Planner _planner;
+    std::map<int64_t, int64_t> _offsets;
+    int64_t _top_depth = -1;
+    int64_t _depth = -1;
+    int _time_duration = -1;
+
+    // Orders of boxes for the best fit planner, the ties are broken by the start and id to get a stable result
+    static bool by_size(const Box& l, const Box& r) {
+        return l.size > r.size || (l.size == r.size && (l.start < r.start || (l.start == r.start && l.id < r.id)));
+    }
+
+    static bool by_area(const Box& l, const Box& r) {
+        const auto l_area = l.size * (l.finish - l.start + 1);
+        const auto r_area = r.size * (r.finish - r.start + 1);
+        return l_area > r_area || (l_area == r_area && by_size(l, r));
+    }
+
+    static bool by_lifetime(const Box& l, const Box& r) {
+        const auto l_lifetime = l.finish - l.start;
+        const auto r_lifetime = r.finish - r.start;
+        return l_lifetime > r_lifetime || (l_lifetime == r_lifetime && by_size(l, r));
+    }
+
+    int64_t solve_greedy_pop_up(std::map<int64_t, int64_t>& offsets) {
+        auto boxes = _boxes;
         std::vector<std::vector<const Box*>> time_slots(_time_duration);
         for (auto& slot : time_slots)
             slot.reserve(_top_depth);  // 2D array [_time_duration][_top_depth]
 
         // Sort be box size. First is biggest
         // Comment this line to check other order of box putting
-        std::sort(_boxes.begin(), _boxes.end(), [](const Box& l, const Box& r) {
+        std::sort(boxes.begin(), boxes.end(), [](const Box& l, const Box& r) {
             return l.size > r.size;
         });
 
         int64_t _min_required = 0;
 
-        for (Box& box : _boxes) {
+        for (Box& box : boxes) {
             // start from bottom and will lift it up if intersect with other present
             int64_t id = box.id;
             box.id = 0;  // id will be used as a temp offset storage
@@ -170,39 +261,84 @@ public:
 
             // store the max top bound for each box
             _min_required = std::max(_min_required, box.id + box.size);
-            _offsets[id] = box.id;  // TODO: move to constructor (use .insert instead of [])
+            offsets[id] = box.id;
         }
 
         return _min_required;
     }
 
-    /** Provides calculated offset for specified box id */
-    int64_t get_offset(int id) const {
-        auto res = _offsets.find(id);
-        if (res == _offsets.end())
-            OPENVINO_THROW("There are no box for provided ID");
-        return res->second;
-    }
+    template <class Order>
+    int64_t solve_best_fit(const Order& order, std::map<int64_t, int64_t>& offsets) const {
+        std::vector<Box> boxes = _boxes;
+        std::sort(boxes.begin(), boxes.end(), order);
+
+        // Segment tree over the time slots. A placed box is stored in the nodes covering its live time, so any node
+        // intersecting the live time of a new box stores only the boxes intersecting it in time.
+        const int time_duration = std::max(_time_duration, 1);
+        std::vector<std::vector<size_t>> tree(4 * static_cast<size_t>(time_duration));
+        std::vector<int64_t> placed_offsets(boxes.size());
+        std::vector<size_t> visited(boxes.size(), boxes.size());
+        std::vector<std::pair<int64_t, int64_t>> neighbours;  // {offset, size} of the boxes alive together
+
+        std::function<void(size_t, int, int, const Box&, size_t)> insert =
+            [&](size_t node, int begin, int end, const Box& box, size_t idx) {
+                if (box.start <= begin && end <= box.finish) {
+                    tree[node].push_back(idx);
+                    return;
+                }
+                const int middle = begin + (end - begin) / 2;
+                if (box.start <= middle)
+                    insert(2 * node + 1, begin, middle, box, idx);
+                if (box.finish > middle)
+                    insert(2 * node + 2, middle + 1, end, box, idx);
+            };
+        std::function<void(size_t, int, int, const Box&, size_t)> collect =
+            [&](size_t node, int begin, int end, const Box& box, size_t current) {
+                if (box.finish < begin || end < box.start)
+                    return;
+                for (auto idx : tree[node]) {
+                    if (visited[idx] != current) {
+                        visited[idx] = current;
+                        neighbours.emplace_back(placed_offsets[idx], boxes[idx].size);
+                    }
+                }
+                if (begin == end)
+                    return;
+                const int middle = begin + (end - begin) / 2;
+                collect(2 * node + 1, begin, middle, box, current);
+                collect(2 * node + 2, middle + 1, end, box, current);
+            };
+
+        int64_t min_required = 0;
+        for (size_t i = 0; i < boxes.size(); i++) {
+            const Box& box = boxes[i];
+            neighbours.clear();
+            collect(0, 0, time_duration - 1, box, i);
+            std::sort(neighbours.begin(), neighbours.end());
+
+            // take the smallest gap the box fits in, or put it on top of the neighbours
+            int64_t top = 0;
+            int64_t best_offset = -1;
+            int64_t best_gap = 0;
+            for (const auto& neighbour : neighbours) {
+                const auto gap = neighbour.first - top;
+                if (gap >= box.size && (best_offset == -1 || gap < best_gap)) {
+                    best_offset = top;
+                    best_gap = gap;
+                }
+                top = std::max(top, neighbour.first + neighbour.second);
+            }
+            if (best_offset == -1)
+                best_offset = top;
 
-    /** Additional info. Max sum of box sizes required for any time stamp. */
-    int64_t max_depth() {
-        if (_depth == -1)
-            calc_depth();
-        return _depth;
-    }
-    /** Additional info. Max num of boxes required for any time stamp. */
-    int64_t max_top_depth() {
-        if (_top_depth == -1)
-            calc_depth();
-        return _top_depth;
-    }
+            placed_offsets[i] = best_offset;
+            insert(0, 0, time_duration - 1, box, i);
+            min_required = std::max(min_required, best_offset + box.size);
+            offsets[box.id] = best_offset;
+        }
 
-private:
-    std::vector<Box> _boxes;
-    std::map<int64_t, int64_t> _offsets;
-    int64_t _top_depth = -1;
-    int64_t _depth = -1;
-    int _time_duration = -1;
+        return min_required;
+    }
 
     void calc_depth() {
         int64_t top_depth = 0;
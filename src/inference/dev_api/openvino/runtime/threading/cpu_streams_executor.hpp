@@ -9,6 +9,8 @@
 
 #pragma once
 
+#include <cstdint>
+#include <map>
 #include <memory>
 #include <string>
 
@@ -23,7 +25,8 @@ namespace threading {
  * @ingroup ov_dev_api_threading
  * @brief CPU Streams executor implementation. The executor splits the CPU into groups of threads,
  *        that can be pinned to cores or NUMA nodes.
- *        It uses custom threads to pull tasks from single queue.
+ *        It uses custom threads to pull tasks from the queues of three priority classes. The tasks scheduled by the
+ *        executor threads are kept in the local queues of the threads and can be stolen by the idle threads.
  */
 class OPENVINO_RUNTIME_API CPUStreamsExecutor : public IStreamsExecutor {
 public:
@@ -32,6 +35,15 @@ public:
      */
     using Ptr = std::shared_ptr<CPUStreamsExecutor>;
 
+    /**
+     * @brief Time the tasks of a priority class spent in the queues before the execution
+     */
+    struct WaitStatistics {
+        uint64_t tasks = 0;          //!< Number of the executed tasks
+        uint64_t total_wait_us = 0;  //!< Total waiting time in microseconds
+        uint64_t max_wait_us = 0;    //!< Maximum waiting time in microseconds
+    };
+
     /**
      * @brief Constructor
      * @param config Stream executor parameters
@@ -45,8 +57,16 @@ public:
 
     void run(Task task) override;
 
+    void run_with_priority(Task task, ov::hint::Priority priority) override;
+
     void execute(Task task) override;
 
+    /**
+     * @brief Returns the waiting time statistics of the tasks started by run() and run_with_priority()
+     * @return Statistics per priority class, run() schedules the tasks with ov::hint::Priority::MEDIUM
+     */
+    std::map<ov::hint::Priority, WaitStatistics> get_wait_statistics() const;
+
     int get_stream_id() override;
 
     int get_streams_num() override;
@@ -289,6 +289,16 @@ public:
      * @param task A task to start
      */
     virtual void execute(Task task) = 0;
+
+    /**
+     * @brief Starts the task execution asynchronously ahead of the queued tasks of lower priorities
+     * @note The default implementation ignores the priority and calls run()
+     * @param task A task to start
+     * @param priority A priority class of the task
+     */
+    virtual void run_with_priority(Task task, ov::hint::Priority priority) {
+        run(std::move(task));
+    }
 };
 
 static std::mutex _streams_executor_mutex;
@@ -5,10 +5,13 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #pragma once
 
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
+#include <memory>
 #include <mutex>
 #include <queue>
+#include <thread>
 #include <type_traits>
 
 #include "openvino/core/parallel.hpp"
@@ -47,6 +50,134 @@ protected:
     std::queue<T> _queue;
     std::mutex _mutex;
 };
+
+/**
+ * @brief Bounded multi-producer multi-consumer queue on top of a ring buffer which does not use locks.
+ * Every cell of the ring keeps a sequence number which tells whether the cell is ready to be written by the producer
+ * or read by the consumer of the current lap, so producers and consumers synchronize on separate cells and only
+ * contend on the enqueue and dequeue positions, which are kept in separate cache lines.
+ * The queue is full or empty with respect to the reserved positions: an operation that finds its cell still accessed
+ * by a peer which has already reserved it waits for the peer to finish instead of failing, so size() reports the
+ * number of values that can be popped.
+ * @note set_capacity() is not thread safe and drops the content of the queue, it is expected to be called before
+ * the queue is shared between threads.
+ */
+template <typename T>
+class ThreadSafeBoundedMPMCQueue {
+public:
+    ThreadSafeBoundedMPMCQueue() = default;
+    explicit ThreadSafeBoundedMPMCQueue(std::size_t capacity) {
+        set_capacity(capacity);
+    }
+    ThreadSafeBoundedMPMCQueue(const ThreadSafeBoundedMPMCQueue&) = delete;
+    ThreadSafeBoundedMPMCQueue& operator=(const ThreadSafeBoundedMPMCQueue&) = delete;
+
+    bool try_push(T value) {
+        if (!_cells) {
+            return false;
+        }
+        std::size_t pos = _enqueue_pos.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = _cells[pos & _mask];
+            const auto dif = static_cast<std::ptrdiff_t>(cell.sequence.load(std::memory_order_acquire) - pos);
+            if (dif == 0) {
+                if (_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell.value = std::move(value);
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (dif < 0) {
+                // the cell keeps the value of the previous lap: either the queue is full or a consumer is reading it
+                const auto used = static_cast<std::ptrdiff_t>(pos - _dequeue_pos.load(std::memory_order_acquire));
+                if (used >= static_cast<std::ptrdiff_t>(_mask + 1)) {
+                    return false;
+                }
+                std::this_thread::yield();
+                pos = _enqueue_pos.load(std::memory_order_relaxed);
+            } else {
+                pos = _enqueue_pos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool try_pop(T& value) {
+        if (!_cells) {
+            return false;
+        }
+        std::size_t pos = _dequeue_pos.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = _cells[pos & _mask];
+            const auto dif = static_cast<std::ptrdiff_t>(cell.sequence.load(std::memory_order_acquire) - (pos + 1));
+            if (dif == 0) {
+                if (_dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    value = std::move(cell.value);
+                    cell.sequence.store(pos + _mask + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (dif < 0) {
+                // the cell is not written yet: either the queue is empty or a producer is writing it
+                if (static_cast<std::ptrdiff_t>(_enqueue_pos.load(std::memory_order_acquire) - pos) <= 0) {
+                    return false;
+                }
+                std::this_thread::yield();
+                pos = _dequeue_pos.load(std::memory_order_relaxed);
+            } else {
+                pos = _dequeue_pos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief Returns the number of values in the queue, the value is exact only if there are no concurrent operations
+     */
+    size_t size() const {
+        // the dequeue position never overtakes the enqueue one, so read it first
+        const auto dequeue_pos = _dequeue_pos.load(std::memory_order_acquire);
+        const auto enqueue_pos = _enqueue_pos.load(std::memory_order_acquire);
+        return std::min(enqueue_pos - dequeue_pos, capacity());
+    }
+
+    /**
+     * @brief Returns the capacity of the queue, which is the requested one rounded up to a power of two
+     */
+    size_t capacity() const {
+        return _cells ? _mask + 1 : 0;
+    }
+
+    void set_capacity(std::size_t newCapacity) {
+        if (0 == newCapacity) {
+            _cells.reset();
+            _mask = 0;
+        } else {
+            // a ring of a single cell cannot distinguish the written cell from the read one
+            std::size_t size = 2;
+            while (size < newCapacity) {
+                size *= 2;
+            }
+            _cells.reset(new Cell[size]);
+            for (std::size_t i = 0; i < size; ++i) {
+                _cells[i].sequence.store(i, std::memory_order_relaxed);
+            }
+            _mask = size - 1;
+        }
+        _enqueue_pos.store(0, std::memory_order_relaxed);
+        _dequeue_pos.store(0, std::memory_order_relaxed);
+    }
+
+protected:
+    static constexpr std::size_t cache_line_size = 64;
+
+    struct Cell {
+        std::atomic<std::size_t> sequence{0};
+        T value{};
+    };
+
+    std::unique_ptr<Cell[]> _cells;
+    std::size_t _mask = 0;
+    alignas(cache_line_size) std::atomic<std::size_t> _enqueue_pos{0};
+    alignas(cache_line_size) std::atomic<std::size_t> _dequeue_pos{0};
+};
+
 #if ((OV_THREAD == OV_THREAD_TBB) || (OV_THREAD == OV_THREAD_TBB_AUTO))
 template <typename T>
 using ThreadSafeQueue = tbb::concurrent_queue<T>;
@@ -876,6 +876,31 @@ static constexpr Property<uint32_t, PropertyMutability::RO> max_batch_size{"MAX_
  */
 static constexpr Property<uint32_t, PropertyMutability::RW> auto_batch_timeout{"AUTO_BATCH_TIMEOUT"};
 
+/**
+ * @brief Read-write property to set the latency objective (in milliseconds) for the auto-batching.
+ * When the value is non-zero, the timeout used to collect the inputs is chosen on the fly from the observed arrival
+ * rate of the requests and the execution time of the batch, so that the batch is flushed in time to meet the objective.
+ * The ov::auto_batch_timeout value is the upper bound of the adaptive timeout then. Zero (default) means the fixed
+ * ov::auto_batch_timeout is used.
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> auto_batch_latency_slo{"AUTO_BATCH_LATENCY_SLO"};
+
+/**
+ * @brief Read-only property to get the statistics of the auto-batching for the compiled model.
+ * @ingroup ov_runtime_cpp_prop_api
+ *
+ * Property returns a map of counters and estimations:
+ *  - "BATCHES_EXECUTED", "REQUESTS_BATCHED" - number of the executed batches and the requests executed in them
+ *  - "TIMEOUTS", "REQUESTS_NOT_BATCHED" - number of the partial batches flushed on the timeout and their requests
+ *  - "INTER_ARRIVAL_TIME_US" - estimated time between the arrivals of the requests (in microseconds)
+ *  - "BATCH_EXECUTION_TIME_US" - estimated execution time of the full batch (in microseconds)
+ *  - "NOT_BATCHED_EXECUTION_TIME_US" - estimated execution time of a flushed partial batch (in microseconds)
+ *  - "TIMEOUT_US" - the recently chosen timeout to collect the inputs (in microseconds)
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> auto_batch_statistics{
+    "AUTO_BATCH_STATISTICS"};
+
 /**
  * @brief Read-only property to provide a hint for a range for number of async infer requests. If device supports
  * streams, the metric provides range for number of IRs per stream.
@@ -0,0 +1,425 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cache_manager.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <filesystem>
+#include <random>
+#include <sstream>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+#include "openvino/core/parallel.hpp"
+
+#ifdef _WIN32
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/file.h>
+#    include <unistd.h>
+#endif
+
+namespace ov {
+namespace {
+constexpr const char* index_file_name = "cache.index";
+constexpr const char* index_lock_file_name = "cache.index.lock";
+constexpr const char* index_magic = "OV_CACHE_INDEX";
+constexpr int index_version = 2;
+// A temporary file which isn't modified for so long is left by a crashed or killed writer
+constexpr auto orphaned_temp_file_age = std::chrono::hours(1);
+
+// Exclusive lock of the cache index shared between the processes, it's held around load, update and store of the
+// index. The cache works without it if the lock file cannot be created, e.g. in the read-only directory.
+class IndexLock {
+public:
+    explicit IndexLock(const ov::util::Path& lock_file_name) {
+#ifdef _WIN32
+        m_handle = CreateFileW(lock_file_name.c_str(),
+                               GENERIC_READ | GENERIC_WRITE,
+                               FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                               nullptr,
+                               OPEN_ALWAYS,
+                               FILE_ATTRIBUTE_NORMAL,
+                               nullptr);
+        OVERLAPPED overlapped{};
+        if (m_handle != INVALID_HANDLE_VALUE &&
+            !LockFileEx(m_handle, LOCKFILE_EXCLUSIVE_LOCK, 0, MAXDWORD, MAXDWORD, &overlapped)) {
+            CloseHandle(m_handle);
+            m_handle = INVALID_HANDLE_VALUE;
+        }
+#else
+        m_fd = open(lock_file_name.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0666);
+        if (m_fd >= 0) {
+            int res;
+            while ((res = flock(m_fd, LOCK_EX)) != 0 && errno == EINTR) {
+            }
+            if (res != 0) {
+                close(m_fd);
+                m_fd = -1;
+            }
+        }
+#endif
+    }
+
+    ~IndexLock() {
+#ifdef _WIN32
+        if (m_handle != INVALID_HANDLE_VALUE) {
+            OVERLAPPED overlapped{};
+            UnlockFileEx(m_handle, 0, MAXDWORD, MAXDWORD, &overlapped);
+            CloseHandle(m_handle);
+        }
+#else
+        if (m_fd >= 0) {
+            // closing the descriptor releases the lock
+            close(m_fd);
+        }
+#endif
+    }
+
+    IndexLock(const IndexLock&) = delete;
+    IndexLock& operator=(const IndexLock&) = delete;
+
+private:
+#ifdef _WIN32
+    HANDLE m_handle = INVALID_HANDLE_VALUE;
+#else
+    int m_fd = -1;
+#endif
+};
+
+uint64_t process_token() {
+    static const uint64_t token = (static_cast<uint64_t>(std::random_device{}()) << 32) ^
+                                  static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+    return token;
+}
+
+// Unique suffix of the temporary files, so concurrent writers (even from different processes) don't collide
+std::string make_temp_suffix() {
+    static std::atomic<uint64_t> counter{0};
+    return "." + std::to_string(process_token()) + "_" + std::to_string(counter++) + ".tmp";
+}
+
+// Unique stamp of the saved index, the index isn't parsed again until another manager saves it
+uint64_t make_index_stamp() {
+    static std::atomic<uint64_t> counter{1};
+    return process_token() + counter++;
+}
+
+// Reads the blob by big chunks in parallel, which utilizes the fast storage much better than a single sequential
+// read of a multi-GB blob
+ov::Tensor read_blob(const ov::util::Path& blob_file_name) {
+    const auto size = static_cast<size_t>(std::filesystem::file_size(blob_file_name));
+    ov::Tensor blob(element::u8, Shape{size});
+    auto data = static_cast<char*>(blob.data());
+
+    constexpr size_t chunk_size = 64 * 1024 * 1024;
+    const size_t chunks_num = (size + chunk_size - 1) / chunk_size;
+    std::atomic<bool> read_ok{true};
+    ov::parallel_for(chunks_num, [&](size_t chunk_idx) {
+        const size_t offset = chunk_idx * chunk_size;
+        const auto bytes_to_read = static_cast<std::streamsize>(std::min(chunk_size, size - offset));
+        std::ifstream fin(blob_file_name, std::ios::binary);
+        fin.seekg(static_cast<std::streamoff>(offset));
+        fin.read(data + offset, bytes_to_read);
+        if (fin.gcount() != bytes_to_read) {
+            read_ok = false;
+        }
+    });
+    OPENVINO_ASSERT(read_ok, "Cannot read ", size, " bytes from ", blob_file_name);
+    return blob;
+}
+}  // namespace
+
+FileStorageCacheManager::FileStorageCacheManager(std::string cachePath, uint64_t sizeLimit)
+    : m_cachePath(std::move(cachePath)),
+      m_sizeLimit(sizeLimit) {
+    if (m_sizeLimit > 0) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        IndexLock index_lock(getCacheFile(index_lock_file_name));
+        load_index();
+        // the limit may be lowered since the previous run
+        evict({});
+        if (m_indexDirty) {
+            save_index();
+        }
+    }
+}
+
+FileStorageCacheManager::~FileStorageCacheManager() {
+    if (m_sizeLimit > 0 && m_indexDirty) {
+        try {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            IndexLock index_lock(getCacheFile(index_lock_file_name));
+            load_index();
+            save_index();
+        } catch (...) {
+            // the index is restored from the cache directory next time
+        }
+    }
+}
+
+uint64_t FileStorageCacheManager::get_cache_size() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_cacheSize;
+}
+
+void FileStorageCacheManager::write_cache_entry(const std::string& id, StreamWriter writer) {
+    // Fix the bug caused by pugixml, which may return unexpected results if the locale is different from "C".
+    ScopedLocale plocal_C(LC_ALL, "C");
+    const auto blob_file_name = getBlobFile(id);
+    auto temp_file_name = blob_file_name;
+    temp_file_name += make_temp_suffix();
+
+    bool written = false;
+    {
+        std::ofstream stream(temp_file_name, std::ios_base::binary | std::ofstream::out);
+        try {
+            writer(stream);
+        } catch (...) {
+            stream.close();
+            std::error_code ec;
+            std::filesystem::remove(temp_file_name, ec);
+            throw;
+        }
+        stream.close();
+        written = !stream.fail();
+    }
+
+    // rename is atomic, so the blob is either absent or complete for the readers
+    std::error_code ec;
+    if (written) {
+        std::filesystem::rename(temp_file_name, blob_file_name, ec);
+    }
+    if (!written || ec) {
+        std::filesystem::remove(temp_file_name, ec);
+        return;
+    }
+
+    if (m_sizeLimit > 0) {
+        const auto size = std::filesystem::file_size(blob_file_name, ec);
+        std::lock_guard<std::mutex> lock(m_mutex);
+        IndexLock index_lock(getCacheFile(index_lock_file_name));
+        load_index();
+        update_entry(id, ec ? 0 : static_cast<uint64_t>(size));
+        evict(id);
+        save_index();
+    }
+}
+
+void FileStorageCacheManager::read_cache_entry(const std::string& id, bool enable_mmap, StreamReader reader) {
+    // Fix the bug caused by pugixml, which may return unexpected results if the locale is different from "C".
+    ScopedLocale plocal_C(LC_ALL, "C");
+    const auto blob_file_name = getBlobFile(id);
+    if (std::filesystem::exists(blob_file_name)) {
+        auto compiled_blob = enable_mmap
+                                 ? read_tensor_data(blob_file_name, element::u8, PartialShape::dynamic(1), 0, true)
+                                 : read_blob(blob_file_name);
+        if (m_sizeLimit > 0) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            // access times are flushed to the index lazily to keep the warm start cheap
+            auto it = m_entries.find(id);
+            if (it != m_entries.end()) {
+                it->second.lastAccess = access_time();
+                m_indexDirty = true;
+            } else {
+                update_entry(id, compiled_blob.get_byte_size());
+            }
+        }
+        reader(compiled_blob);
+    } else if (m_sizeLimit > 0) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        erase_entry(id);
+    }
+}
+
+void FileStorageCacheManager::remove_cache_entry(const std::string& id) {
+    auto blobFileName = getBlobFile(id);
+
+    if (std::filesystem::exists(blobFileName)) {
+        std::ignore = std::filesystem::remove(blobFileName);
+    }
+
+    if (m_sizeLimit > 0) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        IndexLock index_lock(getCacheFile(index_lock_file_name));
+        load_index();
+        erase_entry(id);
+        if (m_indexDirty) {
+            save_index();
+        }
+    }
+}
+
+void FileStorageCacheManager::load_index() {
+    // every manager updates the index under the lock along with the blobs, so the index file is the state of the cache
+    // shared by the processes and the cache directory is scanned only if the index cannot be trusted
+    std::ifstream index(getCacheFile(index_file_name));
+    std::string line;
+    if (index.is_open() && std::getline(index, line)) {
+        std::istringstream header(line);
+        std::string magic;
+        int version = 0;
+        uint64_t stamp = 0, count = 0, total_size = 0;
+        if (header >> magic >> version >> stamp >> count >> total_size && magic == index_magic &&
+            version == index_version) {
+            if (stamp == m_indexStamp) {
+                // the index wasn't changed since this manager loaded or saved it
+                return;
+            }
+            std::unordered_map<std::string, Entry> indexed;
+            uint64_t indexed_size = 0;
+            std::string id;
+            Entry entry;
+            while (index >> id >> entry.size >> entry.lastAccess) {
+                indexed_size += entry.size;
+                indexed[id] = entry;
+            }
+            // the index truncated or otherwise damaged doesn't match its header
+            if (indexed.size() == count && indexed_size == total_size) {
+                for (auto& [indexed_id, indexed_entry] : indexed) {
+                    // the access times of this manager are flushed to the index lazily
+                    auto tracked_it = m_entries.find(indexed_id);
+                    if (tracked_it != m_entries.end()) {
+                        indexed_entry.lastAccess = std::max(indexed_entry.lastAccess, tracked_it->second.lastAccess);
+                    }
+                    m_lastAccess = std::max(m_lastAccess, indexed_entry.lastAccess);
+                }
+                m_entries = std::move(indexed);
+                m_cacheSize = total_size;
+                m_indexStamp = stamp;
+                return;
+            }
+        }
+    }
+    rebuild_index();
+}
+
+void FileStorageCacheManager::rebuild_index() {
+    // the blobs missing in the index are considered as the least recently used
+#if defined(_WIN32) && defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT)
+    const ov::util::Path cache_dir = ov::util::string_to_wstring(m_cachePath);
+#else
+    const ov::util::Path cache_dir = m_cachePath;
+#endif
+    std::unordered_map<std::string, Entry> entries;
+    uint64_t cache_size = 0;
+    const auto now = std::filesystem::file_time_type::clock::now();
+    std::error_code ec;
+    for (const auto& file : std::filesystem::directory_iterator(cache_dir, ec)) {
+        if (!file.is_regular_file(ec)) {
+            continue;
+        }
+        const auto extension = file.path().extension();
+        if (extension == ".tmp") {
+            const auto write_time = file.last_write_time(ec);
+            if (!ec && now - write_time > orphaned_temp_file_age) {
+                std::filesystem::remove(file.path(), ec);
+            }
+            continue;
+        }
+        if (extension != ".blob") {
+            continue;
+        }
+        Entry entry{static_cast<uint64_t>(file.file_size(ec)), 0};
+        if (ec) {
+            continue;
+        }
+        const auto id = file.path().stem().string();
+        // the access times of this manager are flushed to the index lazily
+        auto tracked_it = m_entries.find(id);
+        if (tracked_it != m_entries.end()) {
+            entry.lastAccess = std::max(entry.lastAccess, tracked_it->second.lastAccess);
+        }
+        m_lastAccess = std::max(m_lastAccess, entry.lastAccess);
+        cache_size += entry.size;
+        entries.emplace(id, entry);
+    }
+
+    m_entries = std::move(entries);
+    m_cacheSize = cache_size;
+    m_indexStamp = 0;
+    m_indexDirty = true;
+}
+
+void FileStorageCacheManager::save_index() {
+    const auto index_file = getCacheFile(index_file_name);
+    auto temp_file = index_file;
+    temp_file += make_temp_suffix();
+    const auto stamp = make_index_stamp();
+    {
+        std::ofstream index(temp_file);
+        index << index_magic << ' ' << index_version << ' ' << stamp << ' ' << m_entries.size() << ' ' << m_cacheSize
+              << '\n';
+        for (const auto& [id, entry] : m_entries) {
+            index << id << ' ' << entry.size << ' ' << entry.lastAccess << '\n';
+        }
+    }
+    std::error_code ec;
+    std::filesystem::rename(temp_file, index_file, ec);
+    if (ec) {
+        std::filesystem::remove(temp_file, ec);
+        return;
+    }
+    m_indexStamp = stamp;
+    m_indexDirty = false;
+}
+
+uint64_t FileStorageCacheManager::access_time() {
+    const auto now = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch())
+            .count());
+    m_lastAccess = std::max(now, m_lastAccess + 1);
+    return m_lastAccess;
+}
+
+void FileStorageCacheManager::update_entry(const std::string& id, uint64_t size) {
+    auto& entry = m_entries[id];
+    m_cacheSize = m_cacheSize - entry.size + size;
+    entry.size = size;
+    entry.lastAccess = access_time();
+    m_indexDirty = true;
+}
+
+void FileStorageCacheManager::erase_entry(const std::string& id) {
+    auto it = m_entries.find(id);
+    if (it != m_entries.end()) {
+        m_cacheSize -= it->second.size;
+        m_entries.erase(it);
+        m_indexDirty = true;
+    }
+}
+
+void FileStorageCacheManager::evict(const std::string& keepId) {
+    if (m_cacheSize <= m_sizeLimit) {
+        return;
+    }
+
+    std::vector<std::pair<uint64_t, std::string>> lru;
+    lru.reserve(m_entries.size());
+    for (const auto& [id, entry] : m_entries) {
+        if (id != keepId) {
+            lru.emplace_back(entry.lastAccess, id);
+        }
+    }
+    std::sort(lru.begin(), lru.end());
+
+    for (auto it = lru.begin(); it != lru.end() && m_cacheSize > m_sizeLimit; ++it) {
+        // the blob may be already removed by another process, which isn't an error, or still mapped on Windows, then
+        // it's kept in the index and is tried again next time
+        std::error_code ec;
+        std::filesystem::remove(getBlobFile(it->second), ec);
+        if (!ec) {
+            erase_entry(it->second);
+        }
+    }
+}
+
+}  // namespace ov
@@ -12,7 +12,9 @@
 #include <fstream>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 
 #include "openvino/runtime/shared_buffer.hpp"
 #include "openvino/runtime/tensor.hpp"
@@ -97,59 +99,88 @@ public:
 /**
  * @brief File storage-based Implementation of ICacheManager
  *
- * Uses simple file for read/write cached models.
+ * Uses simple file for read/write cached models. The blobs are written to a temporary file which is renamed
+ * afterwards, so concurrent readers never see partially written blobs.
+ *
+ * If the cache size limit is set, the blobs sizes and access times are tracked in the index file stored in the
+ * cache directory, and the least recently used blobs are removed once the total size exceeds the limit. The index is
+ * shared by the processes using the same cache directory, the directory is scanned only if the index is missing or
+ * damaged.
  *
  */
 class FileStorageCacheManager final : public ICacheManager {
-    std::string m_cachePath;
-
-    ov::util::Path getBlobFile(const std::string& blobHash) const {
-#if defined(_WIN32) && defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT)
-        return ov::util::string_to_wstring(ov::util::make_path(m_cachePath, blobHash + ".blob"));
-#else
-        return ov::util::make_path(m_cachePath, blobHash + ".blob");
-#endif
-    }
-
 public:
     /**
      * @brief Constructor
      *
+     * @param cachePath Path to the cache directory
+     * @param sizeLimit Maximum total size of the cached blobs in bytes, 0 means unlimited
      */
-    FileStorageCacheManager(std::string cachePath) : m_cachePath(std::move(cachePath)) {}
+    FileStorageCacheManager(std::string cachePath, uint64_t sizeLimit = 0);
 
     /**
-     * @brief Destructor
+     * @brief Destructor, flushes the pending access times to the index file
      *
      */
-    ~FileStorageCacheManager() override = default;
+    ~FileStorageCacheManager() override;
+
+    /**
+     * @brief Returns the total size of the cached blobs tracked by the cache manager
+     * @note The size is tracked only if the cache size limit is set
+     */
+    uint64_t get_cache_size() const;
 
 private:
-    void write_cache_entry(const std::string& id, StreamWriter writer) override {
-        // Fix the bug caused by pugixml, which may return unexpected results if the locale is different from "C".
-        ScopedLocale plocal_C(LC_ALL, "C");
-        std::ofstream stream(getBlobFile(id), std::ios_base::binary | std::ofstream::out);
-        writer(stream);
+    struct Entry {
+        uint64_t size = 0;
+        uint64_t lastAccess = 0;
+    };
+
+    std::string m_cachePath;
+    uint64_t m_sizeLimit = 0;
+    mutable std::mutex m_mutex;
+    std::unordered_map<std::string, Entry> m_entries;
+    uint64_t m_cacheSize = 0;
+    uint64_t m_lastAccess = 0;
+    uint64_t m_indexStamp = 0;  // stamp of the index file content the tracked entries are based on
+    bool m_indexDirty = false;
+
+    ov::util::Path getCacheFile(const std::string& fileName) const {
+#if defined(_WIN32) && defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT)
+        return ov::util::string_to_wstring(ov::util::make_path(m_cachePath, fileName));
+#else
+        return ov::util::make_path(m_cachePath, fileName);
+#endif
     }
 
-    void read_cache_entry(const std::string& id, bool enable_mmap, StreamReader reader) override {
-        // Fix the bug caused by pugixml, which may return unexpected results if the locale is different from "C".
-        ScopedLocale plocal_C(LC_ALL, "C");
-        const auto blob_file_name = getBlobFile(id);
-        if (std::filesystem::exists(blob_file_name)) {
-            auto compiled_blob =
-                read_tensor_data(blob_file_name, element::u8, PartialShape::dynamic(1), 0, enable_mmap);
-            reader(compiled_blob);
-        }
+    ov::util::Path getBlobFile(const std::string& blobHash) const {
+        return getCacheFile(blobHash + ".blob");
     }
 
-    void remove_cache_entry(const std::string& id) override {
-        auto blobFileName = getBlobFile(id);
+    void write_cache_entry(const std::string& id, StreamWriter writer) override;
 
-        if (std::filesystem::exists(blobFileName)) {
-            std::ignore = std::filesystem::remove(blobFileName);
-        }
-    }
+    void read_cache_entry(const std::string& id, bool enable_mmap, StreamReader reader) override;
+
+    void remove_cache_entry(const std::string& id) override;
+
+    // Takes the tracked entries from the index file, which may be updated by other processes, if it was changed since
+    // the last load or save. Rebuilds the index if it is missing or damaged. Called under the index file lock.
+    void load_index();
+
+    // Rebuilds the tracked entries from the cache directory contents and removes the orphaned temporary files
+    void rebuild_index();
+
+    void save_index();
+
+    // Returns strictly increasing access time
+    uint64_t access_time();
+
+    void update_entry(const std::string& id, uint64_t size);
+
+    void erase_entry(const std::string& id);
+
+    // Removes the least recently used blobs except the one with given id until the cache fits the size limit
+    void evict(const std::string& keepId);
 };
 
 }  // namespace ov
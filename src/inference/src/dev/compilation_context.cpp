@@ -9,11 +9,17 @@
 #    include <unistd.h>
 #endif
 
+#include <mutex>
+#include <unordered_map>
+
 #include "itt.hpp"
 #include "openvino/core/parallel.hpp"
 #include "openvino/pass/manager.hpp"
 #include "openvino/runtime/compilation_context.hpp"
+#include "openvino/runtime/compute_hash.hpp"
+#include "openvino/util/common_util.hpp"
 #include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
 #include "openvino/util/xml_parse_utils.hpp"
 #include "transformations/hash.hpp"
 #include "transformations/rt_info/fused_names_attribute.hpp"
@@ -52,6 +58,136 @@ std::string ModelCache::calculate_file_info(const std::string& filePath) {
     return std::to_string(seed);
 }
 
+namespace {
+struct FileContentHash {
+    uint64_t device = 0;
+    uint64_t inode = 0;
+    uint64_t size = 0;
+    int64_t mtime = 0;
+    int64_t ctime = 0;
+    uint64_t hash = 0;
+
+    bool same_file(const FileContentHash& other) const {
+        return device == other.device && inode == other.inode && size == other.size && mtime == other.mtime &&
+               ctime == other.ctime;
+    }
+};
+
+// Hashes the file content chunk by chunk in parallel. Returns false if the file is not accessible.
+bool hash_file_content(const std::string& absPath, FileContentHash& info) {
+    struct stat result;
+    if (stat(absPath.c_str(), &result) != 0) {
+        return false;
+    }
+    info.device = static_cast<uint64_t>(result.st_dev);
+    info.inode = static_cast<uint64_t>(result.st_ino);
+    info.size = static_cast<uint64_t>(result.st_size);
+    info.mtime = static_cast<int64_t>(result.st_mtime) * 1000000000;
+    info.ctime = static_cast<int64_t>(result.st_ctime) * 1000000000;
+#if defined(__APPLE__)
+    info.mtime += result.st_mtimespec.tv_nsec;
+    info.ctime += result.st_ctimespec.tv_nsec;
+#elif !defined(_WIN32)
+    info.mtime += result.st_mtim.tv_nsec;
+    info.ctime += result.st_ctim.tv_nsec;
+#endif
+
+    // an empty file can't be mapped, its hash is the hash of the zero size
+    if (info.size == 0) {
+        info.hash = hash_combine(0, size_t{0});
+        return true;
+    }
+
+    // Files are rarely changed between runs, so the content hash is memoized by the file identity and the
+    // modification time to make warm starts almost free. The memo is reset when it's full, so a process going
+    // through many models doesn't grow it without bounds
+    constexpr size_t max_memoized_files = 256;
+    static std::mutex cache_mutex;
+    static std::unordered_map<std::string, FileContentHash> cache;
+    {
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        auto it = cache.find(absPath);
+        if (it != cache.end() && it->second.same_file(info)) {
+            info.hash = it->second.hash;
+            return true;
+        }
+    }
+
+    std::shared_ptr<ov::MappedMemory> mapped;
+    try {
+        mapped = ov::load_mmap_object(absPath);
+    } catch (const std::exception&) {
+        return false;
+    }
+    const auto data = mapped->data();
+    const size_t size = mapped->size();
+
+    // 16MB chunks keep all the threads busy for big weights and take one chunk for small files
+    constexpr size_t chunk_size = 16 * 1024 * 1024;
+    const size_t chunks_num = (size + chunk_size - 1) / chunk_size;
+    std::vector<uint64_t> chunk_hashes(chunks_num, 0);
+    ov::parallel_for(chunks_num, [&](size_t chunk_idx) {
+        const size_t offset = chunk_idx * chunk_size;
+        chunk_hashes[chunk_idx] = ov::runtime::compute_hash(data + offset, std::min(chunk_size, size - offset));
+    });
+
+    uint64_t seed = hash_combine(0, size);
+    for (auto hash : chunk_hashes) {
+        seed = hash_combine(seed, hash);
+    }
+    info.hash = seed;
+
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    if (cache.size() >= max_memoized_files && cache.count(absPath) == 0) {
+        cache.clear();
+    }
+    cache[absPath] = info;
+    return true;
+}
+
+std::string get_absolute_path(const std::string& filePath) {
+    try {
+        return ov::util::get_absolute_file_path(filePath);
+    } catch (std::runtime_error&) {
+        // can't get absolute path, will use filePath
+        return filePath;
+    }
+}
+}  // namespace
+
+std::string ModelCache::calculate_file_content_info(const std::string& modelPath) {
+    OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::ReadTime, "ModelCache::calculate_file_content_info");
+    const auto absPath = get_absolute_path(modelPath);
+
+    std::vector<std::string> files{absPath};
+    // IR weights are stored aside of the topology
+    if (ov::util::ends_with(absPath, ".xml")) {
+        files.push_back(absPath.substr(0, absPath.size() - 4) + ".bin");
+    }
+
+    uint64_t seed = 0;
+    for (const auto& file : files) {
+        FileContentHash info;
+        if (hash_file_content(file, info)) {
+            seed = hash_combine(seed, info.hash);
+        } else {
+            // the key must not depend on the model location, so a missing file is marked by its absence only
+            seed = hash_combine(seed, std::string("<missing>"));
+        }
+    }
+    return std::to_string(seed);
+}
+
+std::string ModelCache::compute_content_hash(const std::string& modelPath, const ov::AnyMap& compileOptions) {
+    OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::ReadTime, "ModelCache::compute_content_hash - Model");
+    uint64_t seed = 0;
+    seed = hash_combine(seed, calculate_file_content_info(modelPath));
+    for (const auto& [name, option] : compileOptions) {
+        seed = hash_combine(seed, name + option.as<std::string>());
+    }
+    return std::to_string(seed);
+}
+
 std::string ModelCache::compute_hash(const std::shared_ptr<const ov::Model>& model, const ov::AnyMap& compileOptions) {
     OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::ReadTime, "ModelCache::compute_hash - Model");
 
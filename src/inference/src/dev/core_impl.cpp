@@ -204,8 +204,11 @@ void clean_batch_properties(const std::string& deviceName, ov::AnyMap& config, c
     }
 }
 
-static const auto core_properties_names =
-    ov::util::make_array(ov::cache_dir.name(), ov::enable_mmap.name(), ov::force_tbb_terminate.name());
+static const auto core_properties_names = ov::util::make_array(ov::cache_dir.name(),
+                                                               ov::enable_mmap.name(),
+                                                               ov::force_tbb_terminate.name(),
+                                                               ov::internal::cache_hash_model_content.name(),
+                                                               ov::internal::cache_size_limit.name());
 
 static const auto auto_batch_properties_names =
     ov::util::make_array(ov::auto_batch_timeout.name(), ov::hint::allow_auto_batching.name());
@@ -901,8 +904,14 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model(const std::string& mod
     } else if (cacheManager && device_supports_model_caching(plugin, parsed._config) && !is_proxy_device(plugin)) {
         // Skip caching for proxy plugin. HW plugin will load network from the cache
         CoreConfig::remove_core_skip_cache_dir(parsed._config);
-        CacheContent cacheContent{cacheManager, parsed._core_config.get_enable_mmap(), model_path};
-        cacheContent.blobId = ov::ModelCache::compute_hash(model_path, create_compile_config(plugin, parsed._config));
+        CacheContent cacheContent{cacheManager,
+                                  parsed._core_config.get_enable_mmap(),
+                                  model_path,
+                                  parsed._core_config.get_cache_hash_model_content()};
+        cacheContent.blobId =
+            cacheContent.hash_model_content
+                ? ov::ModelCache::compute_content_hash(model_path, create_compile_config(plugin, parsed._config))
+                : ov::ModelCache::compute_hash(model_path, create_compile_config(plugin, parsed._config));
         std::unique_ptr<CacheGuardEntry> lock = cacheGuard.get_hash_lock(cacheContent.blobId);
         compiled_model =
             load_model_from_cache(cacheContent, plugin, parsed._config, ov::SoPtr<ov::IRemoteContext>{}, [&]() {
@@ -1247,6 +1256,11 @@ ov::Any ov::CoreImpl::get_property_for_core(const std::string& name) const {
     } else if (name == ov::enable_mmap.name()) {
         const auto flag = coreConfig.get_enable_mmap();
         return decltype(ov::enable_mmap)::value_type(flag);
+    } else if (name == ov::internal::cache_hash_model_content.name()) {
+        const auto flag = coreConfig.get_cache_hash_model_content();
+        return decltype(ov::internal::cache_hash_model_content)::value_type(flag);
+    } else if (name == ov::internal::cache_size_limit.name()) {
+        return decltype(ov::internal::cache_size_limit)::value_type(coreConfig.get_cache_size_limit());
     }
 
     OPENVINO_THROW("Exception is thrown while trying to call get_property with unsupported property: '", name, "'");
@@ -1366,9 +1380,10 @@ void ov::CoreImpl::set_property_for_device(const ov::AnyMap& configMap, const st
                 config.erase(it);
             }
 
-            it = config.find(ov::enable_mmap.name());
-            if (it != config.end()) {
-                config.erase(it);
+            for (const auto& name : {ov::enable_mmap.name(),
+                                     ov::internal::cache_hash_model_content.name(),
+                                     ov::internal::cache_size_limit.name()}) {
+                config.erase(name);
             }
         }
 
@@ -1503,7 +1518,7 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model_and_cache(ov::Plugin&
             }
             cacheContent.cacheManager->write_cache_entry(cacheContent.blobId, [&](std::ostream& networkStream) {
                 networkStream << ov::CompiledBlobHeader(ov::get_openvino_version().buildNumber,
-                                                        ov::ModelCache::calculate_file_info(cacheContent.modelPath),
+                                                        cacheContent.file_info(),
                                                         compiled_model_runtime_properties);
                 compiled_model->export_model(networkStream);
             });
@@ -1541,7 +1556,7 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::load_model_from_cache(
                     header.read_from_buffer(static_cast<const char*>(compiled_blob.data()),
                                             compiled_blob.get_byte_size(),
                                             compiled_blob_offset);
-                    if (header.get_file_info() != ov::ModelCache::calculate_file_info(cacheContent.modelPath)) {
+                    if (header.get_file_info() != cacheContent.file_info()) {
                         // Original file is changed, don't use cache
                         OPENVINO_THROW("Original model file is changed");
                     }
@@ -1659,17 +1674,32 @@ ov::CoreConfig::CoreConfig(const CoreConfig& other) {
         _cacheConfigPerDevice = other._cacheConfigPerDevice;
     }
     _flag_enable_mmap = other._flag_enable_mmap;
+    _flag_cache_hash_model_content = other._flag_cache_hash_model_content;
+    _cache_size_limit = other._cache_size_limit;
 }
 
 void ov::CoreConfig::set(const ov::AnyMap& config) {
-    auto it = config.find(ov::cache_dir.name());
+    auto it = config.find(ov::internal::cache_size_limit.name());
+    if (it != config.end()) {
+        std::lock_guard<std::mutex> lock(_cacheConfigMutex);
+        _cache_size_limit = it->second.as<uint64_t>();
+        // recreate the cache managers to apply the new limit
+        if (config.count(ov::cache_dir.name()) == 0) {
+            _cacheConfig = CoreConfig::CacheConfig::create(_cacheConfig._cacheDir, _cache_size_limit);
+        }
+        for (auto& deviceCfg : _cacheConfigPerDevice) {
+            deviceCfg.second = CoreConfig::CacheConfig::create(deviceCfg.second._cacheDir, _cache_size_limit);
+        }
+    }
+
+    it = config.find(ov::cache_dir.name());
     if (it != config.end()) {
         std::lock_guard<std::mutex> lock(_cacheConfigMutex);
         // fill global cache config
-        _cacheConfig = CoreConfig::CacheConfig::create(it->second.as<std::string>());
+        _cacheConfig = CoreConfig::CacheConfig::create(it->second.as<std::string>(), _cache_size_limit);
         // sets cache config per-device if it's not set explicitly before
         for (auto& deviceCfg : _cacheConfigPerDevice) {
-            deviceCfg.second = CoreConfig::CacheConfig::create(it->second.as<std::string>());
+            deviceCfg.second = CoreConfig::CacheConfig::create(it->second.as<std::string>(), _cache_size_limit);
         }
     }
 
@@ -1684,6 +1714,11 @@ void ov::CoreConfig::set(const ov::AnyMap& config) {
         auto flag = it->second.as<bool>();
         _flag_enable_mmap = flag;
     }
+
+    it = config.find(ov::internal::cache_hash_model_content.name());
+    if (it != config.end()) {
+        _flag_cache_hash_model_content = it->second.as<bool>();
+    }
 }
 
 void ov::CoreConfig::set_and_update(ov::AnyMap& config) {
@@ -1698,14 +1733,17 @@ void ov::CoreConfig::remove_core(ov::AnyMap& config) {
 }
 
 void ov::CoreConfig::remove_core_skip_cache_dir(ov::AnyMap& config) {
-    for (const auto& name : {ov::enable_mmap.name(), ov::force_tbb_terminate.name()}) {
+    for (const auto& name : {ov::enable_mmap.name(),
+                             ov::force_tbb_terminate.name(),
+                             ov::internal::cache_hash_model_content.name(),
+                             ov::internal::cache_size_limit.name()}) {
         config.erase(name);
     }
 }
 
 void ov::CoreConfig::set_cache_dir_for_device(const std::string& dir, const std::string& name) {
     std::lock_guard<std::mutex> lock(_cacheConfigMutex);
-    _cacheConfigPerDevice[name] = CoreConfig::CacheConfig::create(dir);
+    _cacheConfigPerDevice[name] = CoreConfig::CacheConfig::create(dir, _cache_size_limit);
 }
 
 std::string ov::CoreConfig::get_cache_dir() const {
@@ -1717,6 +1755,14 @@ bool ov::CoreConfig::get_enable_mmap() const {
     return _flag_enable_mmap;
 }
 
+bool ov::CoreConfig::get_cache_hash_model_content() const {
+    return _flag_cache_hash_model_content;
+}
+
+uint64_t ov::CoreConfig::get_cache_size_limit() const {
+    return _cache_size_limit;
+}
+
 // Creating thread-safe copy of config including shared_ptr to ICacheManager
 // Passing empty or not-existing name will return global cache config
 ov::CoreConfig::CacheConfig ov::CoreConfig::get_cache_config_for_device(const ov::Plugin& plugin,
@@ -1724,7 +1770,7 @@ ov::CoreConfig::CacheConfig ov::CoreConfig::get_cache_config_for_device(const ov
     // cache_dir is enabled locally in compile_model only
     if (parsedConfig.count(ov::cache_dir.name())) {
         const auto& cache_dir_val = parsedConfig.at(ov::cache_dir.name()).as<std::string>();
-        const auto& tempConfig = CoreConfig::CacheConfig::create(cache_dir_val);
+        const auto& tempConfig = CoreConfig::CacheConfig::create(cache_dir_val, _cache_size_limit);
         // if plugin does not explicitly support cache_dir, and if plugin is not virtual, we need to remove
         // it from config
         if (!util::contains(plugin.get_property(ov::supported_properties), ov::cache_dir) &&
@@ -1742,7 +1788,7 @@ ov::CoreConfig::CacheConfig ov::CoreConfig::get_cache_config_for_device(const ov
     return _cacheConfigPerDevice.count(plugin.get_name()) ? _cacheConfigPerDevice.at(plugin.get_name()) : _cacheConfig;
 }
 
-ov::CoreConfig::CacheConfig ov::CoreConfig::CacheConfig::create(const std::string& dir) {
+ov::CoreConfig::CacheConfig ov::CoreConfig::CacheConfig::create(const std::string& dir, uint64_t size_limit) {
     CacheConfig cache_config{dir, nullptr};
     if (!dir.empty()) {
         if constexpr (std::is_same_v<std::filesystem::path::value_type, std::wstring::value_type>) {
@@ -1753,7 +1799,7 @@ ov::CoreConfig::CacheConfig ov::CoreConfig::CacheConfig::create(const std::strin
         } else {
             ov::util::create_directory_recursive(dir);
         }
-        cache_config._cacheManager = std::make_shared<ov::FileStorageCacheManager>(dir);
+        cache_config._cacheManager = std::make_shared<ov::FileStorageCacheManager>(dir, size_limit);
     }
     return cache_config;
 }
@@ -12,6 +12,7 @@
 #include "openvino/core/so_extension.hpp"
 #include "openvino/core/version.hpp"
 #include "openvino/runtime/common.hpp"
+#include "openvino/runtime/compilation_context.hpp"
 #include "openvino/runtime/icompiled_model.hpp"
 #include "openvino/runtime/threading/executor_manager.hpp"
 
@@ -32,7 +33,7 @@ public:
         std::string _cacheDir;
         std::shared_ptr<ov::ICacheManager> _cacheManager;
 
-        static CacheConfig create(const std::string& dir);
+        static CacheConfig create(const std::string& dir, uint64_t size_limit = 0);
     };
 
     void set(const ov::AnyMap& config);
@@ -50,6 +51,10 @@ public:
 
     bool get_enable_mmap() const;
 
+    bool get_cache_hash_model_content() const;
+
+    uint64_t get_cache_size_limit() const;
+
     CacheConfig get_cache_config_for_device(const ov::Plugin& plugin, ov::AnyMap& parsedConfig) const;
 
     // Creating thread-safe copy of global config including shared_ptr to ICacheManager
@@ -64,6 +69,8 @@ private:
     CacheConfig _cacheConfig;
     std::map<std::string, CacheConfig> _cacheConfigPerDevice;
     bool _flag_enable_mmap = true;
+    bool _flag_cache_hash_model_content = false;
+    uint64_t _cache_size_limit = 0;
 };
 
 struct Parsed {
@@ -154,15 +161,24 @@ private:
     struct CacheContent {
         explicit CacheContent(const std::shared_ptr<ov::ICacheManager>& cache_manager,
                               bool mmap_enabled = false,
-                              const std::string model_path = {})
+                              const std::string model_path = {},
+                              bool hash_model_content = false)
             : cacheManager(cache_manager),
               modelPath(model_path),
-              mmap_enabled{mmap_enabled} {}
+              mmap_enabled{mmap_enabled},
+              hash_model_content{hash_model_content} {}
         std::shared_ptr<ov::ICacheManager> cacheManager;
         std::string blobId = {};
         std::string modelPath = {};
         std::shared_ptr<const ov::Model> model{};
         bool mmap_enabled = false;
+        bool hash_model_content = false;
+
+        // identifies the original model file to detect its changes
+        std::string file_info() const {
+            return hash_model_content ? ov::ModelCache::calculate_file_content_info(modelPath)
+                                      : ov::ModelCache::calculate_file_info(modelPath);
+        }
     };
 
     // Core settings (cache config, etc)
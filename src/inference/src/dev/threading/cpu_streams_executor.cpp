@@ -4,8 +4,11 @@
 
 #include "openvino/runtime/threading/cpu_streams_executor.hpp"
 
+#include <array>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <queue>
@@ -24,7 +27,48 @@
 
 namespace ov {
 namespace threading {
+namespace {
+// the executor and the index of the worker thread the current thread is, to schedule the tasks to its local queue
+thread_local const void* t_worker_executor = nullptr;
+thread_local size_t t_worker_id = 0;
+}  // namespace
+
 struct CPUStreamsExecutor::Impl {
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr size_t num_priorities = 3;
+
+    static size_t priority_index(ov::hint::Priority priority) {
+        switch (priority) {
+        case ov::hint::Priority::HIGH:
+            return 0;
+        case ov::hint::Priority::LOW:
+            return 2;
+        default:
+            return 1;
+        }
+    }
+
+    struct QueuedTask {
+        Task task;
+        Clock::time_point enqueued;
+    };
+    using TaskQueues = std::array<std::deque<QueuedTask>, num_priorities>;
+
+    // the tasks scheduled by the worker thread, all the workers take them in FIFO order
+    struct alignas(64) LocalQueue {
+        std::mutex mutex;
+        TaskQueues tasks;
+        // accessed by the owner only, set after it took its own task, so the shared queue is checked first the next time
+        bool sharedTurn = false;
+    };
+
+    struct WaitCounters {
+        std::atomic<uint64_t> tasks{0};
+        std::atomic<uint64_t> total_wait_us{0};
+        std::atomic<uint64_t> max_wait_us{0};
+    };
+
     struct Stream {
 #if OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO
         struct Observer : public custom::task_scheduler_observer {
@@ -349,6 +393,9 @@ struct CPUStreamsExecutor::Impl {
         } else {
             _usedNumaNodes = std::move(numaNodes);
         }
+        for (auto streamId = 0; streamId < streams_num; ++streamId) {
+            _localQueues.emplace_back(new LocalQueue);
+        }
         for (auto streamId = 0; streamId < streams_num; ++streamId) {
             if (_config.get_cpu_reservation()) {
                 std::lock_guard<std::mutex> lock(_cpu_ids_mutex);
@@ -356,33 +403,97 @@ struct CPUStreamsExecutor::Impl {
             }
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config.get_name() + "_" + std::to_string(streamId));
-                for (bool stopped = false; !stopped;) {
-                    Task task;
-                    {
-                        std::unique_lock<std::mutex> lock(_mutex);
-                        _queueCondVar.wait(lock, [&] {
-                            return !_taskQueue.empty() || (stopped = _isStopped);
-                        });
-                        if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
-                        }
+                t_worker_executor = this;
+                t_worker_id = static_cast<size_t>(streamId);
+                for (;;) {
+                    QueuedTask task;
+                    if (Dequeue(static_cast<size_t>(streamId), task)) {
+                        Execute(task.task, *(_streams.local()));
+                        continue;
                     }
-                    if (task) {
-                        Execute(task, *(_streams.local()));
+                    std::unique_lock<std::mutex> lock(_mutex);
+                    // the tasks are drained before the thread exits
+                    if (_isStopped && _pendingTasks.load() <= 0) {
+                        break;
                     }
+                    ++_idleWorkers;
+                    _queueCondVar.wait(lock, [&] {
+                        return _pendingTasks.load() > 0 || _isStopped;
+                    });
+                    --_idleWorkers;
                 }
             });
         }
         _streams.set_thread_ids_map(_threads);
     }
 
-    void Enqueue(Task task) {
+    void Enqueue(Task task, ov::hint::Priority priority = ov::hint::Priority::MEDIUM) {
+        // the task scheduled from the worker thread is likely to reuse its cache, so it stays local unless stolen
+        const bool local = t_worker_executor == this;
+        auto& mutex = local ? _localQueues[t_worker_id]->mutex : _mutex;
+        auto& queues = local ? _localQueues[t_worker_id]->tasks : _taskQueues;
         {
-            std::lock_guard<std::mutex> lock(_mutex);
-            _taskQueue.emplace(std::move(task));
+            std::lock_guard<std::mutex> lock(mutex);
+            queues[priority_index(priority)].push_back({std::move(task), Clock::now()});
+        }
+        _pendingTasks.fetch_add(1);
+        // the idle workers check the pending tasks under the mutex, so taking it guarantees the notification is not
+        // lost, while the busy workers find the task on their own
+        if (_idleWorkers.load() > 0) {
+            { std::lock_guard<std::mutex> lock(_mutex); }
+            _queueCondVar.notify_one();
+        }
+    }
+
+    bool Dequeue(size_t worker, QueuedTask& task) {
+        auto pop = [&](std::mutex& mutex, std::deque<QueuedTask>& queue) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (queue.empty()) {
+                return false;
+            }
+            task = std::move(queue.front());
+            queue.pop_front();
+            return true;
+        };
+        const size_t workers = _localQueues.size();
+        auto& own = *_localQueues[worker];
+        // a higher priority task goes first wherever it is queued
+        for (size_t p = 0; p < num_priorities; ++p) {
+            // the own and the shared queues take turns, so the tasks the workers keep scheduling (e.g. the callbacks
+            // starting the next request) cannot starve the tasks scheduled from outside
+            bool found = false;
+            if (own.sharedTurn) {
+                found = pop(_mutex, _taskQueues[p]) || pop(own.mutex, own.tasks[p]);
+                own.sharedTurn = false;
+            } else if (pop(own.mutex, own.tasks[p])) {
+                found = true;
+                own.sharedTurn = true;
+            } else {
+                found = pop(_mutex, _taskQueues[p]);
+            }
+            for (size_t i = 1; !found && i < workers; ++i) {
+                auto& victim = *_localQueues[(worker + i) % workers];
+                found = pop(victim.mutex, victim.tasks[p]);
+            }
+            if (found) {
+                _pendingTasks.fetch_sub(1);
+                RecordWait(p, task.enqueued);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void RecordWait(size_t priority, Clock::time_point enqueued) {
+        const auto wait_us = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - enqueued).count());
+        auto& counters = _waitCounters[priority];
+        counters.tasks.fetch_add(1, std::memory_order_relaxed);
+        counters.total_wait_us.fetch_add(wait_us, std::memory_order_relaxed);
+        auto max_wait_us = counters.max_wait_us.load(std::memory_order_relaxed);
+        while (max_wait_us < wait_us &&
+               !counters.max_wait_us.compare_exchange_weak(max_wait_us, wait_us, std::memory_order_relaxed)) {
         }
-        _queueCondVar.notify_one();
     }
 
     void Execute(const Task& task, Stream& stream) {
@@ -452,7 +563,13 @@ struct CPUStreamsExecutor::Impl {
     std::vector<std::thread> _threads;
     std::mutex _mutex;
     std::condition_variable _queueCondVar;
-    std::queue<Task> _taskQueue;
+    // the tasks scheduled by the external threads
+    TaskQueues _taskQueues;
+    std::vector<std::unique_ptr<LocalQueue>> _localQueues;
+    // the number of queued tasks, can be negative for a moment as it is updated after the queue
+    std::atomic<int64_t> _pendingTasks{0};
+    std::atomic<int> _idleWorkers{0};
+    std::array<WaitCounters, num_priorities> _waitCounters;
     bool _isStopped = false;
     std::vector<int> _usedNumaNodes;
     CustomThreadLocal _streams;
@@ -532,5 +649,25 @@ void CPUStreamsExecutor::run(Task task) {
     }
 }
 
+void CPUStreamsExecutor::run_with_priority(Task task, ov::hint::Priority priority) {
+    if (0 == _impl->_config.get_streams()) {
+        _impl->Defer(std::move(task));
+    } else {
+        _impl->Enqueue(std::move(task), priority);
+    }
+}
+
+std::map<ov::hint::Priority, CPUStreamsExecutor::WaitStatistics> CPUStreamsExecutor::get_wait_statistics() const {
+    std::map<ov::hint::Priority, WaitStatistics> result;
+    for (auto priority : {ov::hint::Priority::HIGH, ov::hint::Priority::MEDIUM, ov::hint::Priority::LOW}) {
+        const auto& counters = _impl->_waitCounters[Impl::priority_index(priority)];
+        auto& statistics = result[priority];
+        statistics.tasks = counters.tasks.load(std::memory_order_relaxed);
+        statistics.total_wait_us = counters.total_wait_us.load(std::memory_order_relaxed);
+        statistics.max_wait_us = counters.max_wait_us.load(std::memory_order_relaxed);
+    }
+    return result;
+}
+
 }  // namespace threading
 }  // namespace ov
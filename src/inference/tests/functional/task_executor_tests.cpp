@@ -4,8 +4,11 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <functional>
 #include <future>
 #include <thread>
+#include <vector>
 
 #include "common_test_utils/test_assertions.hpp"
 #include "openvino/core/parallel.hpp"
@@ -263,3 +266,98 @@ static auto AsyncExecutors = ::testing::Values(
     });
 
 INSTANTIATE_TEST_SUITE_P(ASyncTaskExecutorTests, ASyncTaskExecutorTests, AsyncExecutors);
+
+TEST(CPUStreamsExecutorPriorityTests, higherPriorityTasksGoFirst) {
+    auto executor = std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor", 1, 1});
+    std::promise<void> started, blocked;
+    auto unblock = blocked.get_future().share();
+    // the only stream is busy, so the tasks below are queued until it is released
+    executor->run([&started, unblock] {
+        started.set_value();
+        unblock.wait();
+    });
+    started.get_future().wait();
+
+    std::mutex m;
+    std::vector<ov::hint::Priority> order;
+    std::vector<Future> futures;
+    for (auto priority : {ov::hint::Priority::LOW, ov::hint::Priority::MEDIUM, ov::hint::Priority::HIGH}) {
+        auto p = std::make_shared<std::packaged_task<void()>>([&m, &order, priority] {
+            std::lock_guard<std::mutex> l{m};
+            order.push_back(priority);
+        });
+        futures.emplace_back(p->get_future());
+        executor->run_with_priority(
+            [p] {
+                (*p)();
+            },
+            priority);
+    }
+    blocked.set_value();
+    for (auto& f : futures) {
+        OV_ASSERT_NO_THROW(f.get());
+    }
+    EXPECT_EQ(order,
+              (std::vector<ov::hint::Priority>{ov::hint::Priority::HIGH,
+                                               ov::hint::Priority::MEDIUM,
+                                               ov::hint::Priority::LOW}));
+
+    auto statistics = executor->get_wait_statistics();
+    EXPECT_EQ(statistics[ov::hint::Priority::HIGH].tasks, 1);
+    // the blocking task is counted as the MEDIUM one
+    EXPECT_EQ(statistics[ov::hint::Priority::MEDIUM].tasks, 2);
+    EXPECT_EQ(statistics[ov::hint::Priority::LOW].tasks, 1);
+    EXPECT_GE(statistics[ov::hint::Priority::LOW].total_wait_us, statistics[ov::hint::Priority::LOW].max_wait_us);
+}
+
+TEST(CPUStreamsExecutorPriorityTests, tasksScheduledFromStreamsAreStolen) {
+    const auto streams = std::max(2, get_number_of_cpu_cores());
+    auto executor =
+        std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor", streams, 1});
+    constexpr int tasks_num = 100;
+    std::atomic<int> executed{0};
+    std::promise<void> done;
+    // the tasks are scheduled to the local queue of the stream, so the other streams have to steal them
+    executor->run([&] {
+        for (int i = 0; i < tasks_num; ++i) {
+            executor->run([&] {
+                if (++executed == tasks_num) {
+                    done.set_value();
+                }
+            });
+        }
+    });
+    done.get_future().wait();
+    EXPECT_EQ(executed, tasks_num);
+}
+
+TEST(CPUStreamsExecutorPriorityTests, tasksScheduledFromOutsideAreNotStarved) {
+    auto executor = std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor", 1, 1});
+    constexpr int max_resubmits = 100000;
+    std::atomic<bool> outside_done{false};
+    std::atomic<int> resubmits{0};
+    std::promise<void> started, chain_done;
+    // the task keeps rescheduling itself from the only stream, like the callbacks starting the next request do
+    std::function<void()> resubmit = [&] {
+        if (resubmits.fetch_add(1) == 0) {
+            started.set_value();
+        }
+        if (outside_done || resubmits >= max_resubmits) {
+            chain_done.set_value();
+            return;
+        }
+        executor->run(resubmit);
+    };
+    executor->run(resubmit);
+    started.get_future().wait();
+
+    std::promise<void> outside;
+    executor->run([&] {
+        outside_done = true;
+        outside.set_value();
+    });
+    chain_done.get_future().wait();
+    EXPECT_TRUE(outside_done);
+    EXPECT_LT(resubmits, max_resubmits);
+    outside.get_future().wait();
+}
@@ -0,0 +1,199 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cache_manager.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#include "common_test_utils/common_utils.hpp"
+#include "openvino/core/except.hpp"
+
+using namespace ov;
+using namespace ::testing;
+
+class FileStorageCacheManagerTests : public Test {
+public:
+    std::string m_cacheDir;
+
+    void SetUp() override {
+        m_cacheDir = ov::test::utils::generateTestFilePrefix() + "_cache";
+        std::filesystem::create_directories(m_cacheDir);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(m_cacheDir);
+    }
+
+    static void write(ICacheManager& manager, const std::string& id, size_t size) {
+        manager.write_cache_entry(id, [&](std::ostream& stream) {
+            stream << std::string(size, 'a');
+        });
+    }
+
+    static bool read(ICacheManager& manager, const std::string& id) {
+        bool found = false;
+        manager.read_cache_entry(id, false, [&](ov::Tensor&) {
+            found = true;
+        });
+        return found;
+    }
+
+    size_t files_count(const std::string& ext) const {
+        size_t count = 0;
+        for (const auto& file : std::filesystem::directory_iterator(m_cacheDir)) {
+            count += file.path().extension() == ext ? 1 : 0;
+        }
+        return count;
+    }
+};
+
+TEST_F(FileStorageCacheManagerTests, WriteReadRemove) {
+    FileStorageCacheManager manager(m_cacheDir);
+    write(manager, "1", 10);
+    ASSERT_TRUE(read(manager, "1"));
+    ASSERT_FALSE(read(manager, "2"));
+    static_cast<ICacheManager&>(manager).remove_cache_entry("1");
+    ASSERT_FALSE(read(manager, "1"));
+    // unlimited cache doesn't keep the index
+    ASSERT_EQ(files_count(".index"), 0);
+}
+
+TEST_F(FileStorageCacheManagerTests, FailedWriteLeavesNoFiles) {
+    FileStorageCacheManager manager(m_cacheDir);
+    ICacheManager& cache = manager;
+    ASSERT_THROW(cache.write_cache_entry("1",
+                                         [](std::ostream& stream) {
+                                             stream << "partial";
+                                             OPENVINO_THROW("export failed");
+                                         }),
+                 ov::Exception);
+    ASSERT_FALSE(read(manager, "1"));
+    ASSERT_TRUE(std::filesystem::is_empty(m_cacheDir));
+}
+
+TEST_F(FileStorageCacheManagerTests, EvictLeastRecentlyUsed) {
+    FileStorageCacheManager manager(m_cacheDir, 250);
+    write(manager, "1", 100);
+    write(manager, "2", 100);
+    ASSERT_TRUE(read(manager, "1"));
+    write(manager, "3", 100);
+
+    ASSERT_TRUE(read(manager, "1"));
+    ASSERT_FALSE(read(manager, "2"));
+    ASSERT_TRUE(read(manager, "3"));
+    ASSERT_EQ(manager.get_cache_size(), 200);
+    ASSERT_EQ(files_count(".blob"), 2);
+    ASSERT_EQ(files_count(".tmp"), 0);
+}
+
+TEST_F(FileStorageCacheManagerTests, KeepLastWrittenBlob) {
+    FileStorageCacheManager manager(m_cacheDir, 50);
+    write(manager, "1", 10);
+    write(manager, "2", 100);
+    ASSERT_FALSE(read(manager, "1"));
+    ASSERT_TRUE(read(manager, "2"));
+}
+
+TEST_F(FileStorageCacheManagerTests, RestoreFromIndex) {
+    {
+        FileStorageCacheManager manager(m_cacheDir, 250);
+        write(manager, "1", 100);
+        write(manager, "2", 100);
+        ASSERT_TRUE(read(manager, "1"));
+    }
+    ASSERT_EQ(files_count(".index"), 1);
+
+    FileStorageCacheManager manager(m_cacheDir, 250);
+    ASSERT_EQ(manager.get_cache_size(), 200);
+    write(manager, "3", 100);
+    ASSERT_TRUE(read(manager, "1"));
+    ASSERT_FALSE(read(manager, "2"));
+}
+
+TEST_F(FileStorageCacheManagerTests, RestoreWithoutIndex) {
+    {
+        FileStorageCacheManager manager(m_cacheDir);
+        write(manager, "1", 100);
+        write(manager, "2", 100);
+    }
+
+    // existing cache is shrunk to the new limit
+    FileStorageCacheManager manager(m_cacheDir, 150);
+    ASSERT_EQ(manager.get_cache_size(), 100);
+    ASSERT_EQ(files_count(".blob"), 1);
+}
+
+TEST_F(FileStorageCacheManagerTests, DropBlobsRemovedByOtherManager) {
+    FileStorageCacheManager manager(m_cacheDir, 1000);
+    write(manager, "1", 100);
+    write(manager, "2", 100);
+    {
+        FileStorageCacheManager other(m_cacheDir, 1000);
+        static_cast<ICacheManager&>(other).remove_cache_entry("1");
+        ASSERT_EQ(other.get_cache_size(), 100);
+    }
+
+    // the index updated by the other manager is loaded on the next update
+    write(manager, "3", 100);
+    ASSERT_EQ(manager.get_cache_size(), 200);
+    ASSERT_FALSE(read(manager, "1"));
+    ASSERT_TRUE(read(manager, "2"));
+    ASSERT_TRUE(read(manager, "3"));
+}
+
+TEST_F(FileStorageCacheManagerTests, RemoveOrphanedTempFiles) {
+    const auto orphaned = std::filesystem::path(m_cacheDir) / "1.blob.0_0.tmp";
+    const auto in_progress = std::filesystem::path(m_cacheDir) / "2.blob.0_1.tmp";
+    std::ofstream(orphaned) << "partial";
+    std::ofstream(in_progress) << "partial";
+    std::filesystem::last_write_time(orphaned, std::filesystem::file_time_type::clock::now() - std::chrono::hours(2));
+
+    FileStorageCacheManager manager(m_cacheDir, 1000);
+    ASSERT_FALSE(std::filesystem::exists(orphaned));
+    ASSERT_TRUE(std::filesystem::exists(in_progress));
+    ASSERT_EQ(manager.get_cache_size(), 0);
+}
+
+TEST_F(FileStorageCacheManagerTests, StartWithoutDirectoryScan) {
+    {
+        FileStorageCacheManager manager(m_cacheDir, 1000);
+        write(manager, "1", 100);
+    }
+    // the blob written without the size limit isn't tracked, as the directory isn't scanned if there is the index
+    {
+        FileStorageCacheManager unlimited(m_cacheDir);
+        write(unlimited, "2", 100);
+    }
+
+    FileStorageCacheManager manager(m_cacheDir, 1000);
+    ASSERT_EQ(manager.get_cache_size(), 100);
+}
+
+TEST_F(FileStorageCacheManagerTests, RebuildDamagedIndex) {
+    {
+        FileStorageCacheManager manager(m_cacheDir, 1000);
+        write(manager, "1", 100);
+        write(manager, "2", 100);
+    }
+    // drop the last entry, so the index doesn't match its header
+    const auto index_file = std::filesystem::path(m_cacheDir) / "cache.index";
+    std::string content;
+    {
+        std::ifstream index(index_file);
+        content.assign(std::istreambuf_iterator<char>(index), std::istreambuf_iterator<char>());
+    }
+    content.erase(content.rfind('\n', content.size() - 2) + 1);
+    std::ofstream(index_file) << content;
+
+    FileStorageCacheManager manager(m_cacheDir, 1000);
+    ASSERT_EQ(manager.get_cache_size(), 200);
+    ASSERT_TRUE(read(manager, "1"));
+    ASSERT_TRUE(read(manager, "2"));
+}
@@ -7,6 +7,7 @@
 #include <gtest/gtest.h>
 
 #include <chrono>
+#include <filesystem>
 #include <fstream>
 #include <string>
 #include <thread>
@@ -172,6 +173,30 @@ TEST(NetworkContext, HashOfSame) {
     ASSERT_EQ(ov::ModelCache::compute_hash(model1, {}), ov::ModelCache::compute_hash(model2, {}));
 }
 
+TEST(NetworkContext, HashWithDuplicatedConstants) {
+    // the duplicated data is written to the hash stream once and the duplicate takes the offset of the first copy
+    auto create_model = [](int8_t add_value, bool share_data) {
+        auto model = create_simple_model();
+        for (const auto& op : model->get_ordered_ops()) {
+            if (op->get_friendly_name() != "add") {
+                continue;
+            }
+            const auto mul = op->get_input_node_shared_ptr(0);
+            auto mul_constant = ov::as_type_ptr<ov::op::v0::Constant>(mul->get_input_node_shared_ptr(1));
+            auto add_constant = share_data ? std::make_shared<ov::op::v0::Constant>(*mul_constant)
+                                           : ov::op::v0::Constant::create(ov::element::i8, ov::Shape{1}, {add_value});
+            add_constant->set_friendly_name("add_constant");
+            add_constant->get_output_tensor(0).set_names({"add_constant"});
+            op->input(1).replace_source_output(add_constant);
+        }
+        return model;
+    };
+    const auto hash = ov::ModelCache::compute_hash(create_model(3, false), {});
+    ASSERT_EQ(hash, ov::ModelCache::compute_hash(create_model(3, false), {}));
+    ASSERT_EQ(hash, ov::ModelCache::compute_hash(create_model(3, true), {}));
+    ASSERT_NE(hash, ov::ModelCache::compute_hash(create_model(2, false), {}));
+}
+
 TEST(NetworkContext, HashWithConfig) {
     auto net1 = create_simple_model();
     auto net2 = create_simple_model();
@@ -381,6 +406,90 @@ TEST(NetworkContext_ModelName, HashOfExistingFile) {
               ov::ModelCache::compute_hash(file2, {{"key", "value"}}));
 }
 
+TEST(NetworkContext_ModelContent, HashOfSameContent) {
+    auto prefix = ov::test::utils::generateTestFilePrefix();
+    auto file1 = prefix + "_1.xml";
+    auto file2 = prefix + "_2.xml";
+
+    FileGuard guard1(file1), guard2(file2);
+    for (const auto& file : {file1, file2}) {
+        std::ofstream os(file);
+        os << "test";
+    }
+    ASSERT_EQ(ov::ModelCache::compute_content_hash(file1, {}), ov::ModelCache::compute_content_hash(file1, {}));
+
+    // content addressed key doesn't depend on the model location
+    ASSERT_EQ(ov::ModelCache::compute_content_hash(file1, {}), ov::ModelCache::compute_content_hash(file2, {}));
+
+    ASSERT_NE(ov::ModelCache::compute_content_hash(file1, {{"key", "value"}}),
+              ov::ModelCache::compute_content_hash(file2, {}));
+}
+
+TEST(NetworkContext_ModelContent, HashOfModifiedContent) {
+    auto file = ov::test::utils::generateTestFilePrefix() + ".xml";
+
+    FileGuard guard(file);
+    {
+        std::ofstream os(file);
+        os << "test";
+    }
+    auto hash1 = ov::ModelCache::compute_content_hash(file, {});
+    const auto write_time = std::filesystem::last_write_time(file);
+    {
+        // same size, different content
+        std::ofstream os(file);
+        os << "tset";
+    }
+    // the memoized hash is invalidated by the modification time, which may have the coarse resolution
+    std::filesystem::last_write_time(file, write_time + std::chrono::seconds(2));
+    auto hash2 = ov::ModelCache::compute_content_hash(file, {});
+    ASSERT_NE(hash1, hash2);
+}
+
+TEST(NetworkContext_ModelContent, HashOfEmptyWeights) {
+    auto prefix = ov::test::utils::generateTestFilePrefix();
+    auto xml = prefix + ".xml";
+    auto bin = prefix + ".bin";
+
+    FileGuard guard_xml(xml), guard_bin(bin);
+    {
+        std::ofstream os(xml);
+        os << "test";
+    }
+    auto hash_no_weights = ov::ModelCache::compute_content_hash(xml, {});
+    {
+        std::ofstream os(bin, std::ios::binary);
+    }
+    auto hash_empty_weights = ov::ModelCache::compute_content_hash(xml, {});
+    ASSERT_NE(hash_no_weights, hash_empty_weights);
+    ASSERT_EQ(hash_empty_weights, ov::ModelCache::compute_content_hash(xml, {}));
+}
+
+TEST(NetworkContext_ModelContent, HashOfModifiedWeights) {
+    auto prefix = ov::test::utils::generateTestFilePrefix();
+    auto xml = prefix + ".xml";
+    auto bin = prefix + ".bin";
+
+    FileGuard guard_xml(xml), guard_bin(bin);
+    {
+        std::ofstream os(xml);
+        os << "test";
+    }
+    auto hash_no_weights = ov::ModelCache::compute_content_hash(xml, {});
+    {
+        std::ofstream os(bin, std::ios::binary);
+        os << "weights";
+    }
+    auto hash1 = ov::ModelCache::compute_content_hash(xml, {});
+    ASSERT_NE(hash_no_weights, hash1);
+    {
+        std::ofstream os(bin, std::ios::binary | std::ios::app);
+        os << "weights";
+    }
+    auto hash2 = ov::ModelCache::compute_content_hash(xml, {});
+    ASSERT_NE(hash1, hash2);
+}
+
 TEST(NetworkContext, HashOfSameModelWithClone) {
     auto model1 = create_simple_model();
     // test model with friendly name
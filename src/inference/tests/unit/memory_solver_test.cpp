@@ -336,3 +336,66 @@ TEST(MemSolverTest, BestSolution1) {
         for (int j = i + 1; j < n; j++)
             ASSERT_TRUE(no_overlap(boxes[i], boxes[j])) << "Box overlapping is detected";
 }
+
+// The same case as DISABLED_Unefficiency, the best fit planner finds the optimal solution
+TEST(MemSolverTest, BestFitEfficiency) {
+    std::vector<Box> boxes{
+        {6, 7, 3, 0},
+        {2, 5, 2, 1},
+        {5, 8, 2, 2},
+        {2, 3, 2, 3},
+    };
+
+    for (auto planner : {ov::MemorySolver::Planner::BEST_FIT, ov::MemorySolver::Planner::BEST_OF}) {
+        ov::MemorySolver ms(boxes, planner);
+        EXPECT_EQ(ms.solve(), 5);
+        EXPECT_EQ(ms.max_depth(), 5);
+        EXPECT_EQ(ms.max_top_depth(), 2);
+    }
+}
+
+TEST(MemSolverTest, PlannersNoOverlapping) {
+    // pseudo random boxes with short and long live time
+    std::vector<Box> boxes;
+    uint32_t seed = 7;
+    auto next = [&seed](uint32_t max) {
+        seed = seed * 1103515245 + 12345;
+        return static_cast<int>((seed >> 16) % max);
+    };
+    for (int i = 0; i < 500; i++) {
+        const int start = next(300);
+        const int finish = i % 50 == 0 ? -1 : start + next(i % 5 == 0 ? 100 : 5);
+        boxes.push_back({start, finish, 1 + next(1000), i});
+    }
+
+    int64_t greedy_required = 0;
+    for (auto planner : {ov::MemorySolver::Planner::GREEDY_POP_UP,
+                         ov::MemorySolver::Planner::BEST_FIT,
+                         ov::MemorySolver::Planner::BEST_OF}) {
+        ov::MemorySolver ms(boxes, planner);
+        const auto required = ms.solve();
+        EXPECT_GE(required, ms.max_depth());
+        if (planner == ov::MemorySolver::Planner::GREEDY_POP_UP) {
+            greedy_required = required;
+        } else if (planner == ov::MemorySolver::Planner::BEST_OF) {
+            EXPECT_LE(required, greedy_required);
+        }
+
+        int time_end = 0;
+        for (const auto& box : boxes)
+            time_end = std::max(time_end, box.finish);
+        auto finish = [&](const Box& box) {
+            return box.finish == -1 ? time_end : box.finish;
+        };
+        for (size_t i = 0; i < boxes.size(); i++) {
+            const auto off_i = ms.get_offset(static_cast<int>(boxes[i].id));
+            ASSERT_LE(off_i + boxes[i].size, required);
+            for (size_t j = i + 1; j < boxes.size(); j++) {
+                const auto off_j = ms.get_offset(static_cast<int>(boxes[j].id));
+                const bool no_overlap = finish(boxes[i]) < boxes[j].start || boxes[i].start > finish(boxes[j]) ||
+                                        off_i + boxes[i].size <= off_j || off_i >= off_j + boxes[j].size;
+                ASSERT_TRUE(no_overlap) << "Box overlapping is detected";
+            }
+        }
+    }
+}
@@ -0,0 +1,198 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/runtime/threading/thread_safe_containers.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using ov::threading::ThreadSafeBoundedMPMCQueue;
+using ov::threading::ThreadSafeQueueWithSize;
+
+TEST(ThreadSafeBoundedMPMCQueueTest, ZeroCapacityRejectsValues) {
+    ThreadSafeBoundedMPMCQueue<int> queue;
+    int value = 0;
+    EXPECT_EQ(queue.capacity(), 0);
+    EXPECT_FALSE(queue.try_push(1));
+    EXPECT_FALSE(queue.try_pop(value));
+    EXPECT_EQ(queue.size(), 0);
+}
+
+TEST(ThreadSafeBoundedMPMCQueueTest, CapacityIsRoundedUpToPowerOfTwo) {
+    EXPECT_EQ(ThreadSafeBoundedMPMCQueue<int>(1).capacity(), 2);
+    EXPECT_EQ(ThreadSafeBoundedMPMCQueue<int>(4).capacity(), 4);
+    EXPECT_EQ(ThreadSafeBoundedMPMCQueue<int>(5).capacity(), 8);
+}
+
+TEST(ThreadSafeBoundedMPMCQueueTest, KeepsOrderAndBound) {
+    ThreadSafeBoundedMPMCQueue<int> queue(4);
+    for (int lap = 0; lap < 3; ++lap) {
+        for (int i = 0; i < 4; ++i) {
+            ASSERT_TRUE(queue.try_push(i));
+        }
+        EXPECT_FALSE(queue.try_push(4));
+        EXPECT_EQ(queue.size(), 4);
+        int value = -1;
+        for (int i = 0; i < 4; ++i) {
+            ASSERT_TRUE(queue.try_pop(value));
+            EXPECT_EQ(value, i);
+        }
+        EXPECT_FALSE(queue.try_pop(value));
+        EXPECT_EQ(queue.size(), 0);
+    }
+}
+
+TEST(ThreadSafeBoundedMPMCQueueTest, SetCapacityResetsQueue) {
+    ThreadSafeBoundedMPMCQueue<int> queue(2);
+    ASSERT_TRUE(queue.try_push(1));
+    queue.set_capacity(8);
+    int value = 0;
+    EXPECT_FALSE(queue.try_pop(value));
+    for (int i = 0; i < 8; ++i) {
+        ASSERT_TRUE(queue.try_push(i));
+    }
+    EXPECT_FALSE(queue.try_push(8));
+}
+
+TEST(ThreadSafeBoundedMPMCQueueTest, ConcurrentProducersAndConsumers) {
+    constexpr int producers = 4;
+    constexpr int consumers = 4;
+    constexpr int values_per_producer = 20000;
+    ThreadSafeBoundedMPMCQueue<int> queue(16);
+    std::vector<std::atomic<int>> received(producers * values_per_producer);
+    std::atomic<int> popped{0};
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&, p] {
+            for (int i = 0; i < values_per_producer; ++i) {
+                while (!queue.try_push(p * values_per_producer + i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (int c = 0; c < consumers; ++c) {
+        threads.emplace_back([&] {
+            int value = 0;
+            while (popped.load() < producers * values_per_producer) {
+                if (queue.try_pop(value)) {
+                    received[value]++;
+                    popped++;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (auto& count : received) {
+        EXPECT_EQ(count.load(), 1);
+    }
+    EXPECT_EQ(queue.size(), 0);
+}
+
+// size() counts the values whose positions are reserved, so a consumer is able to pop all of them
+TEST(ThreadSafeBoundedMPMCQueueTest, SizeIsConsistentWithPop) {
+    constexpr int producers = 8;
+    constexpr int rounds = 2000;
+    ThreadSafeBoundedMPMCQueue<int> queue(producers);
+    for (int round = 0; round < rounds; ++round) {
+        std::vector<std::thread> threads;
+        for (int p = 0; p < producers; ++p) {
+            threads.emplace_back([&, p] {
+                ASSERT_TRUE(queue.try_push(p));
+            });
+        }
+        int popped = 0;
+        while (popped < producers) {
+            const auto size = queue.size();
+            int value = 0;
+            for (size_t i = 0; i < size; ++i) {
+                ASSERT_TRUE(queue.try_pop(value));
+            }
+            popped += static_cast<int>(size);
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+}
+
+namespace {
+
+template <typename Queue, typename Push>
+double measure_throughput(Queue& queue, Push push, int producers, int values_per_producer) {
+    const int total = producers * values_per_producer;
+    std::atomic<bool> start{false};
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&] {
+            while (!start.load()) {
+                std::this_thread::yield();
+            }
+            for (int i = 0; i < values_per_producer; ++i) {
+                while (!push(queue, i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    const auto begin = std::chrono::steady_clock::now();
+    start = true;
+    int value = 0;
+    for (int popped = 0; popped < total;) {
+        if (queue.try_pop(value)) {
+            ++popped;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    const auto end = std::chrono::steady_clock::now();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    return total / std::chrono::duration<double>(end - begin).count();
+}
+
+}  // namespace
+
+// Contention micro-benchmark: 1 to 64 producers and a single consumer, as the auto batching worker does. Run it with
+// --gtest_also_run_disabled_tests --gtest_filter=*ContentionBenchmark
+TEST(ThreadSafeBoundedMPMCQueueTest, DISABLED_ContentionBenchmark) {
+    constexpr int values_per_producer = 100000;
+    for (int producers = 1; producers <= 64; producers *= 2) {
+        ThreadSafeQueueWithSize<int> locked_queue;
+        const auto locked = measure_throughput(
+            locked_queue,
+            [](ThreadSafeQueueWithSize<int>& queue, int value) {
+                queue.push(value);
+                return true;
+            },
+            producers,
+            values_per_producer);
+
+        ThreadSafeBoundedMPMCQueue<int> ring_queue(1024);
+        const auto ring = measure_throughput(
+            ring_queue,
+            [](ThreadSafeBoundedMPMCQueue<int>& queue, int value) {
+                return queue.try_push(value);
+            },
+            producers,
+            values_per_producer);
+
+        EXPECT_EQ(locked_queue.size(), 0);
+        EXPECT_EQ(ring_queue.size(), 0);
+
+        std::cout << "producers: " << producers << ", mutex queue: " << static_cast<int64_t>(locked)
+                  << " ops/s, ring queue: " << static_cast<int64_t>(ring) << " ops/s, speedup: " << ring / locked
+                  << std::endl;
+    }
+}
@@ -65,12 +65,22 @@ AsyncInferRequest::AsyncInferRequest(const std::shared_ptr<SyncInferRequest>& re
                 std::pair<AsyncInferRequest*, ov::threading::Task> t;
                 t.first = _this;
                 t.second = std::move(task);
-                workerInferRequest->_tasks.push(t);
-                // it is ok to call size() here as the queue only grows (and the bulk removal happens under the mutex)
+                OPENVINO_ASSERT(workerInferRequest->_tasks.try_push(std::move(t)),
+                                "The batch of the worker request is overflowed");
+                // it is ok to call size() here as the queue only grows (the worker pops the tasks only when the batch
+                // is full or on the timeout)
                 const int sz = static_cast<int>(workerInferRequest->_tasks.size());
+                workerInferRequest->_statistics.on_arrival(sz);
                 if (sz == workerInferRequest->_batch_size) {
                     workerInferRequest->_is_wakeup = true;
                     workerInferRequest->_cond.notify_one();
+                } else if (sz == 1 && workerInferRequest->_adaptive_timeout) {
+                    // the worker chooses the timeout under the mutex, so the wake up cannot be missed
+                    {
+                        std::lock_guard<std::mutex> lock(workerInferRequest->_mutex);
+                        workerInferRequest->_is_wakeup = true;
+                    }
+                    workerInferRequest->_cond.notify_one();
                 }
             };
             AsyncInferRequest* _this = nullptr;
@@ -0,0 +1,117 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include "batch_statistics.hpp"
+
+#include <algorithm>
+
+namespace ov {
+namespace autobatch_plugin {
+namespace {
+int64_t to_ns(BatchStatistics::Clock::time_point time) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count();
+}
+
+double to_us(BatchStatistics::Clock::duration duration) {
+    return std::chrono::duration<double, std::micro>(duration).count();
+}
+}  // namespace
+
+void MovingAverage::update(double sample) {
+    double value = m_value.load(std::memory_order_relaxed);
+    double updated;
+    do {
+        updated = value < 0 ? sample : value + m_weight * (sample - value);
+    } while (!m_value.compare_exchange_weak(value, updated, std::memory_order_relaxed));
+}
+
+void BatchStatistics::on_arrival(size_t collected, Clock::time_point now) {
+    const auto now_ns = to_ns(now);
+    const auto last_ns = m_last_arrival.exchange(now_ns, std::memory_order_relaxed);
+    if (last_ns) {
+        // the concurrent arrivals may register in a different order
+        m_inter_arrival_us.update(std::max<int64_t>(now_ns - last_ns, 0) / 1000.0);
+    }
+    if (collected == 1) {
+        m_first_arrival.store(now_ns, std::memory_order_relaxed);
+    }
+}
+
+void BatchStatistics::on_batch_executed(size_t requests, Clock::duration duration) {
+    m_batch_execution_us.update(to_us(duration));
+    m_batches.fetch_add(1, std::memory_order_relaxed);
+    m_batched_requests.fetch_add(requests, std::memory_order_relaxed);
+}
+
+void BatchStatistics::on_timeout_executed(size_t requests, Clock::duration duration) {
+    m_timeout_execution_us.update(to_us(duration));
+    m_timeouts.fetch_add(1, std::memory_order_relaxed);
+    m_timeout_requests.fetch_add(requests, std::memory_order_relaxed);
+}
+
+std::chrono::microseconds BatchStatistics::get_timeout(size_t collected,
+                                                       size_t batch_size,
+                                                       uint32_t latency_slo,
+                                                       uint32_t max_timeout,
+                                                       Clock::time_point now) {
+    const int64_t max_timeout_us = static_cast<int64_t>(max_timeout) * 1000;
+    int64_t timeout_us = max_timeout_us;
+    // with no requests collected there is nothing to flush, the first arrival wakes the worker up
+    if (latency_slo && collected) {
+        // the first request of the batch must complete within the objective, including the batch execution
+        const auto first_arrival_ns = m_first_arrival.load(std::memory_order_relaxed);
+        const auto waited_us = std::max<int64_t>(to_ns(now) - first_arrival_ns, 0) / 1000;
+        const auto budget_us = static_cast<double>(latency_slo) * 1000 - std::max(m_batch_execution_us.get(), 0.0) -
+                               static_cast<double>(waited_us);
+        const auto inter_arrival_us = m_inter_arrival_us.get();
+        const auto missing = batch_size > collected ? batch_size - collected : 0;
+        if (budget_us <= 0 || (inter_arrival_us >= 0 && missing * inter_arrival_us > budget_us)) {
+            // the batch is not expected to be collected in time, so waiting only adds to the latency
+            timeout_us = 0;
+        } else {
+            timeout_us = std::min(static_cast<int64_t>(budget_us), max_timeout_us);
+        }
+    }
+    m_timeout_us.store(static_cast<uint64_t>(timeout_us), std::memory_order_relaxed);
+    return std::chrono::microseconds(timeout_us);
+}
+
+std::map<std::string, uint64_t> BatchStatistics::merge(const std::vector<const BatchStatistics*>& statistics) {
+    std::map<std::string, uint64_t> result = {{"BATCHES_EXECUTED", 0},
+                                              {"REQUESTS_BATCHED", 0},
+                                              {"TIMEOUTS", 0},
+                                              {"REQUESTS_NOT_BATCHED", 0}};
+    struct Average {
+        double sum = 0;
+        size_t count = 0;
+        void add(double value) {
+            if (value >= 0) {
+                sum += value;
+                count++;
+            }
+        }
+        uint64_t get() const {
+            return count ? static_cast<uint64_t>(sum / count) : 0;
+        }
+    } inter_arrival, batch_execution, timeout_execution, timeout;
+    for (const auto* s : statistics) {
+        result["BATCHES_EXECUTED"] += s->m_batches.load(std::memory_order_relaxed);
+        result["REQUESTS_BATCHED"] += s->m_batched_requests.load(std::memory_order_relaxed);
+        result["TIMEOUTS"] += s->m_timeouts.load(std::memory_order_relaxed);
+        result["REQUESTS_NOT_BATCHED"] += s->m_timeout_requests.load(std::memory_order_relaxed);
+        inter_arrival.add(s->m_inter_arrival_us.get());
+        batch_execution.add(s->m_batch_execution_us.get());
+        timeout_execution.add(s->m_timeout_execution_us.get());
+        timeout.add(static_cast<double>(s->m_timeout_us.load(std::memory_order_relaxed)));
+    }
+    result["INTER_ARRIVAL_TIME_US"] = inter_arrival.get();
+    result["BATCH_EXECUTION_TIME_US"] = batch_execution.get();
+    result["NOT_BATCHED_EXECUTION_TIME_US"] = timeout_execution.get();
+    result["TIMEOUT_US"] = timeout.get();
+    return result;
+}
+
+}  // namespace autobatch_plugin
+}  // namespace ov
@@ -0,0 +1,84 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "plugin.hpp"
+
+namespace ov {
+namespace autobatch_plugin {
+
+/**
+ * @brief Exponentially weighted moving average which can be updated from several threads without locks
+ */
+class MovingAverage {
+public:
+    void update(double sample);
+    // returns a negative value if there were no samples yet
+    double get() const {
+        return m_value.load(std::memory_order_relaxed);
+    }
+
+private:
+    static constexpr double m_weight = 0.125;
+    std::atomic<double> m_value{-1.0};
+};
+
+/**
+ * @brief Online statistics of a worker request: the arrival rate of the requests and the execution time of the
+ * full and partial batches. They are used to choose the timeout to collect the batch which meets the latency objective.
+ */
+class BatchStatistics {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Registers the arrival of a request
+     * @param collected Number of the requests collected for the batch, including the arrived one
+     */
+    void on_arrival(size_t collected, Clock::time_point now = Clock::now());
+    void on_batch_executed(size_t requests, Clock::duration duration);
+    void on_timeout_executed(size_t requests, Clock::duration duration);
+
+    /**
+     * @brief Chooses the time to wait for the rest of the batch
+     * @param collected Number of the requests already collected for the batch
+     * @param batch_size Size of the batch
+     * @param latency_slo Latency objective in ms, zero means the fixed timeout
+     * @param max_timeout The upper bound of the timeout (ov::auto_batch_timeout) in ms
+     * @return Zero if the partial batch should be flushed immediately
+     */
+    std::chrono::microseconds get_timeout(size_t collected,
+                                          size_t batch_size,
+                                          uint32_t latency_slo,
+                                          uint32_t max_timeout,
+                                          Clock::time_point now = Clock::now());
+
+    /**
+     * @brief Merges the statistics of the worker requests into the ov::auto_batch_statistics value
+     */
+    static std::map<std::string, uint64_t> merge(const std::vector<const BatchStatistics*>& statistics);
+
+private:
+    MovingAverage m_inter_arrival_us;
+    MovingAverage m_batch_execution_us;
+    MovingAverage m_timeout_execution_us;
+    std::atomic<int64_t> m_last_arrival{0};
+    std::atomic<int64_t> m_first_arrival{0};
+    std::atomic<uint64_t> m_batches{0};
+    std::atomic<uint64_t> m_batched_requests{0};
+    std::atomic<uint64_t> m_timeouts{0};
+    std::atomic<uint64_t> m_timeout_requests{0};
+    std::atomic<uint64_t> m_timeout_us{0};
+};
+
+}  // namespace autobatch_plugin
+}  // namespace ov
@@ -29,6 +29,9 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
     auto time_out = config.find(ov::auto_batch_timeout.name());
     OPENVINO_ASSERT(time_out != config.end(), "No timeout property be set in config, default will be used!");
     m_time_out = time_out->second.as<std::uint32_t>();
+    auto latency_slo = config.find(ov::auto_batch_latency_slo.name());
+    if (latency_slo != config.end())
+        m_latency_slo = latency_slo->second.as<std::uint32_t>();
 }
 
 CompiledModel::~CompiledModel() {
@@ -63,12 +66,16 @@ CompiledModel::GetWorkerInferRequest() const {
         if (workerRequestPtr->_infer_request_batched._so == nullptr)
             workerRequestPtr->_infer_request_batched._so = m_compiled_model_with_batch._so;
         workerRequestPtr->_batch_size = m_device_info.device_batch_size;
+        workerRequestPtr->_tasks.set_capacity(workerRequestPtr->_batch_size);
         workerRequestPtr->_completion_tasks.resize(workerRequestPtr->_batch_size);
         workerRequestPtr->_is_wakeup = false;
         workerRequestPtr->_infer_request_batched->set_callback(
             [workerRequestPtr](std::exception_ptr exceptionPtr) mutable {
                 if (exceptionPtr)
                     workerRequestPtr->_exception_ptr = exceptionPtr;
+                workerRequestPtr->_statistics.on_batch_executed(
+                    workerRequestPtr->_batch_size,
+                    BatchStatistics::Clock::now() - workerRequestPtr->_start_time);
                 OPENVINO_ASSERT(workerRequestPtr->_completion_tasks.size() == (size_t)workerRequestPtr->_batch_size);
                 // notify the individual requests on the completion
                 for (int c = 0; c < workerRequestPtr->_batch_size; c++) {
@@ -84,7 +91,15 @@ CompiledModel::GetWorkerInferRequest() const {
                 std::cv_status status;
                 {
                     std::unique_lock<std::mutex> lock(workerRequestPtr->_mutex);
-                    status = workerRequestPtr->_cond.wait_for(lock, std::chrono::milliseconds(m_time_out));
+                    // the timeout is chosen under the lock, so the first arrival either is counted or wakes us up
+                    const uint32_t latency_slo = m_latency_slo;
+                    workerRequestPtr->_adaptive_timeout = latency_slo != 0;
+                    const auto timeout =
+                        workerRequestPtr->_statistics.get_timeout(workerRequestPtr->_tasks.size(),
+                                                                  workerRequestPtr->_batch_size,
+                                                                  latency_slo,
+                                                                  m_time_out);
+                    status = workerRequestPtr->_cond.wait_for(lock, timeout);
                     if ((status != std::cv_status::timeout) && (workerRequestPtr->_is_wakeup == false))
                         continue;
                     workerRequestPtr->_is_wakeup = false;
@@ -104,6 +119,7 @@ CompiledModel::GetWorkerInferRequest() const {
                             t.first->m_sync_request->m_batched_request_status =
                                 ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED;
                         }
+                        workerRequestPtr->_start_time = BatchStatistics::Clock::now();
                         workerRequestPtr->_infer_request_batched->start_async();
                     } else if ((status == std::cv_status::timeout) && sz) {
                         // timeout to collect the batch is over, have to execute the requests in the batch1 mode
@@ -112,6 +128,7 @@ CompiledModel::GetWorkerInferRequest() const {
                         std::atomic<int> arrived = {0};
                         std::promise<void> all_completed;
                         auto all_completed_future = all_completed.get_future();
+                        const auto start_time = BatchStatistics::Clock::now();
                         for (int n = 0; n < sz; n++) {
                             OPENVINO_ASSERT(workerRequestPtr->_tasks.try_pop(t));
                             t.first->m_request_without_batch->set_callback(
@@ -129,6 +146,8 @@ CompiledModel::GetWorkerInferRequest() const {
                             t.first->m_request_without_batch->start_async();
                         }
                         all_completed_future.get();
+                        workerRequestPtr->_statistics.on_timeout_executed(sz,
+                                                                          BatchStatistics::Clock::now() - start_time);
                         // now when all the tasks for this batch are completed, start waiting for the timeout again
                     }
                 }
@@ -170,11 +189,16 @@ void CompiledModel::set_property(const ov::AnyMap& properties) {
         if (property.first == ov::auto_batch_timeout.name()) {
             m_time_out = property.second.as<std::uint32_t>();
             m_config[ov::auto_batch_timeout.name()] = property.second.as<std::uint32_t>();
+        } else if (property.first == ov::auto_batch_latency_slo.name()) {
+            m_latency_slo = property.second.as<std::uint32_t>();
+            m_config[ov::auto_batch_latency_slo.name()] = property.second.as<std::uint32_t>();
         } else {
             OPENVINO_THROW("AutoBatching Compiled Model dosen't support property",
                            property.first,
-                           ". The only property that can be changed on the fly is the ",
-                           ov::auto_batch_timeout.name());
+                           ". The only properties that can be changed on the fly are the ",
+                           ov::auto_batch_timeout.name(),
+                           " and the ",
+                           ov::auto_batch_latency_slo.name());
         }
     }
 }
@@ -212,10 +236,21 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
                 ov::PropertyName{ov::optimal_number_of_infer_requests.name(), ov::PropertyMutability::RO},
                 ov::PropertyName{ov::model_name.name(), ov::PropertyMutability::RO},
                 ov::PropertyName{ov::execution_devices.name(), ov::PropertyMutability::RO},
-                ov::PropertyName{ov::auto_batch_timeout.name(), ov::PropertyMutability::RW}};
+                ov::PropertyName{ov::auto_batch_timeout.name(), ov::PropertyMutability::RW},
+                ov::PropertyName{ov::auto_batch_latency_slo.name(), ov::PropertyMutability::RW},
+                ov::PropertyName{ov::auto_batch_statistics.name(), ov::PropertyMutability::RO}};
         } else if (name == ov::auto_batch_timeout) {
             uint32_t time_out = m_time_out;
             return time_out;
+        } else if (name == ov::auto_batch_latency_slo) {
+            uint32_t latency_slo = m_latency_slo;
+            return latency_slo;
+        } else if (name == ov::auto_batch_statistics) {
+            std::vector<const BatchStatistics*> statistics;
+            std::lock_guard<std::mutex> lock(m_worker_requests_mutex);
+            for (const auto& worker : m_worker_requests)
+                statistics.push_back(&worker->_statistics);
+            return decltype(ov::auto_batch_statistics)::value_type{BatchStatistics::merge(statistics)};
         } else if (name == ov::device::properties) {
             ov::AnyMap all_devices = {};
             ov::AnyMap device_properties = {};
@@ -8,6 +8,7 @@
 #include <condition_variable>
 #include <thread>
 
+#include "batch_statistics.hpp"
 #include "openvino/runtime/iasync_infer_request.hpp"
 #include "openvino/runtime/icompiled_model.hpp"
 #include "openvino/runtime/threading/thread_safe_containers.hpp"
@@ -23,7 +24,9 @@ public:
     struct WorkerInferRequest {
         ov::SoPtr<ov::IAsyncInferRequest> _infer_request_batched;
         int _batch_size;
-        ov::threading::ThreadSafeQueueWithSize<std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task>>
+        // every request of the batch has at most one pending task, so the queue is bounded by the batch size
+        ov::threading::ThreadSafeBoundedMPMCQueue<
+            std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task>>
             _tasks;
         std::vector<ov::threading::Task> _completion_tasks;
         std::thread _thread;
@@ -31,6 +34,10 @@ public:
         std::mutex _mutex;
         std::exception_ptr _exception_ptr;
         bool _is_wakeup;
+        BatchStatistics _statistics;
+        BatchStatistics::Clock::time_point _start_time;
+        // the adaptive timeout is counted from the first arrival, so the worker is woken up by it
+        std::atomic_bool _adaptive_timeout{false};
     };
 
     CompiledModel(const std::shared_ptr<ov::Model>& model,
@@ -72,7 +79,8 @@ protected:
     mutable std::mutex m_worker_requests_mutex;
 
     mutable std::atomic_size_t m_num_requests_created = {0};
-    std::atomic<std::uint32_t> m_time_out = {0};  // in ms
+    std::atomic<std::uint32_t> m_time_out = {0};     // in ms
+    std::atomic<std::uint32_t> m_latency_slo = {0};  // in ms, zero disables the adaptive timeout
 
     const std::set<std::size_t> m_batched_inputs;
     const std::set<std::size_t> m_batched_outputs;
@@ -167,6 +167,7 @@ public:
 
         workerRequestPtr->_infer_request_batched = {m_async_infer_request_with_batch, {}};
         workerRequestPtr->_batch_size = batch_size;
+        workerRequestPtr->_tasks.set_capacity(batch_size);
         workerRequestPtr->_completion_tasks.resize(workerRequestPtr->_batch_size);
         workerRequestPtr->_infer_request_batched->set_callback([this](std::exception_ptr exceptionPtr) mutable {
             if (exceptionPtr)
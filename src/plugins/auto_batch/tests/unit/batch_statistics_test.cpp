@@ -0,0 +1,91 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "batch_statistics.hpp"
+
+using ov::mock_autobatch_plugin::BatchStatistics;
+using std::chrono::microseconds;
+using std::chrono::milliseconds;
+
+namespace {
+// registers the arrivals of the requests with the given interval, starting a new batch every batch_size requests
+BatchStatistics::Clock::time_point arrive(BatchStatistics& statistics,
+                                          size_t requests,
+                                          size_t batch_size,
+                                          microseconds interval,
+                                          BatchStatistics::Clock::time_point now = BatchStatistics::Clock::now()) {
+    for (size_t i = 0; i < requests; i++) {
+        now += interval;
+        statistics.on_arrival(i % batch_size + 1, now);
+    }
+    return now;
+}
+}  // namespace
+
+TEST(AutoBatchStatisticsTest, FixedTimeoutWithoutLatencyObjective) {
+    BatchStatistics statistics;
+    const auto now = arrive(statistics, 10, 4, microseconds(100));
+    EXPECT_EQ(statistics.get_timeout(2, 4, 0, 200, now), milliseconds(200));
+}
+
+TEST(AutoBatchStatisticsTest, WaitForFirstArrival) {
+    BatchStatistics statistics;
+    EXPECT_EQ(statistics.get_timeout(0, 4, 10, 200), milliseconds(200));
+}
+
+TEST(AutoBatchStatisticsTest, WaitWhileBatchIsExpectedInTime) {
+    BatchStatistics statistics;
+    statistics.on_batch_executed(4, milliseconds(2));
+    // the requests arrive every 100us, so the rest of the batch is expected well within the 10ms objective
+    const auto now = arrive(statistics, 9, 4, microseconds(100));
+    const auto timeout = statistics.get_timeout(1, 4, 10, 200, now);
+    EXPECT_GT(timeout, microseconds(0));
+    // the batch execution time is reserved from the objective
+    EXPECT_LE(timeout, milliseconds(8));
+}
+
+TEST(AutoBatchStatisticsTest, TimeoutIsBoundedByFixedOne) {
+    BatchStatistics statistics;
+    const auto now = arrive(statistics, 9, 4, microseconds(100));
+    EXPECT_EQ(statistics.get_timeout(1, 4, 1000, 5, now), milliseconds(5));
+}
+
+TEST(AutoBatchStatisticsTest, FlushWhenBatchIsNotExpectedInTime) {
+    BatchStatistics statistics;
+    statistics.on_batch_executed(4, milliseconds(2));
+    // the requests arrive every 5ms, so three more requests do not fit the 10ms objective
+    const auto now = arrive(statistics, 9, 4, milliseconds(5));
+    EXPECT_EQ(statistics.get_timeout(1, 4, 10, 200, now), microseconds(0));
+}
+
+TEST(AutoBatchStatisticsTest, FlushWhenBatchExecutionExceedsObjective) {
+    BatchStatistics statistics;
+    statistics.on_batch_executed(4, milliseconds(20));
+    const auto now = arrive(statistics, 9, 4, microseconds(100));
+    EXPECT_EQ(statistics.get_timeout(1, 4, 10, 200, now), microseconds(0));
+}
+
+TEST(AutoBatchStatisticsTest, TimeoutCountsFromFirstArrival) {
+    BatchStatistics statistics;
+    const auto first = arrive(statistics, 1, 4, microseconds(100));
+    const auto timeout = statistics.get_timeout(1, 4, 10, 200, first + milliseconds(4));
+    EXPECT_LE(timeout, milliseconds(6));
+}
+
+TEST(AutoBatchStatisticsTest, MergeStatistics) {
+    BatchStatistics first, second;
+    first.on_batch_executed(4, milliseconds(2));
+    second.on_batch_executed(4, milliseconds(4));
+    second.on_timeout_executed(3, milliseconds(1));
+    const auto merged = BatchStatistics::merge({&first, &second});
+    EXPECT_EQ(merged.at("BATCHES_EXECUTED"), 2);
+    EXPECT_EQ(merged.at("REQUESTS_BATCHED"), 8);
+    EXPECT_EQ(merged.at("TIMEOUTS"), 1);
+    EXPECT_EQ(merged.at("REQUESTS_NOT_BATCHED"), 3);
+    EXPECT_EQ(merged.at("BATCH_EXECUTION_TIME_US"), 3000);
+    EXPECT_EQ(merged.at("NOT_BATCHED_EXECUTION_TIME_US"), 1000);
+    EXPECT_EQ(merged.at("INTER_ARRIVAL_TIME_US"), 0);
+}
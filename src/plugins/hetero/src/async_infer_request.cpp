@@ -5,7 +5,10 @@
 #include "async_infer_request.hpp"
 
 struct RequestExecutor : ov::threading::ITaskExecutor {
-    explicit RequestExecutor(ov::SoPtr<ov::IAsyncInferRequest>& request) : m_request(request) {
+    RequestExecutor(ov::SoPtr<ov::IAsyncInferRequest>& request,
+                    std::shared_ptr<ov::threading::ITaskExecutor> stage_executor)
+        : m_request(request),
+          m_stage_executor(std::move(stage_executor)) {
         m_request->set_callback([this](std::exception_ptr exception_ptr) mutable {
             m_exception_ptr = std::move(exception_ptr);
             auto task = std::move(m_task);
@@ -14,21 +17,39 @@ struct RequestExecutor : ov::threading::ITaskExecutor {
     }
     void run(ov::threading::Task task) override {
         m_task = std::move(task);
-        m_request->start_async();
+        if (!m_stage_executor) {
+            m_request->start_async();
+            return;
+        }
+        m_stage_executor->run([this] {
+            try {
+                m_request->start_async();
+            } catch (...) {
+                // the request is not started, so the pipeline is continued here to report the error
+                m_exception_ptr = std::current_exception();
+                auto task = std::move(m_task);
+                task();
+            }
+        });
     };
     ov::SoPtr<ov::IAsyncInferRequest>& m_request;
+    std::shared_ptr<ov::threading::ITaskExecutor> m_stage_executor;
     std::exception_ptr m_exception_ptr;
     ov::threading::Task m_task;
 };
 
-ov::hetero::AsyncInferRequest::AsyncInferRequest(const std::shared_ptr<ov::hetero::InferRequest>& request,
-                                                 const std::shared_ptr<ov::threading::ITaskExecutor>& task_executor,
-                                                 const std::shared_ptr<ov::threading::ITaskExecutor>& callback_executor)
+ov::hetero::AsyncInferRequest::AsyncInferRequest(
+    const std::shared_ptr<ov::hetero::InferRequest>& request,
+    const std::shared_ptr<ov::threading::ITaskExecutor>& task_executor,
+    const std::shared_ptr<ov::threading::ITaskExecutor>& callback_executor,
+    const std::vector<std::shared_ptr<ov::threading::ITaskExecutor>>& stage_executors)
     : ov::IAsyncInferRequest(request, task_executor, callback_executor),
       m_infer_request(std::static_pointer_cast<ov::hetero::InferRequest>(request)) {
     m_pipeline.clear();
-    for (auto&& request : m_infer_request->m_subrequests) {
-        auto request_executor = std::make_shared<RequestExecutor>(request);
+    for (size_t i = 0; i < m_infer_request->m_subrequests.size(); ++i) {
+        auto request_executor = std::make_shared<RequestExecutor>(
+            m_infer_request->m_subrequests[i],
+            i < stage_executors.size() ? stage_executors[i] : nullptr);
         m_pipeline.emplace_back(request_executor, [request_executor] {
             if (nullptr != request_executor->m_exception_ptr) {
                 std::rethrow_exception(request_executor->m_exception_ptr);
@@ -4,6 +4,7 @@
 
 #include "compiled_model.hpp"
 
+#include <algorithm>
 #include <memory>
 
 #include "async_infer_request.hpp"
@@ -13,8 +14,11 @@
 #include "openvino/op/util/op_types.hpp"
 #include "openvino/pass/constant_folding.hpp"
 #include "openvino/pass/manager.hpp"
+#include "openvino/runtime/device_id_parser.hpp"
 #include "openvino/runtime/internal_properties.hpp"
 #include "openvino/runtime/properties.hpp"
+#include "openvino/runtime/system_conf.hpp"
+#include "openvino/runtime/threading/executor_manager.hpp"
 #include "openvino/util/common_util.hpp"
 #include "openvino/util/xml_parse_utils.hpp"
 #include "properties.hpp"
@@ -40,7 +44,9 @@ ov::hetero::CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model
 }
 
 void ov::hetero::CompiledModel::compile_model(const std::vector<ov::hetero::SubmodelInfo>& submodels) {
-    const bool add_exclusive = submodels.size() > 1;
+    // the pipelined stages must run concurrently, so they can't share the exclusive device executor
+    const bool pipelined = submodels.size() > 1 && m_cfg.pipeline_parallel();
+    const bool add_exclusive = submodels.size() > 1 && !pipelined;
     const auto& hetero_plugin = get_hetero_plugin();
     const auto& core = hetero_plugin->get_core();
     const auto& device_properties = m_cfg.get_device_properties();
@@ -48,6 +54,23 @@ void ov::hetero::CompiledModel::compile_model(const std::vector<ov::hetero::Subm
     m_compiled_submodels.clear();
     m_compiled_submodels.reserve(submodels.size());
 
+    // the CPU stages of the pipeline get the disjoint core groups (a socket per stage if there are enough sockets),
+    // otherwise every stage would occupy all the cores and the stages would compete instead of overlapping.
+    // The groups are kept disjoint by the CPU reservation, which holds the cores for the whole process until the
+    // compiled model is released, so other models compiled meanwhile don't get them. The groups are split by the core
+    // count and aren't aligned with the sockets if the stages outnumber them.
+    int cpu_stage_threads = 0;
+    if (pipelined) {
+        const auto cpu_stages = static_cast<int>(
+            std::count_if(submodels.begin(), submodels.end(), [](const ov::hetero::SubmodelInfo& submodel) {
+                return ov::DeviceIDParser(submodel.first).get_device_name() == "CPU";
+            }));
+        if (cpu_stages > 1) {
+            const auto sockets = ov::get_num_sockets();
+            cpu_stage_threads = std::max(ov::get_number_of_cpu_cores() / std::max(sockets, cpu_stages), 1);
+        }
+    }
+
     for (const auto& [device, sub_model] : submodels) {
         // get meta devices properties for the target device
         auto meta_devices = hetero_plugin->get_properties_per_device(device, device_properties);
@@ -56,6 +79,22 @@ void ov::hetero::CompiledModel::compile_model(const std::vector<ov::hetero::Subm
         auto device_config = meta_devices.at(device);
         device_config[ov::cache_dir.name()] = "";
 
+        // the stage setup is applied only if the user hasn't configured the threading of the stage device in any way,
+        // neither via the HETERO device properties nor via the core properties of the device
+        if (cpu_stage_threads > 0 && ov::DeviceIDParser(device).get_device_name() == "CPU") {
+            const bool user_threading = device_config.count(ov::inference_num_threads.name()) ||
+                                        device_config.count(ov::hint::enable_cpu_reservation.name()) ||
+                                        device_config.count(ov::hint::enable_cpu_pinning.name()) ||
+                                        core->get_property(device, ov::inference_num_threads) != 0 ||
+                                        core->get_property(device, ov::hint::enable_cpu_reservation) ||
+                                        !core->get_property(device, ov::hint::enable_cpu_pinning);
+            if (!user_threading) {
+                device_config[ov::inference_num_threads.name()] = cpu_stage_threads;
+                device_config[ov::hint::enable_cpu_reservation.name()] = true;
+                device_config[ov::hint::enable_cpu_pinning.name()] = true;
+            }
+        }
+
         // set exclusive_async_requests in case when model is split
         if (add_exclusive) {
             auto supported_internal_properties = core->get_property(device, ov::internal::supported_properties);
@@ -75,6 +114,20 @@ void ov::hetero::CompiledModel::compile_model(const std::vector<ov::hetero::Subm
         m_compiled_submodels.emplace_back(std::move(desc));
     }
     set_inputs_and_outputs();
+    create_stage_executors();
+}
+
+void ov::hetero::CompiledModel::create_stage_executors() {
+    m_stage_executors.clear();
+    if (m_compiled_submodels.size() < 2 || !m_cfg.pipeline_parallel()) {
+        return;
+    }
+    // every stage is started from its own thread, so a stage does not wait for the next stage to be enqueued and
+    // the device callback threads are not blocked by the input preparation of the next device
+    for (size_t i = 0; i < m_compiled_submodels.size(); ++i) {
+        m_stage_executors.push_back(get_plugin()->get_executor_manager()->get_idle_cpu_streams_executor(
+            ov::threading::IStreamsExecutor::Config{m_name + "_HeteroStage" + std::to_string(i), 1, 1}));
+    }
 }
 
 ov::hetero::CompiledModel::CompiledModel(std::istream& model,
@@ -168,6 +221,7 @@ ov::hetero::CompiledModel::CompiledModel(std::istream& model,
     }
     // clang-format on
     set_inputs_and_outputs();
+    create_stage_executors();
 }
 
 std::shared_ptr<ov::ISyncInferRequest> ov::hetero::CompiledModel::create_sync_infer_request() const {
@@ -180,7 +234,8 @@ std::shared_ptr<ov::IAsyncInferRequest> ov::hetero::CompiledModel::create_infer_
     auto async_infer_request = std::make_shared<ov::hetero::AsyncInferRequest>(
         std::static_pointer_cast<ov::hetero::InferRequest>(internal_request),
         get_task_executor(),
-        get_callback_executor());
+        get_callback_executor(),
+        m_stage_executors);
 
     return async_infer_request;
 }
@@ -255,11 +310,14 @@ ov::Any ov::hetero::CompiledModel::get_property(const std::string& name) const {
     } else if (ov::loaded_from_cache == name) {
         return decltype(ov::loaded_from_cache)::value_type{m_loaded_from_cache};
     } else if (ov::optimal_number_of_infer_requests == name) {
+        // the pipelined stages are busy only if every stage has its own requests in flight
+        const bool pipelined = !m_stage_executors.empty();
         unsigned int value = 0u;
         for (const auto& comp_model_desc : m_compiled_submodels) {
-            value = std::max(value,
-                             comp_model_desc.compiled_model->get_property(ov::optimal_number_of_infer_requests.name())
-                                 .as<unsigned int>());
+            const auto stage_value =
+                comp_model_desc.compiled_model->get_property(ov::optimal_number_of_infer_requests.name())
+                    .as<unsigned int>();
+            value = pipelined ? value + stage_value : std::max(value, stage_value);
         }
         return decltype(ov::optimal_number_of_infer_requests)::value_type{value};
     } else if (ov::execution_devices == name) {
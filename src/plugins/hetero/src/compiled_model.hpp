@@ -56,6 +56,8 @@ private:
 
     void set_inputs_and_outputs();
 
+    void create_stage_executors();
+
     Configuration m_cfg;
     std::string m_name;
     const bool m_loaded_from_cache;
@@ -69,6 +71,8 @@ private:
         ov::SoPtr<ov::ICompiledModel> compiled_model;
     };
     std::vector<CompiledModelDesc> m_compiled_submodels;
+    // per stage executors of the pipeline parallel execution, empty if the stages are executed in a chain
+    std::vector<std::shared_ptr<ov::threading::ITaskExecutor>> m_stage_executors;
 };
 }  // namespace hetero
 }  // namespace ov
@@ -69,4 +69,8 @@ ov::AnyMap Configuration::get_device_properties() const {
 
 bool Configuration::dump_dot_files() const {
     return std::getenv("OPENVINO_HETERO_VISUALIZE") != NULL;
+}
+
+bool Configuration::pipeline_parallel() const {
+    return modelDistributionPolicy.count(ov::hint::ModelDistributionPolicy::PIPELINE_PARALLEL) != 0;
 }
\ No newline at end of file
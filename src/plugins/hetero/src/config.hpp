@@ -34,6 +34,8 @@ struct Configuration {
 
     bool dump_dot_files() const;
 
+    bool pipeline_parallel() const;
+
     std::string device_priorities;
 
     std::set<ov::hint::ModelDistributionPolicy> modelDistributionPolicy = {};
@@ -99,6 +99,46 @@ TEST_F(HeteroTests, compile_with_device_properties_no_exclusive) {
     EXPECT_EQ(6, mock1_properties.at(ov::num_streams.name()).as<ov::streams::Num>());
 }
 
+TEST_F(HeteroTests, compile_pipeline_parallel_no_exclusive) {
+    ov::AnyMap config = {ov::device::priorities("MOCK0,MOCK1"),
+                         ov::hint::model_distribution_policy({ov::hint::ModelDistributionPolicy::PIPELINE_PARALLEL}),
+                         ov::device::properties("MOCK0", ov::num_streams(4))};
+    auto model = create_model_with_subtract_reshape();
+    auto compiled_model = core.compile_model(model, ov::test::utils::DEVICE_HETERO, config);
+    auto device_properties = compiled_model.get_property(ov::device::properties.name()).as<ov::AnyMap>();
+    ASSERT_TRUE(device_properties.count("MOCK0.0"));
+    auto mock0_properties = device_properties.at("MOCK0.0").as<ov::AnyMap>();
+    ASSERT_TRUE(mock0_properties.count(ov::num_streams.name()));
+    // the pipeline stages don't use the exclusive executor, so the streams are kept
+    EXPECT_EQ(4, mock0_properties.at(ov::num_streams.name()).as<ov::streams::Num>());
+}
+
+TEST_F(HeteroTests, infer_pipeline_parallel) {
+    ov::AnyMap config = {ov::device::priorities("MOCK0,MOCK1"),
+                         ov::hint::model_distribution_policy({ov::hint::ModelDistributionPolicy::PIPELINE_PARALLEL})};
+    auto model = create_model_with_subtract();
+    auto compiled_model = core.compile_model(model, ov::test::utils::DEVICE_HETERO, config);
+
+    std::vector<ov::InferRequest> requests;
+    std::vector<ov::Tensor> inputs;
+    for (size_t i = 0; i < 4; i++) {
+        requests.push_back(compiled_model.create_infer_request());
+        inputs.push_back(
+            create_and_fill_tensor(compiled_model.input().get_element_type(), compiled_model.input().get_shape()));
+        requests.back().set_input_tensor(inputs.back());
+    }
+    for (size_t iteration = 0; iteration < 3; iteration++) {
+        for (auto& request : requests)
+            request.start_async();
+        for (size_t i = 0; i < requests.size(); i++) {
+            requests[i].wait();
+            auto output_tensor = requests[i].get_output_tensor();
+            EXPECT_EQ(inputs[i].get_shape(), output_tensor.get_shape());
+            EXPECT_EQ(memcmp(inputs[i].data(), output_tensor.data(), inputs[i].get_byte_size()), 0);
+        }
+    }
+}
+
 TEST_F(HeteroTests, get_runtime_model) {
     ov::AnyMap config = {ov::device::priorities("MOCK0,MOCK1")};
     auto model = create_model_with_subtract_reshape();
@@ -5,22 +5,46 @@
 #include "async_infer_request.h"
 
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "openvino/runtime/iasync_infer_request.hpp"
 #include "openvino/runtime/iinfer_request.hpp"
+#include "openvino/runtime/properties.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
 #include "openvino/runtime/threading/itask_executor.hpp"
 
+namespace {
+
+// schedules the pipeline stage to the streams executor with the priority of the request
+struct PriorityStreamsExecutor : public ov::threading::ITaskExecutor {
+    PriorityStreamsExecutor(std::shared_ptr<ov::threading::IStreamsExecutor> executor, ov::hint::Priority priority)
+        : m_executor(std::move(executor)),
+          m_priority(priority) {}
+
+    void run(ov::threading::Task task) override {
+        m_executor->run_with_priority(std::move(task), m_priority);
+    }
+
+    std::shared_ptr<ov::threading::IStreamsExecutor> m_executor;
+    ov::hint::Priority m_priority;
+};
+
+}  // namespace
+
 ov::intel_cpu::AsyncInferRequest::AsyncInferRequest(
     const std::shared_ptr<IInferRequest>& request,
     const std::shared_ptr<ov::threading::ITaskExecutor>& task_executor,
     const std::shared_ptr<ov::threading::ITaskExecutor>& callback_executor,
-    const bool is_optimized_single_stream)
+    const bool is_optimized_single_stream,
+    const ov::hint::Priority priority)
     : ov::IAsyncInferRequest(request, task_executor, callback_executor),
       m_internal_request(request) {
     static_cast<SyncInferRequest*>(request.get())->set_async_request(this);
     m_stream_executor = std::dynamic_pointer_cast<ov::threading::IStreamsExecutor>(task_executor);
+    if (m_stream_executor && priority != ov::hint::Priority::MEDIUM && !m_pipeline.empty()) {
+        m_pipeline.front().first = std::make_shared<PriorityStreamsExecutor>(m_stream_executor, priority);
+    }
     m_infer_func = [this]() {
         ov::IAsyncInferRequest::infer();
     };
@@ -4,20 +4,36 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <utility>
 
-#include "lru_cache.h"
+#include "concurrent_lru_cache.h"
 
 namespace ov::intel_cpu {
 
+struct CacheStatistics {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+
+    CacheStatistics& operator+=(const CacheStatistics& rhs) {
+        hits += rhs.hits;
+        misses += rhs.misses;
+        evictions += rhs.evictions;
+        return *this;
+    }
+};
+
 class CacheEntryBase {
 public:
     enum class LookUpStatus : int8_t { Hit, Miss };
 
     virtual ~CacheEntryBase() = default;
+
+    [[nodiscard]] virtual CacheStatistics getStatistics() const = 0;
 };
 
 /**
@@ -25,13 +41,14 @@ public:
  * @tparam KeyType is a key type that must define hash() const method with return type convertible to size_t and define
  * comparison operator.
  * @tparam ValType is a type that must meet all the requirements to the std::unordered_map mapped type
- * @tparam ImplType is a type for the internal storage. It must provide put(KeyType, ValueType) and ValueType get(const
- * KeyType&) interface and must have constructor of type ImplType(size_t).
+ * @tparam ImplType is a type for the internal storage. It must provide put(KeyType, ValueType), ValueType get(const
+ * KeyType&) and uint64_t getEvictedCount() interface and must have constructor of type ImplType(size_t).
+ * getOrCreate() is thread safe as long as ImplType is thread safe.
  *
  * @note In this implementation default constructed value objects are treated as empty objects.
  */
 
-template <typename KeyType, typename ValType, typename ImplType = LruCache<KeyType, ValType>>
+template <typename KeyType, typename ValType, typename ImplType = ConcurrentLruCache<KeyType, ValType>>
 class CacheEntry : public CacheEntryBase {
 public:
     using ResultType = std::pair<ValType, LookUpStatus>;
@@ -50,6 +67,7 @@ public:
     ResultType getOrCreate(const KeyType& key, std::function<ValType(const KeyType&)> builder) {
         if (0 == _impl.getCapacity()) {
             // fast track
+            _misses.fetch_add(1, std::memory_order_relaxed);
             return {builder(key), CacheEntryBase::LookUpStatus::Miss};
         }
         auto retStatus = LookUpStatus::Hit;
@@ -57,15 +75,31 @@ public:
         auto retEmpty = ValType();
         if (retVal == retEmpty) {
             retStatus = LookUpStatus::Miss;
+            // concurrent misses of the same key may build the value several times, the last one is kept
             retVal = builder(key);
             if (retVal != retEmpty) {
                 _impl.put(key, retVal);
             }
+            _misses.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            _hits.fetch_add(1, std::memory_order_relaxed);
         }
         return {retVal, retStatus};
     }
 
+    [[nodiscard]] CacheStatistics getStatistics() const override {
+        CacheStatistics result;
+        result.hits = _hits.load(std::memory_order_relaxed);
+        result.misses = _misses.load(std::memory_order_relaxed);
+        result.evictions = _impl.getEvictedCount();
+        return result;
+    }
+
     ImplType _impl;
+
+private:
+    std::atomic<uint64_t> _hits{0};
+    std::atomic<uint64_t> _misses{0};
 };
 
 }  // namespace ov::intel_cpu
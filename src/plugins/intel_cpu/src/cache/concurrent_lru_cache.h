@@ -0,0 +1,291 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Thread safe preemptive cache with LRU eviction policy.
+ * The records are distributed between a number of independently locked shards by the key hash, so concurrent lookups
+ * of different keys rarely contend. Each shard keeps its records in a flat preallocated storage, which is indexed by
+ * an open addressing hash table and linked into an index based LRU list, so no memory is allocated per record.
+ * The LRU policy is applied per shard, i.e. the least recently used record of the shard the new key belongs to is
+ * evicted.
+ * @tparam Key is a key type that must define hash() const method with return type convertible to size_t and define
+ * comparison operator.
+ * @tparam Value is a type that must be copy constructible and copy assignable
+ */
+
+namespace ov::intel_cpu {
+
+template <typename Key, typename Value>
+class ConcurrentLruCache {
+public:
+    explicit ConcurrentLruCache(size_t capacity) : _capacity(capacity) {
+        if (0 == _capacity) {
+            return;
+        }
+        // keep a meaningful LRU window per shard
+        size_t numShards = 1;
+        while (numShards < maxShards && _capacity / (numShards * 2) >= minShardCapacity) {
+            numShards *= 2;
+        }
+        _shardMask = numShards - 1;
+        _shards = std::make_unique<Shard[]>(numShards);
+        for (size_t i = 0; i < numShards; ++i) {
+            _shards[i].init(_capacity / numShards + (i < _capacity % numShards ? 1 : 0));
+        }
+    }
+
+    /**
+     * @brief Puts the value associated with the key into the cache.
+     * @param key
+     * @param value
+     */
+    void put(const Key& key, const Value& val) {
+        if (0 == _capacity) {
+            return;
+        }
+        const size_t hash = key.hash();
+        auto& shard = shardOf(hash);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        if (shard.put(key, val, hash)) {
+            _evicted.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Searches a value associated with the key.
+     * @param key
+     * @return Value associated with the key or default constructed instance of the Value type.
+     */
+    Value get(const Key& key) {
+        if (0 == _capacity) {
+            return Value();
+        }
+        const size_t hash = key.hash();
+        auto& shard = shardOf(hash);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        return shard.get(key, hash);
+    }
+
+    /**
+     * @brief Evicts n least recently used cache records of every shard
+     * @param n number of records to be evicted, can be greater than capacity
+     */
+    void evict(size_t n) {
+        for (size_t i = 0; _shards && i <= _shardMask; ++i) {
+            std::lock_guard<std::mutex> lock(_shards[i].mutex);
+            _evicted.fetch_add(_shards[i].evict(n), std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Returns the current capacity value
+     * @return the current capacity value
+     */
+    [[nodiscard]] size_t getCapacity() const noexcept {
+        return _capacity;
+    }
+
+    /**
+     * @brief Returns the number of records evicted from the cache since its creation
+     */
+    [[nodiscard]] uint64_t getEvictedCount() const noexcept {
+        return _evicted.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Returns the current number of records in the cache
+     */
+    [[nodiscard]] size_t size() const {
+        size_t result = 0;
+        for (size_t i = 0; _shards && i <= _shardMask; ++i) {
+            std::lock_guard<std::mutex> lock(_shards[i].mutex);
+            result += _shards[i].size;
+        }
+        return result;
+    }
+
+private:
+    static constexpr size_t maxShards = 16;
+    static constexpr size_t minShardCapacity = 64;
+    static constexpr uint32_t npos = std::numeric_limits<uint32_t>::max();
+
+    struct Record {
+        std::optional<std::pair<Key, Value>> data;
+        size_t hash = 0;
+        uint32_t prev = npos;
+        uint32_t next = npos;
+    };
+
+    struct alignas(64) Shard {
+        void init(size_t shardCapacity) {
+            capacity = std::max<size_t>(shardCapacity, 1);
+            records.resize(capacity);
+            size_t tableSize = 1;
+            while (tableSize < capacity * 2) {
+                tableSize *= 2;
+            }
+            table.assign(tableSize, npos);
+            tableMask = tableSize - 1;
+        }
+
+        // returns the position of the key in the hash table or npos
+        size_t find(const Key& key, size_t hash) const {
+            for (size_t pos = hash & tableMask; table[pos] != npos; pos = (pos + 1) & tableMask) {
+                const auto& record = records[table[pos]];
+                if (record.hash == hash && record.data->first == key) {
+                    return pos;
+                }
+            }
+            return npos;
+        }
+
+        void link(uint32_t idx) {
+            records[idx].prev = npos;
+            records[idx].next = head;
+            if (head != npos) {
+                records[head].prev = idx;
+            }
+            head = idx;
+            if (tail == npos) {
+                tail = idx;
+            }
+        }
+
+        void unlink(uint32_t idx) {
+            auto& record = records[idx];
+            if (record.prev != npos) {
+                records[record.prev].next = record.next;
+            } else {
+                head = record.next;
+            }
+            if (record.next != npos) {
+                records[record.next].prev = record.prev;
+            } else {
+                tail = record.prev;
+            }
+        }
+
+        void touch(uint32_t idx) {
+            if (head != idx) {
+                unlink(idx);
+                link(idx);
+            }
+        }
+
+        // backward shift deletion keeps the probe sequences valid without tombstones
+        void eraseFromTable(size_t pos) {
+            table[pos] = npos;
+            for (size_t next = (pos + 1) & tableMask; table[next] != npos; next = (next + 1) & tableMask) {
+                const size_t ideal = records[table[next]].hash & tableMask;
+                if (((next - ideal) & tableMask) >= ((next - pos) & tableMask)) {
+                    table[pos] = table[next];
+                    table[next] = npos;
+                    pos = next;
+                }
+            }
+        }
+
+        void insertToTable(uint32_t idx) {
+            size_t pos = records[idx].hash & tableMask;
+            while (table[pos] != npos) {
+                pos = (pos + 1) & tableMask;
+            }
+            table[pos] = idx;
+        }
+
+        // returns the index of the released record
+        uint32_t evictOne() {
+            const uint32_t idx = tail;
+            eraseFromTable(find(records[idx].data->first, records[idx].hash));
+            unlink(idx);
+            records[idx].data.reset();
+            --size;
+            return idx;
+        }
+
+        size_t evict(size_t n) {
+            size_t evicted = 0;
+            for (; evicted < n && size > 0; ++evicted) {
+                freeList.push_back(evictOne());
+            }
+            return evicted;
+        }
+
+        Value get(const Key& key, size_t hash) {
+            const size_t pos = find(key, hash);
+            if (pos == npos) {
+                return Value();
+            }
+            touch(table[pos]);
+            return records[table[pos]].data->second;
+        }
+
+        // returns true if a record has been evicted
+        bool put(const Key& key, const Value& val, size_t hash) {
+            const size_t pos = find(key, hash);
+            if (pos != npos) {
+                touch(table[pos]);
+                records[table[pos]].data->second = val;
+                return false;
+            }
+
+            bool evicted = false;
+            uint32_t idx = npos;
+            if (!freeList.empty()) {
+                idx = freeList.back();
+                freeList.pop_back();
+            } else if (used < capacity) {
+                idx = static_cast<uint32_t>(used++);
+            } else {
+                idx = evictOne();
+                evicted = true;
+            }
+
+            records[idx].data.emplace(key, val);
+            records[idx].hash = hash;
+            insertToTable(idx);
+            link(idx);
+            ++size;
+            return evicted;
+        }
+
+        mutable std::mutex mutex;
+        std::vector<Record> records;
+        std::vector<uint32_t> table;
+        std::vector<uint32_t> freeList;
+        size_t tableMask = 0;
+        size_t capacity = 0;
+        size_t used = 0;
+        size_t size = 0;
+        uint32_t head = npos;
+        uint32_t tail = npos;
+    };
+
+    Shard& shardOf(size_t hash) {
+        // the low bits of the hash address the hash table of the shard, so pick the shard by the high bits of
+        // the mixed hash value
+        const auto mixed = static_cast<uint64_t>(hash) * 0x9E3779B97F4A7C15ULL;
+        return _shards[static_cast<size_t>(mixed >> 59) & _shardMask];
+    }
+
+    size_t _capacity;
+    size_t _shardMask = 0;
+    std::unique_ptr<Shard[]> _shards;
+    std::atomic<uint64_t> _evicted{0};
+};
+
+}  // namespace ov::intel_cpu
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 #include <list>
 #include <unordered_map>
 #include <utility>
@@ -15,7 +16,7 @@
  * comparison operator.
  * @tparam Value is a type that must meet all the requirements to the std::unordered_map mapped type
  *
- * @attention This cache implementation IS NOT THREAD SAFE!
+ * @attention This cache implementation IS NOT THREAD SAFE! See ConcurrentLruCache for the thread safe one.
  */
 
 namespace ov::intel_cpu {
@@ -75,6 +76,7 @@ public:
         for (size_t i = 0; i < n && !_lruList.empty(); ++i) {
             _cacheMapper.erase(_lruList.back().first);
             _lruList.pop_back();
+            ++_evicted;
         }
     }
 
@@ -86,6 +88,13 @@ public:
         return _capacity;
     }
 
+    /**
+     * @brief Returns the number of records evicted from the cache since its creation
+     */
+    [[nodiscard]] uint64_t getEvictedCount() const noexcept {
+        return _evicted;
+    }
+
 private:
     struct key_hasher {
         std::size_t operator()(const Key& k) const {
@@ -103,6 +112,7 @@ private:
     lru_list_type _lruList;
     std::unordered_map<Key, cache_map_value_type, key_hasher> _cacheMapper;
     size_t _capacity;
+    uint64_t _evicted = 0;
 };
 
 }  // namespace ov::intel_cpu
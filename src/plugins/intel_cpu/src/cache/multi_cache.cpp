@@ -5,9 +5,22 @@
 #include "multi_cache.h"
 
 #include <atomic>
+#include <mutex>
+#include <shared_mutex>
+
+#include "cache_entry.h"
 
 namespace ov::intel_cpu {
 
 std::atomic_size_t MultiCache::_typeIdCounter{0};
 
+CacheStatistics MultiCache::getStatistics() const {
+    CacheStatistics result;
+    std::shared_lock<std::shared_mutex> lock(_mutex);
+    for (const auto& item : _storage) {
+        result += item.second->getStatistics();
+    }
+    return result;
+}
+
 }  // namespace ov::intel_cpu
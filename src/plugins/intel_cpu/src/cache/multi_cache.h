@@ -7,6 +7,8 @@
 #include <atomic>
 #include <cstddef>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <type_traits>
 #include <unordered_map>
 
@@ -16,8 +18,7 @@ namespace ov::intel_cpu {
 
 /**
  * @brief Class that represent a preemptive cache for different key/value pair types.
- *
- * @attention This implementation IS NOT THREAD SAFE!
+ * The cache is thread safe, so it can be shared between the streams of a compiled model.
  */
 
 class MultiCache {
@@ -51,6 +52,15 @@ public:
         return entry->getOrCreate(key, std::move(builder));
     }
 
+    /**
+     * @brief Returns the lookup and eviction statistics accumulated over all the entries of the cache
+     */
+    [[nodiscard]] CacheStatistics getStatistics() const;
+
+    [[nodiscard]] size_t getCapacity() const noexcept {
+        return _capacity;
+    }
+
 private:
     template <typename T>
     size_t getTypeId();
@@ -59,6 +69,7 @@ private:
 
     static std::atomic_size_t _typeIdCounter;
     size_t _capacity;
+    mutable std::shared_mutex _mutex;
     std::unordered_map<size_t, EntryBasePtr> _storage;
 };
 
@@ -72,6 +83,14 @@ template <typename KeyType, typename ValueType>
 MultiCache::EntryPtr<KeyType, ValueType> MultiCache::getEntry() {
     using EntryType = EntryTypeT<KeyType, ValueType>;
     size_t id = getTypeId<EntryType>();
+    {
+        std::shared_lock<std::shared_mutex> lock(_mutex);
+        auto itr = _storage.find(id);
+        if (itr != _storage.end()) {
+            return std::static_pointer_cast<EntryType>(itr->second);
+        }
+    }
+    std::unique_lock<std::shared_mutex> lock(_mutex);
     auto itr = _storage.find(id);
     if (itr == _storage.end()) {
         auto result = _storage.insert({id, std::make_shared<EntryType>(_capacity)});
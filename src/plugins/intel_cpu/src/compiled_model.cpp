@@ -10,10 +10,14 @@
 #include <memory>
 #include <mutex>
 #include <ostream>
+#include <sstream>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
 #include "async_infer_request.h"
+#include "cache/cache_entry.h"
+#include "cache/multi_cache.h"
 #include "config.h"
 #include "graph.h"
 #include "graph_context.h"
@@ -30,6 +34,7 @@
 #include "openvino/runtime/isync_infer_request.hpp"
 #include "openvino/runtime/properties.hpp"
 #include "openvino/runtime/threading/cpu_message.hpp"
+#include "openvino/runtime/threading/cpu_streams_executor.hpp"
 #include "openvino/runtime/threading/cpu_streams_info.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
 #include "openvino/runtime/threading/itask_executor.hpp"
@@ -79,8 +84,10 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
       m_model(model),
       m_plugin(plugin),
       m_cfg{std::move(cfg)},
+      m_requestPriority{m_cfg.requestPriority},
       m_name{model->get_name()},
       m_loaded_from_cache(loaded_from_cache),
+      m_socketWeights(m_cfg.weightsReplicationPolicy),
       m_sub_memory_manager(std::move(sub_memory_manager)) {
     m_mutex = std::make_shared<std::mutex>();
     const auto& core = m_plugin->get_core();
@@ -116,6 +123,10 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
 
     m_optimized_single_stream = all_of(1, executor_config.get_streams(), executor_config.get_threads());
 
+    if (m_cfg.rtCacheSharing) {
+        m_sharedParamsCache = std::make_shared<MultiCache>(m_cfg.rtCacheCapacity);
+    }
+
     int streams = std::max(1, executor_config.get_streams());
     std::vector<Task> tasks;
     tasks.resize(streams);
@@ -202,7 +213,8 @@ CompiledModel::GraphGuard::Lock CompiledModel::get_graph() const {
                                                          m_socketWeights[socketId],
                                                          isQuantizedFlag,
                                                          streamsExecutor,
-                                                         m_sub_memory_manager);
+                                                         m_sub_memory_manager,
+                                                         m_sharedParamsCache);
                 }
 
                 const std::shared_ptr<const ov::Model> model = m_model;
@@ -234,7 +246,8 @@ std::shared_ptr<ov::IAsyncInferRequest> CompiledModel::create_infer_request() co
         std::make_shared<AsyncInferRequest>(std::static_pointer_cast<SyncInferRequest>(internal_request),
                                             get_task_executor(),
                                             get_callback_executor(),
-                                            m_optimized_single_stream);
+                                            m_optimized_single_stream,
+                                            m_requestPriority.load());
     if (m_has_sub_compiled_models) {
         std::vector<std::shared_ptr<IAsyncInferRequest>> requests;
         requests.reserve(m_sub_compiled_models.size());
@@ -260,6 +273,43 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
         return m_loaded_from_cache;
     }
 
+    if (name == ov::intel_cpu::cpu_runtime_cache_statistics) {
+        CacheStatistics statistics;
+        std::unordered_set<MultiCachePtr> caches;
+        for (auto&& graph : m_graphs) {
+            // the graph may be initialized by a stream at the same time
+            GraphGuard::Lock graph_lock{graph};
+            if (graph.IsReady()) {
+                caches.insert(graph.getGraphContext()->getParamsCache());
+            }
+        }
+        for (const auto& cache : caches) {
+            statistics += cache->getStatistics();
+        }
+        return decltype(ov::intel_cpu::cpu_runtime_cache_statistics)::value_type{{"hits", statistics.hits},
+                                                                                 {"misses", statistics.misses},
+                                                                                 {"evictions", statistics.evictions}};
+    }
+
+    if (name == ov::intel_cpu::request_priority) {
+        return decltype(ov::intel_cpu::request_priority)::value_type(m_requestPriority.load());
+    }
+
+    if (name == ov::intel_cpu::cpu_task_queue_statistics) {
+        decltype(ov::intel_cpu::cpu_task_queue_statistics)::value_type result;
+        if (auto executor = std::dynamic_pointer_cast<CPUStreamsExecutor>(m_task_executor)) {
+            for (const auto& [priority, statistics] : executor->get_wait_statistics()) {
+                std::stringstream prefix;
+                prefix << priority;
+                result[prefix.str() + "_TASKS"] = statistics.tasks;
+                result[prefix.str() + "_AVERAGE_WAIT_US"] =
+                    statistics.tasks ? statistics.total_wait_us / statistics.tasks : 0;
+                result[prefix.str() + "_MAX_WAIT_US"] = statistics.max_wait_us;
+            }
+        }
+        return result;
+    }
+
     Config engConfig = get_graph()._graph.getConfig();
     auto option = engConfig._config.find(name);
     if (option != engConfig._config.end()) {
@@ -407,6 +457,21 @@ void CompiledModel::export_model(std::ostream& modelStream) const {
     serializer << m_model;
 }
 
+void CompiledModel::set_property(const ov::AnyMap& properties) {
+    for (const auto& [key, value] : properties) {
+        if (key != ov::intel_cpu::request_priority.name()) {
+            OPENVINO_THROW_NOT_IMPLEMENTED("It's not possible to set property ",
+                                           key,
+                                           " of an already compiled model. "
+                                           "Set property to Core::compile_model during compilation");
+        }
+    }
+    // the properties are validated by the config of the plugin
+    Config config;
+    config.readProperties(properties);
+    m_requestPriority = config.requestPriority;
+}
+
 void CompiledModel::release_memory() {
     for (auto&& graph : m_graphs) {
         // try to lock mutex, since it may be already locked (e.g by an infer request)
@@ -13,6 +13,7 @@
 #include <utility>
 #include <vector>
 
+#include "cache/multi_cache.h"
 #include "config.h"
 #include "graph.h"
 #include "openvino/core/any.hpp"
@@ -56,10 +57,7 @@ public:
 
     ov::Any get_property(const std::string& name) const override;
 
-    void set_property([[maybe_unused]] const ov::AnyMap& properties) override {
-        OPENVINO_THROW_NOT_IMPLEMENTED("It's not possible to set property of an already compiled model. "
-                                       "Set property to Core::compile_model during compilation");
-    };
+    void set_property(const ov::AnyMap& properties) override;
 
     void release_memory() override;
 
@@ -81,12 +79,16 @@ private:
     std::shared_ptr<std::mutex> m_mutex;
     Config m_cfg;
     mutable std::atomic_int m_numRequests = {0};
+    // the priority of the requests created afterwards, the only property to be changed after the compilation
+    std::atomic<ov::hint::Priority> m_requestPriority;
     std::string m_name;
 
     const bool m_loaded_from_cache;
     // WARNING: Do not use m_graphs directly.
     mutable std::deque<GraphGuard> m_graphs;
     mutable SocketsWeights m_socketWeights;
+    // runtime parameters cache shared between the streams (see Config::rtCacheSharing)
+    MultiCachePtr m_sharedParamsCache;
 
     /* WARNING: Use get_graph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
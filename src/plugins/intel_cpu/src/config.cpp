@@ -274,6 +274,30 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
             // as zero that means disabling the cache
             rtCacheCapacity = std::max(val_i, 0);
             snippetsCacheCapacity = std::max(val_i, 0);
+        } else if (ov::intel_cpu::cpu_shape_infer_cache_capacity.name() == key) {
+            int val_i = -1;
+            try {
+                ov::Any value = val.as<std::string>();
+                val_i = value.as<int>();
+            } catch (const ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_shape_infer_cache_capacity.name(),
+                               ". Expected only integer numbers");
+            }
+            // any negative value will be treated as zero that means disabling the cache
+            shapeInferCacheCapacity = std::max(val_i, 0);
+        } else if (key == ov::intel_cpu::cpu_runtime_cache_sharing.name()) {
+            try {
+                rtCacheSharing = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_runtime_cache_sharing.name(),
+                               ". Expected only true/false.");
+            }
         } else if (ov::intel_cpu::denormals_optimization.name() == key) {
             try {
                 denormalsOptMode = val.as<bool>() ? DenormalsOptMode::DO_On : DenormalsOptMode::DO_Off;
@@ -453,6 +477,60 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
             } catch (ov::Exception&) {
                 OPENVINO_THROW("Wrong value for property key ", ov::intel_cpu::enable_sage_attn.name());
             }
+        } else if (key == ov::intel_cpu::parallel_branches.name()) {
+            try {
+                ov::Any value = val.as<std::string>();
+                int val_i = value.as<int>();
+                OPENVINO_ASSERT(val_i >= 0, "invalid value.");
+                parallelBranches = val_i;
+            } catch (const ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::parallel_branches.name(),
+                               ". Expected only non-negative integer numbers");
+            }
+        } else if (key == ov::intel_cpu::parallel_branches_core_partitioning.name()) {
+            try {
+                parallelBranchesCorePartitioning = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::parallel_branches_core_partitioning.name(),
+                               ". Expected only true/false.");
+            }
+        } else if (key == ov::intel_cpu::weights_replication_policy.name()) {
+            try {
+                weightsReplicationPolicy = val.as<ov::intel_cpu::WeightsReplicationPolicy>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::weights_replication_policy.name(),
+                               ". Expected values: ov::intel_cpu::WeightsReplicationPolicy::PER_SOCKET/REPLICATE/",
+                               "INTERLEAVE/SINGLE_COPY");
+            }
+        } else if (key == ov::intel_cpu::memory_planner.name()) {
+            try {
+                memoryPlanner = val.as<ov::intel_cpu::MemoryPlanner>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::memory_planner.name(),
+                               ". Expected values: ov::intel_cpu::MemoryPlanner::GREEDY/BEST_FIT/BEST_OF");
+            }
+        } else if (key == ov::intel_cpu::request_priority.name()) {
+            try {
+                requestPriority = val.as<ov::hint::Priority>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::request_priority.name(),
+                               ". Expected values: ov::hint::Priority::HIGH/MEDIUM/LOW");
+            }
         } else {
             OPENVINO_THROW("NotFound: Unsupported property ", key, " by CPU plugin.");
         }
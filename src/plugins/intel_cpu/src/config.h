@@ -13,6 +13,7 @@
 #include <string>
 #include <vector>
 
+#include "internal_properties.hpp"
 #include "openvino/core/any.hpp"
 #include "openvino/core/attribute_visitor.hpp"
 #include "openvino/core/type/element_type.hpp"
@@ -72,6 +73,8 @@ struct Config {
     size_t rtCacheCapacity = 5000UL;
 #endif
     size_t snippetsCacheCapacity = 5000UL;
+    bool rtCacheSharing = false;
+    size_t shapeInferCacheCapacity = 16UL;
 #if defined(OPENVINO_ARCH_X86_64)
     ov::element::Type kvCachePrecision = ov::element::u8;
     ov::element::Type keyCachePrecision = ov::element::u8;
@@ -86,6 +89,12 @@ struct Config {
     CacheQuantMode keyCacheQuantMode = CacheQuantMode::AUTO;
     CacheQuantMode valueCacheQuantMode = CacheQuantMode::AUTO;
     bool enableSageAttn = false;
+    int parallelBranches = 0;
+    bool parallelBranchesCorePartitioning = false;
+    ov::intel_cpu::WeightsReplicationPolicy weightsReplicationPolicy =
+        ov::intel_cpu::WeightsReplicationPolicy::PER_SOCKET;
+    ov::intel_cpu::MemoryPlanner memoryPlanner = ov::intel_cpu::MemoryPlanner::GREEDY;
+    ov::hint::Priority requestPriority = ov::hint::Priority::MEDIUM;
     ov::threading::IStreamsExecutor::Config streamExecutorConfig;
     int streams = 1;
     bool streamsChanged = false;
@@ -557,10 +557,11 @@ void StaticMemory::StaticMemoryBlock::unregisterMemory(Memory* memPtr) {
 }
 
 #if defined(__linux__)
-#    define MPOL_DEFAULT   0
-#    define MPOL_BIND      2
-#    define MPOL_MF_STRICT (1 << 0)
-#    define MPOL_MF_MOVE   (1 << 1)
+#    define MPOL_DEFAULT    0
+#    define MPOL_BIND       2
+#    define MPOL_INTERLEAVE 3
+#    define MPOL_MF_STRICT  (1 << 0)
+#    define MPOL_MF_MOVE    (1 << 1)
 #    if !defined(__NR_mbind)
 #        define NR_mbind 237
 #    else
@@ -602,10 +603,38 @@ bool mbind_move(void* data, size_t size, int targetNode) {
     }
     return true;
 }
+
+bool mbind_interleave(void* data, size_t size) {
+    const int numaNodes = ov::get_num_numa_nodes();
+    if (numaNodes < 2 || size == 0) {
+        return false;
+    }
+    uint64_t mask = 0;
+    for (int node = 0; node < numaNodes; ++node) {
+        const int realNode = ov::get_org_numa_id(node);
+        if (realNode >= 0 && realNode < static_cast<int>(sizeof(mask) * 8)) {
+            mask |= 1UL << realNode;
+        }
+    }
+    auto pagesize = getpagesize();
+    auto page_count = (size + pagesize - 1) / pagesize;
+    auto* pages = reinterpret_cast<char*>(  // NOLINT(performance-no-int-to-ptr)
+        ((reinterpret_cast<uintptr_t>(data)) & ~(static_cast<uintptr_t>(pagesize - 1))));
+    auto rc = mbind(pages, page_count * pagesize, MPOL_INTERLEAVE, &mask, sizeof(mask) * 8, MPOL_MF_MOVE);
+    if (rc < 0) {
+        DEBUG_LOG("mbind failed: ", strerror(errno));
+        return false;
+    }
+    return true;
+}
 #else
 bool mbind_move(void* data, size_t size, int targetNode) {
     return false;
 }
+
+bool mbind_interleave(void* data, size_t size) {
+    return false;
+}
 #endif
 
 bool mbind_move(const MemoryCPtr& mem, int numaNodeID) {
@@ -614,6 +643,10 @@ bool mbind_move(const MemoryCPtr& mem, int numaNodeID) {
     return mbind_move(data, size, numaNodeID);
 }
 
+bool mbind_interleave(const MemoryCPtr& mem) {
+    return mbind_interleave(mem->getData(), mem->getSize());
+}
+
 bool mbind_move(const dnnl::memory& mem, int numaNodeID) {
     if (!mem) {
         return true;
@@ -447,6 +447,9 @@ using StringMemoryPtr = std::shared_ptr<StringMemory>;
 bool mbind_move(void* data, size_t size, int targetNode);
 bool mbind_move(const MemoryCPtr& mem, int numaNodeID);
 bool mbind_move(const dnnl::memory& mem, int numaNodeID);
+// interleaves the memory pages between all the NUMA nodes
+bool mbind_interleave(void* data, size_t size);
+bool mbind_interleave(const MemoryCPtr& mem);
 
 MemoryPtr split_horizontal(const dnnl::engine& eng,
                            const MemoryPtr& src,
@@ -78,6 +78,7 @@
 
 #if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
 #    include <tbb/task.h>
+#    include <tbb/task_arena.h>
 #endif
 
 #if defined(__x86_64__) && defined(__linux__)
@@ -554,6 +555,8 @@ void Graph::CreatePrimitivesAndExecConstants() const {
         {
             OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, node->profiling.createPrimitive);
             DEBUG_LOG(*node);
+            // the node acquires the scratch pad of the branch lane it is going to be executed on
+            GraphContext::BranchLaneScope laneScope(m_parallelBranches ? m_parallelBranches->laneOf(node) : 0);
             node->createPrimitive();
         }
 
@@ -893,6 +896,7 @@ std::vector<size_t> Graph::CreateExecutionGraph() {
     std::tie(m_executableGraphNodes, m_executableSyncNodesInds) =
         ExtractExecutableNodesAndSyncPoints(syncNodesInds, graphNodes);
 
+    m_shapeInferCache.reset();
     if (hasDynNodes) {
         status = Status::ReadyDynamic;
         // Here we use the following heuristic: if the number of sync nodes is less than 10 times of the number of exec
@@ -904,6 +908,11 @@ std::vector<size_t> Graph::CreateExecutionGraph() {
         if (exec2sync < 10 || parallel_get_max_threads() < 2) {
             status = Status::ReadyDynamicSeq;
         }
+
+        const auto shapeInferCacheCapacity = getConfig().shapeInferCacheCapacity;
+        if (shapeInferCacheCapacity > 0 && ShapeInferCache::isApplicable(m_executableGraphNodes)) {
+            m_shapeInferCache = std::make_shared<ShapeInferCache>(m_executableGraphNodes, shapeInferCacheCapacity);
+        }
     } else {
         status = Status::ReadyStatic;
     }
@@ -911,6 +920,166 @@ std::vector<size_t> Graph::CreateExecutionGraph() {
     return syncNodesInds;
 }
 
+struct Graph::ParallelBranches {
+    // executable nodes ordered by levels, the nodes of the same level are independent of each other
+    std::vector<NodePtr> nodes;
+    // end index (exclusive) of every level in 'nodes'
+    std::vector<size_t> levelEnds;
+    // level of every node of the graph (including the non executable ones)
+    std::unordered_map<NodePtr, int> levels;
+    // lane the node is executed on within its level
+    std::unordered_map<NodePtr, int> lanes;
+    size_t numLanes = 1;
+    // streams for the lanes starting from the second one, the first lane uses the graph stream
+    std::vector<dnnl::stream> streams;
+#if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
+    // per lane arenas, used only when the stream threads are partitioned between the branches
+    std::vector<std::unique_ptr<tbb::task_arena>> arenas;
+#endif
+
+    [[nodiscard]] int laneOf(const NodePtr& node) const {
+        auto it = lanes.find(node);
+        return it == lanes.end() ? 0 : it->second;
+    }
+};
+
+std::shared_ptr<Graph::ParallelBranches> Graph::CreateParallelBranches(
+    const AllocationContext& allocationContext) const {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::CreateParallelBranches");
+    const auto maxThreads = parallel_get_max_threads();
+    const auto maxLanes = std::min(getConfig().parallelBranches, maxThreads);
+    // only static graphs are supported, since the memory is reused across the levels, not the nodes
+    if (maxLanes < 2 || status != Status::ReadyStatic || !allocationContext.syncPoints.empty()) {
+        return nullptr;
+    }
+
+    // a node, which modifies its input in-place, must wait for all the other consumers of this input
+    std::unordered_map<NodePtr, std::vector<NodePtr>> inPlaceReaders;
+    for (const auto& edge : graphEdges) {
+        const auto portChildEdges = edge->getParent()->getChildEdgesAtPort(edge->getInputNum());
+        if (portChildEdges.size() < 2) {
+            continue;
+        }
+        if (auto modifyingNode = edge->modifiedInPlace()) {
+            auto& readers = inPlaceReaders[modifyingNode];
+            for (const auto& peerEdge : portChildEdges) {
+                if (peerEdge != edge) {
+                    peerEdge->collectConsumers(readers);
+                }
+            }
+        }
+    }
+
+    const std::unordered_set<NodePtr> executableNodes(m_executableGraphNodes.begin(), m_executableGraphNodes.end());
+    auto branches = std::make_shared<ParallelBranches>();
+    // level the outputs of the node are available at
+    std::unordered_map<NodePtr, int> availableAt;
+    // the nodes with inner graphs are executed exclusively and raise the lowest level for all the subsequent nodes
+    int lowestLevel = 0;
+    int numLevels = 0;
+
+    // graph nodes are expected to be topologically sorted
+    for (const auto& node : graphNodes) {
+        // memory state nodes rely on the sequential execution order
+        if (any_of(node->getType(), Type::MemoryInput, Type::MemoryOutput)) {
+            return nullptr;
+        }
+
+        int level = lowestLevel;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            level = std::max(level, availableAt.at(node->getParentEdgeAt(i)->getParent()));
+        }
+        if (auto it = inPlaceReaders.find(node); it != inPlaceReaders.end()) {
+            for (const auto& reader : it->second) {
+                if (reader != node && branches->levels.count(reader)) {
+                    level = std::max(level, branches->levels.at(reader) + 1);
+                }
+            }
+        }
+
+        const auto& execRange = allocationContext.execIndex.at(node);
+        const bool hasInnerGraph = execRange.first != execRange.second;
+        if (hasInnerGraph) {
+            level = std::max(level, numLevels);
+            lowestLevel = level + 1;
+        }
+
+        const bool isExecutable = executableNodes.count(node) != 0;
+        branches->levels[node] = level;
+        availableAt[node] = isExecutable ? level + 1 : level;
+        if (isExecutable) {
+            numLevels = std::max(numLevels, level + 1);
+        }
+    }
+
+    std::vector<std::vector<NodePtr>> levels(numLevels);
+    // keep the sequential execution order within a level
+    for (const auto& node : m_executableGraphNodes) {
+        levels[branches->levels.at(node)].push_back(node);
+    }
+
+    size_t maxWidth = 0;
+    for (const auto& level : levels) {
+        for (size_t i = 0; i < level.size(); i++) {
+            branches->nodes.push_back(level[i]);
+            branches->lanes[level[i]] = static_cast<int>(i % maxLanes);
+        }
+        branches->levelEnds.push_back(branches->nodes.size());
+        maxWidth = std::max(maxWidth, level.size());
+    }
+
+    // the graph is a chain, nothing to execute in parallel
+    if (maxWidth < 2) {
+        return nullptr;
+    }
+
+    branches->numLanes = std::min(maxWidth, static_cast<size_t>(maxLanes));
+    for (size_t lane = 1; lane < branches->numLanes; lane++) {
+        branches->streams.emplace_back(getEngine());
+    }
+#if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
+    if (getConfig().parallelBranchesCorePartitioning) {
+        const auto threadsPerLane = std::max(1, maxThreads / static_cast<int>(branches->numLanes));
+        for (size_t lane = 0; lane < branches->numLanes; lane++) {
+            branches->arenas.emplace_back(std::make_unique<tbb::task_arena>(threadsPerLane));
+        }
+    }
+#endif
+
+    DEBUG_LOG("Graph ", GetName(), " parallel branches: ", numLevels, " levels, ", branches->numLanes, " lanes");
+
+    return branches;
+}
+
+/**
+ * Express the lifetime of the memory regions in levels of the parallel branches execution plan instead of
+ * the sequential execution indices, so the memory is never reused within a level of concurrently executed nodes.
+ * Nodes of the inner graphs inherit the level of the node owning the inner graph.
+ */
+static void RemapExecIndicesToLevels(AllocationContext& allocationContext,
+                                     const std::vector<NodePtr>& graphNodes,
+                                     const std::unordered_map<NodePtr, int>& levels) {
+    // execution ranges of the graph nodes are ordered and do not intersect
+    std::vector<std::pair<int, int>> rangeToLevel;
+    rangeToLevel.reserve(graphNodes.size());
+    for (const auto& node : graphNodes) {
+        rangeToLevel.emplace_back(allocationContext.execIndex.at(node).first, levels.at(node));
+    }
+
+    for (auto& entry : allocationContext.execIndex) {
+        auto& execRange = entry.second;
+        auto it = std::upper_bound(rangeToLevel.begin(),
+                                   rangeToLevel.end(),
+                                   execRange.first,
+                                   [](int execIndex, const std::pair<int, int>& range) {
+                                       return execIndex < range.first;
+                                   });
+        OPENVINO_ASSERT(it != rangeToLevel.begin(), "Cannot find the execution level of node: ", entry.first->getName());
+        const auto level = std::prev(it)->second;
+        execRange = {level, level};
+    }
+}
+
 static void ResolveInOutInPlaceEdges(const std::vector<EdgePtr>& edges) {
     for (const auto& edge : edges) {
         if (edge->getStatus() == Edge::Status::Uninitialized) {
@@ -1179,6 +1348,12 @@ void Graph::Allocate() {
     AllocationContext allocationContext;
     RegisterToAllocationContext(0, allocationContext);
 
+    m_parallelBranches = CreateParallelBranches(allocationContext);
+    if (m_parallelBranches) {
+        RemapExecIndicesToLevels(allocationContext, graphNodes, m_parallelBranches->levels);
+        status = Status::ReadyStaticParallel;
+    }
+
     const auto& edges = allocationContext.edges;
     InitEdgeStatus(edges);
 
@@ -1356,19 +1531,84 @@ void Graph::InferStatic(SyncInferRequest* request, int numaId) {
     }
 }
 
+void Graph::InferStaticParallel(SyncInferRequest* request, int numaId) {
+    const auto& branches = *m_parallelBranches;
+    size_t levelBegin = 0;
+    for (const auto levelEnd : branches.levelEnds) {
+        const auto levelWidth = levelEnd - levelBegin;
+        if (levelWidth == 1) {
+            ExecuteNodeWithCatch(branches.nodes[levelBegin], request, numaId);
+            levelBegin = levelEnd;
+            continue;
+        }
+
+        const auto numLanes = std::min(levelWidth, branches.numLanes);
+        // exceptions cannot leave a parallel region for some of the threading backends, so rethrow them afterwards
+        std::vector<std::exception_ptr> exceptions(numLanes);
+        auto executeLane = [&](size_t lane) {
+            GraphContext::BranchLaneScope laneScope(static_cast<int>(lane));
+            const auto& stream = lane == 0 ? m_stream : branches.streams[lane - 1];
+            try {
+                for (size_t i = levelBegin + lane; i < levelEnd; i += numLanes) {
+                    ExecuteNodeWithCatch(branches.nodes[i], stream, request, numaId);
+                }
+            } catch (...) {
+                exceptions[lane] = std::current_exception();
+            }
+        };
+
+        parallel_for(numLanes, [&](size_t lane) {
+#if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
+            if (!branches.arenas.empty()) {
+                branches.arenas[lane]->execute([&]() {
+                    executeLane(lane);
+                });
+                return;
+            }
+#endif
+            executeLane(lane);
+        });
+
+        for (const auto& exception : exceptions) {
+            if (exception) {
+                std::rethrow_exception(exception);
+            }
+        }
+
+        levelBegin = levelEnd;
+    }
+}
+
 namespace {
 
+void updateNodeShapes(const NodePtr& node, size_t index, ShapeInferCache* shapeInferCache) {
+    if (shapeInferCache) {
+        shapeInferCache->updateShapes(node, index);
+    } else {
+        node->updateShapes();
+    }
+}
+
+void updateNodeDynamicParams(const NodePtr& node, size_t index, ShapeInferCache* shapeInferCache) {
+    if (shapeInferCache) {
+        shapeInferCache->updateDynamicParams(node, index);
+    } else {
+        node->updateDynamicParams();
+    }
+}
+
 class UpdateNodesSeq {
 public:
-    explicit UpdateNodesSeq(std::vector<NodePtr>& executableGraphNodes)
-        : m_executableGraphNodes(executableGraphNodes) {}
+    explicit UpdateNodesSeq(std::vector<NodePtr>& executableGraphNodes, ShapeInferCache* shapeInferCache = nullptr)
+        : m_executableGraphNodes(executableGraphNodes),
+          m_shapeInferCache(shapeInferCache) {}
 
     void operator()(size_t stopIndx) {
         for (; prepareCounter < stopIndx; ++prepareCounter) {
             const auto& node = m_executableGraphNodes[prepareCounter];
             if (node->isDynamicNode()) {
-                node->updateShapes();
-                node->updateDynamicParams();
+                updateNodeShapes(node, prepareCounter, m_shapeInferCache);
+                updateNodeDynamicParams(node, prepareCounter, m_shapeInferCache);
             }
         }
     }
@@ -1376,6 +1616,7 @@ public:
 private:
     size_t prepareCounter = 0;
     std::vector<NodePtr>& m_executableGraphNodes;
+    ShapeInferCache* m_shapeInferCache;
 };
 
 #if (OV_THREAD == OV_THREAD_SEQ)
@@ -1386,14 +1627,15 @@ using UpdateNodes = UpdateNodesSeq;
 
 class UpdateNodesBase {
 public:
-    explicit UpdateNodesBase(std::vector<NodePtr>& executableGraphNodes)
-        : m_executableGraphNodes(executableGraphNodes) {}
+    explicit UpdateNodesBase(std::vector<NodePtr>& executableGraphNodes, ShapeInferCache* shapeInferCache = nullptr)
+        : m_executableGraphNodes(executableGraphNodes),
+          m_shapeInferCache(shapeInferCache) {}
     void updateShapes(size_t node_indx, size_t stop_indx) {
         try {
             for (size_t i = node_indx; i < stop_indx; i++) {
                 const auto& node = m_executableGraphNodes[i];
                 if (node->isDynamicNode()) {
-                    node->updateShapes();
+                    updateNodeShapes(node, i, m_shapeInferCache);
                 }
                 m_prepareCounter.store(i, std::memory_order_release);
             }
@@ -1413,10 +1655,10 @@ public:
             if (completion && local_counter == prepareCounter) {
                 break;
             }
-            while (local_counter < prepareCounter) {
-                const auto& node = m_executableGraphNodes[local_counter++];
+            for (; local_counter < prepareCounter; ++local_counter) {
+                const auto& node = m_executableGraphNodes[local_counter];
                 if (node->isDynamicNode()) {
-                    node->updateDynamicParams();
+                    updateNodeDynamicParams(node, local_counter, m_shapeInferCache);
                 }
             }
         }
@@ -1426,6 +1668,7 @@ protected:
     std::atomic<size_t> m_prepareCounter{0};
     std::atomic<bool> m_completion{false};
     std::vector<NodePtr>& m_executableGraphNodes;
+    ShapeInferCache* m_shapeInferCache;
 };
 
 // NOLINTBEGIN(misc-include-cleaner) tbb has multiple implicit includes, which are not supposed to be included directly
@@ -1597,19 +1840,29 @@ public:
     OV_ITT_SCOPED_TASK(ittScope, (node)->profiling.execute);    \
     DEBUG_LOG(*(node));
 
-inline void Graph::ExecuteNode(const NodePtr& node, SyncInferRequest* request, int numaId) const {
+inline void Graph::ExecuteNode(const NodePtr& node,
+                               const dnnl::stream& stream,
+                               SyncInferRequest* request,
+                               int numaId) const {
     if (request) {
         request->throw_if_canceled();
     }
 
-    node->execute(m_stream, numaId);
+    node->execute(stream, numaId);
 }
 
-inline void Graph::ExecuteNodeWithCatch(const NodePtr& node, SyncInferRequest* request, int numaId) const {
+inline void Graph::ExecuteNode(const NodePtr& node, SyncInferRequest* request, int numaId) const {
+    ExecuteNode(node, m_stream, request, numaId);
+}
+
+inline void Graph::ExecuteNodeWithCatch(const NodePtr& node,
+                                        const dnnl::stream& stream,
+                                        SyncInferRequest* request,
+                                        int numaId) const {
     VERBOSE_PERF_DUMP_ITT_DEBUG_LOG(itt::domains::intel_cpu, node, getConfig());
 
     try {
-        ExecuteNode(node, request, numaId);
+        ExecuteNode(node, stream, request, numaId);
     } catch (const ov::Cancelled&) {
         throw;
     } catch (const std::exception& exp) {
@@ -1617,6 +1870,10 @@ inline void Graph::ExecuteNodeWithCatch(const NodePtr& node, SyncInferRequest* r
     }
 }
 
+inline void Graph::ExecuteNodeWithCatch(const NodePtr& node, SyncInferRequest* request, int numaId) const {
+    ExecuteNodeWithCatch(node, m_stream, request, numaId);
+}
+
 template <typename UpdateStrategy>
 void Graph::InferDynamic(SyncInferRequest* request, int numaId, UpdateStrategy&& update) {
     size_t inferCounter = 0;
@@ -1650,14 +1907,23 @@ void Graph::Infer(SyncInferRequest* request) {
 
     switch (status) {
     case Status::ReadyDynamic:
-        InferDynamic(request, numaId, UpdateNodes(m_executableGraphNodes));
+        if (m_shapeInferCache) {
+            m_shapeInferCache->select(inputNodes);
+        }
+        InferDynamic(request, numaId, UpdateNodes(m_executableGraphNodes, m_shapeInferCache.get()));
         break;
     case Status::ReadyDynamicSeq:
-        InferDynamic(request, numaId, UpdateNodesSeq(m_executableGraphNodes));
+        if (m_shapeInferCache) {
+            m_shapeInferCache->select(inputNodes);
+        }
+        InferDynamic(request, numaId, UpdateNodesSeq(m_executableGraphNodes, m_shapeInferCache.get()));
         break;
     case Status::ReadyStatic:
         InferStatic(request, numaId);
         break;
+    case Status::ReadyStaticParallel:
+        InferStaticParallel(request, numaId);
+        break;
     default:
         OPENVINO_ASSERT(IsReady(),
                         "Wrong state of the ov::intel_cpu::Graph. Topology is not ready: ",
@@ -1749,6 +2015,7 @@ void Graph::GetPerfData(std::vector<ov::ProfilingInfo>& perfMap) const {
             pc.exec_type = node->getPrimitiveDescriptorType();
             pc.node_type = node->typeStr;
             perfMap.emplace_back(pc);
+            node->appendInternalPerfData(perfMap);
 
             for (const auto& fusedNode : node->fusedWith) {
                 getPerfMapFor(perfMap, fusedNode);
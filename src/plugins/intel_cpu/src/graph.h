@@ -26,6 +26,7 @@
 #include "openvino/runtime/so_ptr.hpp"
 #include "openvino/runtime/tensor.hpp"
 #include "proxy_mem_blk.h"
+#include "shape_infer_cache.h"
 #include "utils/general_utils.h"
 
 namespace ov::intel_cpu {
@@ -46,6 +47,7 @@ public:
         ReadyStatic = 2,
         ReadyDynamic = 3,
         ReadyDynamicSeq = 4,
+        ReadyStaticParallel = 5,
     };
 
     Graph() = default;
@@ -55,7 +57,7 @@ public:
     ~Graph();
 
     bool IsStatic() const {
-        return Status::ReadyStatic == status;
+        return any_of(status, Status::ReadyStatic, Status::ReadyStaticParallel);
     }
 
     bool IsDynamic() const {
@@ -295,6 +297,7 @@ protected:
         graphNodes.clear();
         graphEdges.clear();
         m_executableSyncNodesInds.clear();
+        m_parallelBranches.reset();
     }
     Status status{Status::NotReady};
 
@@ -346,7 +349,14 @@ protected:
      */
     void ExecuteNode(const NodePtr& node, SyncInferRequest* request = nullptr, int numaId = -1) const;
 
+    void ExecuteNodeWithCatch(const NodePtr& node,
+                              const dnnl::stream& stream,
+                              SyncInferRequest* request,
+                              int numaId) const;
+    void ExecuteNode(const NodePtr& node, const dnnl::stream& stream, SyncInferRequest* request, int numaId) const;
+
     void InferStatic(SyncInferRequest* request, int numaId);
+    void InferStaticParallel(SyncInferRequest* request, int numaId);
     template <typename UpdateStrategy>
     void InferDynamic(SyncInferRequest* request, int numaId, UpdateStrategy&& update);
 
@@ -360,6 +370,14 @@ private:
     void insertReorder(EdgePtr& edge, bool isOptimized, std::unordered_set<std::string>& uniqueLayerNames);
     void insertConvert(EdgePtr& edge);
 
+    struct ParallelBranches;
+    /**
+     * Build a dependency DAG of the executable nodes from the graph edges and split it into levels of independent
+     * nodes, which can be executed concurrently. Returns nullptr if the graph does not benefit from or does not
+     * support the parallel branches execution.
+     */
+    std::shared_ptr<ParallelBranches> CreateParallelBranches(const AllocationContext& allocationContext) const;
+
     std::vector<NodePtr> inputNodes;
     std::vector<NodePtr> outputNodes;
 
@@ -370,6 +388,11 @@ private:
     // non-executable (optimized out) nodes, such as Input, Reshape, etc.
     std::vector<NodePtr> m_executableGraphNodes;
     std::vector<size_t> m_executableSyncNodesInds;
+    // execution plan of the parallel branches mode (status ReadyStaticParallel)
+    std::shared_ptr<ParallelBranches> m_parallelBranches;
+    // shape inference results and prepared params of the dynamic nodes per the input shapes (status ReadyDynamic and
+    // ReadyDynamicSeq)
+    ShapeInferCachePtr m_shapeInferCache;
 
     GraphContext::CPtr m_context;
     dnnl::stream m_stream;
@@ -25,17 +25,19 @@ GraphContext::GraphContext(Config config,
                            WeightsSharing::Ptr w_cache,
                            bool isGraphQuantized,
                            ov::threading::IStreamsExecutor::Ptr streamExecutor,
-                           std::shared_ptr<SubMemoryManager> sub_memory_manager)
+                           std::shared_ptr<SubMemoryManager> sub_memory_manager,
+                           MultiCachePtr paramsCache)
     : m_config(std::move(config)),
       m_weightsCache(std::move(w_cache)),
-      m_rtParamsCache(std::make_shared<MultiCache>(m_config.rtCacheCapacity)),
+      // the cache may be shared between the streams of a compiled model
+      m_rtParamsCache(paramsCache ? std::move(paramsCache) : std::make_shared<MultiCache>(m_config.rtCacheCapacity)),
       m_snippetsParamsCache(std::make_shared<MultiCache>(m_config.snippetsCacheCapacity)),
       m_isGraphQuantizedFlag(isGraphQuantized),
       m_streamExecutor(std::move(streamExecutor)),
       m_subMemoryManager(std::move(sub_memory_manager)),
 
       m_memoryStatesRegister(std::make_shared<node::MemoryStatesRegister>()),
-      m_auxiliaryNetworkMemoryControl(std::make_shared<NetworkMemoryControl>()),
+      m_auxiliaryNetworkMemoryControl(std::make_shared<NetworkMemoryControl>(m_config.memoryPlanner)),
       m_memoryControl(m_auxiliaryNetworkMemoryControl->createMemoryControlUnit("main")) {
     if (m_streamExecutor) {
         m_cpuStreamExecutor = std::dynamic_pointer_cast<ov::threading::CPUStreamsExecutor>(m_streamExecutor);
@@ -51,6 +53,27 @@ GraphContext::GraphContext(Config config,
     for (int i = 0; i < numaNum; i++) {
         m_rtScratchPads.push_back(std::make_shared<DnnlScratchPad>(getEngine(), i));
     }
+    // the default lane uses the regular scratch pad
+    for (int i = 1; i < m_config.parallelBranches; i++) {
+        m_branchScratchPads.push_back(std::make_shared<DnnlScratchPad>(getEngine(), m_numaNodeId));
+    }
+}
+
+static int& branchLane() {
+    static thread_local int lane = 0;
+    return lane;
+}
+
+int GraphContext::getBranchLane() {
+    return branchLane();
+}
+
+GraphContext::BranchLaneScope::BranchLaneScope(int lane) : m_prevLane(branchLane()) {
+    branchLane() = lane;
+}
+
+GraphContext::BranchLaneScope::~BranchLaneScope() {
+    branchLane() = m_prevLane;
 }
 
 const dnnl::engine& GraphContext::getEngine() {
@@ -35,7 +35,8 @@ public:
                  WeightsSharing::Ptr w_cache,
                  bool isGraphQuantized,
                  ov::threading::IStreamsExecutor::Ptr streamExecutor = nullptr,
-                 std::shared_ptr<SubMemoryManager> sub_memory_manager = nullptr);
+                 std::shared_ptr<SubMemoryManager> sub_memory_manager = nullptr,
+                 MultiCachePtr paramsCache = nullptr);
 
     [[nodiscard]] const Config& getConfig() const {
         return m_config;
@@ -54,6 +55,10 @@ public:
     }
 
     [[nodiscard]] DnnlScratchPadPtr getScratchPad() const {
+        const auto lane = getBranchLane();
+        if (lane > 0 && static_cast<size_t>(lane) <= m_branchScratchPads.size()) {
+            return m_branchScratchPads[lane - 1];
+        }
         return m_rtScratchPads[m_numaNodeId];
     }
 
@@ -61,6 +66,29 @@ public:
         return m_rtScratchPads;
     }
 
+    [[nodiscard]] const std::vector<DnnlScratchPadPtr>& getBranchScratchPads() const {
+        return m_branchScratchPads;
+    }
+
+    /**
+     * Branch lane the current thread executes nodes for.
+     * Nodes executed concurrently in scope of the parallel branches execution must not share a scratch pad,
+     * so every lane except the default one (0) is served by a dedicated scratch pad
+     */
+    static int getBranchLane();
+
+    class BranchLaneScope {
+    public:
+        explicit BranchLaneScope(int lane);
+        ~BranchLaneScope();
+
+        BranchLaneScope(const BranchLaneScope&) = delete;
+        BranchLaneScope& operator=(const BranchLaneScope&) = delete;
+
+    private:
+        int m_prevLane;
+    };
+
     static const dnnl::engine& getEngine();
 
     [[nodiscard]] bool isGraphQuantized() const {
@@ -117,6 +145,8 @@ private:
     bool m_isGraphQuantizedFlag = false;
     // scratch pad per sub-stream
     std::vector<DnnlScratchPadPtr> m_rtScratchPads;
+    // scratch pad per additional branch lane (see Config::parallelBranches)
+    std::vector<DnnlScratchPadPtr> m_branchScratchPads;
     // stream executor for current graph
     ov::threading::IStreamsExecutor::Ptr m_streamExecutor;
     // cpu stream executor for current graph
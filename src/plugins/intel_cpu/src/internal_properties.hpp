@@ -6,6 +6,7 @@
 
 #include <cstdint>
 #include <istream>
+#include <map>
 #include <ostream>
 #include <string>
 
@@ -20,6 +21,28 @@ namespace ov::intel_cpu {
  */
 static constexpr Property<int32_t, PropertyMutability::RW> cpu_runtime_cache_capacity{"CPU_RUNTIME_CACHE_CAPACITY"};
 
+/**
+ * @brief Define whether the CPU runtime parameters cache is shared between all the streams of a compiled model
+ * @param true - one cache of cpu_runtime_cache_capacity records per CPU runtime parameter type for all the streams
+ * @param false - every stream has its own cache (default)
+ */
+static constexpr Property<bool, PropertyMutability::RW> cpu_runtime_cache_sharing{"CPU_RUNTIME_CACHE_SHARING"};
+
+/**
+ * @brief Defines for how many different input shapes the results of the shape inference of a dynamic graph and the
+ * executors prepared for them are kept per stream, so the shape inference and the executors preparation are skipped
+ * when the graph is executed with these input shapes again. Zero value disables the cache.
+ */
+static constexpr Property<int32_t, PropertyMutability::RW> cpu_shape_infer_cache_capacity{
+    "CPU_SHAPE_INFER_CACHE_CAPACITY"};
+
+/**
+ * @brief Read-only property to get the accumulated statistics of the CPU runtime parameters cache of a compiled model.
+ * The map contains "hits", "misses" and "evictions" counters summed over all the streams.
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> cpu_runtime_cache_statistics{
+    "CPU_RUNTIME_CACHE_STATISTICS"};
+
 /**
  * @brief Enum to define possible snippets mode hints.
  */
@@ -80,4 +103,137 @@ static constexpr Property<bool, PropertyMutability::RW> enable_tensor_parallel{"
  */
 static constexpr Property<bool, PropertyMutability::RW> enable_sage_attn{"ENABLE_SAGE_ATTN"};
 
+/**
+ * @brief Defines how many independent branches of a static graph can be executed concurrently within a single
+ * inference. Values 0 and 1 keep the default sequential node-by-node execution.
+ */
+static constexpr Property<int32_t, PropertyMutability::RW> parallel_branches{"CPU_PARALLEL_BRANCHES"};
+
+/**
+ * @brief Define whether the threads of a stream are partitioned between the concurrently executed branches
+ * @param true - each branch runs in its own task arena limited to its share of the stream threads
+ * @param false - the branches share the stream threads (default)
+ */
+static constexpr Property<bool, PropertyMutability::RW> parallel_branches_core_partitioning{
+    "CPU_PARALLEL_BRANCHES_CORE_PARTITIONING"};
+
+/**
+ * @brief Enum to define how the weights of a compiled model are placed on the multi-socket systems.
+ */
+enum class WeightsReplicationPolicy : uint8_t {
+    REPLICATE = 0,    //!<  A copy of the weights per socket bound to the NUMA node of the socket streams
+    INTERLEAVE = 1,   //!<  A single copy of the weights interleaved between all the NUMA nodes
+    SINGLE_COPY = 2,  //!<  A single copy of the weights placed on the NUMA node of the stream touching them first
+    PER_SOCKET = 3,   //!<  A copy of the weights per socket placed by the first touch, without explicit binding
+};
+
+/** @cond INTERNAL */
+inline std::ostream& operator<<(std::ostream& os, const WeightsReplicationPolicy& policy) {
+    switch (policy) {
+    case WeightsReplicationPolicy::REPLICATE:
+        return os << "REPLICATE";
+    case WeightsReplicationPolicy::INTERLEAVE:
+        return os << "INTERLEAVE";
+    case WeightsReplicationPolicy::SINGLE_COPY:
+        return os << "SINGLE_COPY";
+    case WeightsReplicationPolicy::PER_SOCKET:
+        return os << "PER_SOCKET";
+    default:
+        OPENVINO_THROW("Unsupported weights replication policy value");
+    }
+}
+
+inline std::istream& operator>>(std::istream& is, WeightsReplicationPolicy& policy) {
+    std::string str;
+    is >> str;
+    if (str == "REPLICATE") {
+        policy = WeightsReplicationPolicy::REPLICATE;
+    } else if (str == "INTERLEAVE") {
+        policy = WeightsReplicationPolicy::INTERLEAVE;
+    } else if (str == "SINGLE_COPY") {
+        policy = WeightsReplicationPolicy::SINGLE_COPY;
+    } else if (str == "PER_SOCKET") {
+        policy = WeightsReplicationPolicy::PER_SOCKET;
+    } else {
+        OPENVINO_THROW("Unsupported weights replication policy: ", str);
+    }
+    return is;
+}
+/** @endcond */
+
+/**
+ * @brief Define the placement of the weights on the multi-socket systems, which trades the memory footprint for the
+ * remote memory access latency.
+ * @param PER_SOCKET - every socket keeps its own copy of the weights, placed by the first touch (default)
+ * @param REPLICATE - every socket keeps its own copy of the weights, bound to the NUMA node of the socket streams
+ * @param INTERLEAVE - one copy of the weights, its pages are interleaved between the NUMA nodes
+ * @param SINGLE_COPY - one copy of the weights shared by all the sockets
+ */
+static constexpr Property<WeightsReplicationPolicy, PropertyMutability::RW> weights_replication_policy{
+    "CPU_WEIGHTS_REPLICATION_POLICY"};
+
+/**
+ * @brief Enum to define the algorithm placing the intermediate tensors of a graph in the common memory arena.
+ */
+enum class MemoryPlanner : uint8_t {
+    GREEDY = 0,    //!<  The biggest tensors first, a tensor is lifted up while it intersects the placed ones
+    BEST_FIT = 1,  //!<  The biggest tensors first, a tensor takes the smallest suitable gap between the placed ones
+    BEST_OF = 2,   //!<  Several orders of tensors are tried with both algorithms, the smallest arena is kept
+};
+
+/** @cond INTERNAL */
+inline std::ostream& operator<<(std::ostream& os, const MemoryPlanner& planner) {
+    switch (planner) {
+    case MemoryPlanner::GREEDY:
+        return os << "GREEDY";
+    case MemoryPlanner::BEST_FIT:
+        return os << "BEST_FIT";
+    case MemoryPlanner::BEST_OF:
+        return os << "BEST_OF";
+    default:
+        OPENVINO_THROW("Unsupported memory planner value");
+    }
+}
+
+inline std::istream& operator>>(std::istream& is, MemoryPlanner& planner) {
+    std::string str;
+    is >> str;
+    if (str == "GREEDY") {
+        planner = MemoryPlanner::GREEDY;
+    } else if (str == "BEST_FIT") {
+        planner = MemoryPlanner::BEST_FIT;
+    } else if (str == "BEST_OF") {
+        planner = MemoryPlanner::BEST_OF;
+    } else {
+        OPENVINO_THROW("Unsupported memory planner: ", str);
+    }
+    return is;
+}
+/** @endcond */
+
+/**
+ * @brief Define the algorithm placing the intermediate tensors of the static part of a graph in the memory arena,
+ * which trades the compilation time for the arena size.
+ * @param GREEDY - default
+ * @param BEST_FIT - usually faster on the big graphs
+ * @param BEST_OF - the smallest arena, the slowest one
+ */
+static constexpr Property<MemoryPlanner, PropertyMutability::RW> memory_planner{"CPU_MEMORY_PLANNER"};
+
+/**
+ * @brief Define the priority of the infer requests in the task queues of the streams executor. The requests take the
+ * value when they are created, so setting it to the compiled model affects the requests created afterwards.
+ * @param HIGH - the requests are executed before the queued requests of the lower priorities
+ * @param MEDIUM - default
+ * @param LOW - the requests are executed when there are no queued requests of the higher priorities
+ */
+static constexpr Property<ov::hint::Priority, PropertyMutability::RW> request_priority{"CPU_REQUEST_PRIORITY"};
+
+/**
+ * @brief Read-only property to get the statistics of the task queues of the streams executor per priority:
+ * HIGH/MEDIUM/LOW_TASKS, HIGH/MEDIUM/LOW_AVERAGE_WAIT_US and HIGH/MEDIUM/LOW_MAX_WAIT_US
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> cpu_task_queue_statistics{
+    "CPU_TASK_QUEUE_STATISTICS"};
+
 }  // namespace ov::intel_cpu
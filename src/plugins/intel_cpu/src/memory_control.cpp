@@ -200,6 +200,8 @@ private:
 
 class MemoryManagerStatic : public IMemoryManager {
 public:
+    explicit MemoryManagerStatic(MemoryPlanner planner) : m_planner(toSolverPlanner(planner)) {}
+
     void insert(const MemoryRegion& reg, [[maybe_unused]] const std::vector<size_t>& syncInds) override {
         OPENVINO_ASSERT(reg.size >= 0, getClassName(), ": got undefined block size");
         m_boxes.emplace_back(MemorySolver::Box{reg.start, reg.finish, reg.size, reg.id});
@@ -222,7 +224,7 @@ private:
             box.size = div_up(box.size, alignment);
         });
 
-        ov::MemorySolver staticMemSolver(boxes_to_process);
+        ov::MemorySolver staticMemSolver(boxes_to_process, m_planner);
         m_totalSize = static_cast<size_t>(staticMemSolver.solve()) * alignment;
 
         m_workspace = std::make_shared<MemoryBlockWithRelease>();
@@ -249,6 +251,20 @@ private:
         return "MemoryManagerStatic";
     }
 
+    static MemorySolver::Planner toSolverPlanner(MemoryPlanner planner) {
+        switch (planner) {
+        case MemoryPlanner::GREEDY:
+            return MemorySolver::Planner::GREEDY_POP_UP;
+        case MemoryPlanner::BEST_FIT:
+            return MemorySolver::Planner::BEST_FIT;
+        case MemoryPlanner::BEST_OF:
+            return MemorySolver::Planner::BEST_OF;
+        default:
+            OPENVINO_THROW("Unsupported memory planner");
+        }
+    }
+
+    MemorySolver::Planner m_planner;
     MemoryControl::MemorySolution m_blocks;
     std::vector<MemorySolver::Box> m_boxes;
     std::shared_ptr<MemoryBlockWithRelease> m_workspace;
@@ -516,12 +532,14 @@ MemoryControl::RegionHandlerPtr buildHandler(F&& f, Args&&... args) {
 
 }  // namespace
 
-MemoryControl::MemoryControl(std::string id) : m_id(std::move(id)) {
+MemoryControl::MemoryControl(std::string id, MemoryPlanner planner) : m_id(std::move(id)) {
     // init handlers
-    m_handlers.emplace_back(buildHandler<MemoryManagerStatic>([](const MemoryRegion& reg) {
-        return reg.size >= 0 && MemoryRegion::RegionType::VARIABLE == reg.type &&
-               MemoryRegion::AllocType::POD == reg.alloc_type;
-    }));
+    m_handlers.emplace_back(buildHandler<MemoryManagerStatic>(
+        [](const MemoryRegion& reg) {
+            return reg.size >= 0 && MemoryRegion::RegionType::VARIABLE == reg.type &&
+                   MemoryRegion::AllocType::POD == reg.alloc_type;
+        },
+        planner));
 
     // handler for static tensors
     m_handlers.emplace_back(buildHandler<MemoryManagerNonOverlappingSets>([](const MemoryRegion& reg) {
@@ -589,7 +607,7 @@ MemoryStatistics MemoryControl::dumpStatistics() const {
 #endif  // CPU_DEBUG_CAPS
 
 MemoryControl::Ptr NetworkMemoryControl::createMemoryControlUnit(std::string id) {
-    m_controlUnits.emplace_back(std::shared_ptr<MemoryControl>(new MemoryControl(std::move(id))));
+    m_controlUnits.emplace_back(std::shared_ptr<MemoryControl>(new MemoryControl(std::move(id), m_planner)));
     return m_controlUnits.back();
 }
 
@@ -14,6 +14,7 @@
 
 #include "cpu_memory.h"
 #include "edge.h"
+#include "internal_properties.hpp"
 
 namespace ov::intel_cpu {
 
@@ -67,7 +68,7 @@ public:
     }
 
 private:
-    explicit MemoryControl(std::string id);
+    MemoryControl(std::string id, MemoryPlanner planner);
     void insert(const MemoryRegion& region, const std::vector<size_t>& syncInds);
     [[nodiscard]] MemoryStatistics dumpStatistics() const;
 
@@ -80,7 +81,7 @@ private:
 
 class NetworkMemoryControl {
 public:
-    NetworkMemoryControl() = default;
+    explicit NetworkMemoryControl(MemoryPlanner planner = MemoryPlanner::GREEDY) : m_planner(planner) {}
     MemoryControl::Ptr createMemoryControlUnit(std::string id);
 
     void allocateMemory();
@@ -93,6 +94,7 @@ public:
     }
 
 private:
+    MemoryPlanner m_planner;
     std::vector<MemoryControl::Ptr> m_controlUnits;
 };
 
@@ -754,6 +754,24 @@ static void fetchRawMemory(const MemoryPtr& mem) {
     }
 }
 
+void Node::fetchOutputMemory() const {
+    for (auto&& edge : getChildEdges()) {
+        auto edge_ptr = edge.lock();
+        CPU_NODE_ASSERT(edge_ptr, " has null edge");
+        if (edge_ptr->inPlace(Edge::LOOK_UP)) {
+            continue;
+        }
+
+        auto mem = edge_ptr->getMemoryPtr();
+        CPU_NODE_ASSERT(mem, " has null output memory");
+
+        if (mem->getShape().hasZeroDims()) {
+            continue;
+        }
+        fetchRawMemory(mem);
+    }
+}
+
 void Node::updateShapes() {
     OPENVINO_ASSERT(isDynamicNode(),
                     "Node::updateShapes() is called to a static shape node of type: ",
@@ -772,28 +790,78 @@ void Node::updateShapes() {
                 return;
             }
 
-            for (auto&& edge : getChildEdges()) {
-                auto edge_ptr = edge.lock();
-                CPU_NODE_ASSERT(edge_ptr, " has null edge");
-                if (edge_ptr->inPlace(Edge::LOOK_UP)) {
-                    continue;
-                }
+            fetchOutputMemory();
+        }
+    } catch (const std::exception& exp) {
+        CPU_NODE_THROW(exp.what());
+    }
+}
 
-                auto mem = edge_ptr->getMemoryPtr();
-                CPU_NODE_ASSERT(mem, " has null output memory");
+void Node::updateShapes(ShapeInferRecord& record) {
+    OPENVINO_ASSERT(isShapeInferResultReusable(),
+                    "Node::updateShapes() with a shape inference record is called to a node of type: ",
+                    getTypeStr(),
+                    " with name: ",
+                    getName());
+    try {
+        if (needShapeInfer()) {
+            if (recordMatchesInputDims(record)) {
+                redefineOutputMemory(record.outputDims);
+                return;
+            }
 
-                if (mem->getShape().hasZeroDims()) {
-                    continue;
+            record.valid = false;
+            record.preparedParams.reset();
+            const size_t inputsNum = getParentEdges().size();
+            auto result = shapeInfer();
+            if (ShapeInferStatus::success == result.status) {
+                record.inputDims.resize(inputsNum);
+                for (size_t port = 0; port < inputsNum; ++port) {
+                    record.inputDims[port] = getParentEdgeAt(port)->getMemory().getStaticDims();
                 }
-                fetchRawMemory(mem);
+                record.outputDims = std::move(result.dims);
+                record.valid = true;
+                redefineOutputMemory(record.outputDims);
             }
+        } else {
+            fetchOutputMemory();
         }
     } catch (const std::exception& exp) {
         CPU_NODE_THROW(exp.what());
     }
 }
 
+bool Node::isShapeInferResultReusable() const {
+    // the reference implementation may defer the shape inference to the execution
+    if (!isDynamicNode() || !shapeInference || getType() == Type::Reference) {
+        return false;
+    }
+    return shapeInference->is_result_reusable() && EMPTY_PORT_MASK == shapeInference->get_port_mask() &&
+           !outputShapeDataDependency();
+}
+
+bool Node::recordMatchesInputDims(const ShapeInferRecord& record) const {
+    const size_t inputsNum = getParentEdges().size();
+    if (!record.valid || record.inputDims.size() != inputsNum) {
+        return false;
+    }
+    for (size_t port = 0; port < inputsNum; ++port) {
+        if (record.inputDims[port] != getParentEdgeAt(port)->getMemory().getStaticDims()) {
+            return false;
+        }
+    }
+    return true;
+}
+
 void Node::updateDynamicParams() {
+    prepareDynamicParams(nullptr);
+}
+
+void Node::updateDynamicParams(ShapeInferRecord& record) {
+    prepareDynamicParams(&record);
+}
+
+void Node::prepareDynamicParams(ShapeInferRecord* record) {
     OPENVINO_ASSERT(isDynamicNode(),
                     "Node::updateDynamicParams() is called to a static shape node of type: ",
                     getTypeStr(),
@@ -803,6 +871,12 @@ void Node::updateDynamicParams() {
         if (isExecutable()) {
             if (needPrepareParams()) {
                 OPENVINO_ASSERT(inputShapesDefined(), "Input shapes are not defined.");
+                // the state prepared for the same input shapes is restored without preparing it again
+                const bool reusable = record && isPreparedParamsReusable() && recordMatchesInputDims(*record);
+                if (reusable && record->preparedParams) {
+                    restorePreparedParams(record->preparedParams);
+                    return;
+                }
                 DEBUG_LOG(" prepareParams() on #",
                           getExecIndex(),
                           " ",
@@ -814,6 +888,9 @@ void Node::updateDynamicParams() {
                           " ",
                           getOriginalLayers());
                 prepareParams();
+                if (reusable) {
+                    record->preparedParams = savePreparedParams();
+                }
             }
         }
     } catch (const std::exception& e) {
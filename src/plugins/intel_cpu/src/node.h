@@ -40,6 +40,7 @@
 #include "openvino/core/node.hpp"
 #include "openvino/core/partial_shape.hpp"
 #include "openvino/core/type/element_type.hpp"
+#include "openvino/runtime/profiling_info.hpp"
 #include "perf_count.h"
 #include "utils/bit_util.hpp"
 #include "utils/debug_capabilities.h"
@@ -176,6 +177,35 @@ private:
     ExecutorFactoryLegacyPtr executorFactory;
 };
 
+/**
+ * @brief The state prepared by Node::prepareParams() for the specific input shapes (e.g. the executor)
+ */
+struct PreparedParams {
+    virtual ~PreparedParams() = default;
+};
+
+using PreparedParamsPtr = std::shared_ptr<PreparedParams>;
+
+/**
+ * @brief The prepared state consisting of the single executor
+ */
+template <typename T>
+struct PreparedExecutor : public PreparedParams {
+    explicit PreparedExecutor(std::shared_ptr<T> executor) : executor(std::move(executor)) {}
+
+    std::shared_ptr<T> executor;
+};
+
+/**
+ * @brief The output shapes inferred by the node for the specific input shapes and the state prepared for them
+ */
+struct ShapeInferRecord {
+    std::vector<VectorDims> inputDims;
+    std::vector<VectorDims> outputDims;
+    PreparedParamsPtr preparedParams;
+    bool valid = false;
+};
+
 class Node {
 public:
     Node(const Node&) = delete;
@@ -513,6 +543,11 @@ public:
 
     virtual std::string getPrimitiveDescriptorType() const;
 
+    /**
+     * @brief Appends the profiling entries of the internal stages of the node (if any) to the graph perf data
+     */
+    virtual void appendInternalPerfData([[maybe_unused]] std::vector<ov::ProfilingInfo>& perfMap) const {}
+
     PerfCount& PerfCounter() {
         return perfCounter;
     }
@@ -524,7 +559,25 @@ public:
     // is a temprorary solution, do it this way for now.
     void executeStatic(const dnnl::stream& strm, int numaId = -1);
     void updateShapes();
+    /**
+     * @brief Same as updateShapes(), but the shape inference is skipped if the input shapes match the ones kept in the
+     * record, the recorded output shapes are used instead. Otherwise the record is updated with the new result.
+     * Valid only if isShapeInferResultReusable() returns true.
+     */
+    void updateShapes(ShapeInferRecord& record);
+    /**
+     * @brief Tells whether the output shapes of the dynamic node are completely defined by its input shapes, so the
+     * result of the shape inference can be reused for the same input shapes
+     */
+    bool isShapeInferResultReusable() const;
     void updateDynamicParams();
+    /**
+     * @brief Same as updateDynamicParams(), but prepareParams() is skipped if the record holds the state prepared for
+     * the current input shapes, the state is restored instead. Otherwise the prepared state is kept in the record, if
+     * the node supports it (see savePreparedParams()).
+     * Valid only after updateShapes() with the same record.
+     */
+    void updateDynamicParams(ShapeInferRecord& record);
     void executeDynamic(const dnnl::stream& strm, int numaId = -1);
     virtual void redefineOutputMemory(const std::vector<VectorDims>& newOutputShapes);
     void redefineOutputMemory(size_t port, const VectorDims& new_output_shape) const;
@@ -867,6 +920,21 @@ protected:
         OPENVINO_THROW_NOT_IMPLEMENTED("[DS] prapareParams not implemented for node with type ",
                                        NameFromType(getType()));
     }
+    /**
+     * @brief Returns the state prepared by the last prepareParams() call, which is restored by restorePreparedParams()
+     * instead of calling prepareParams() for the same input shapes. The default nullptr means the state is not kept.
+     */
+    virtual PreparedParamsPtr savePreparedParams() const {
+        return nullptr;
+    }
+    virtual void restorePreparedParams([[maybe_unused]] const PreparedParamsPtr& params) {}
+    /**
+     * @brief Opt-out of keeping the prepared state for the nodes, whose state depends on more than the input shapes
+     * (e.g. on the input data)
+     */
+    virtual bool isPreparedParamsReusable() const {
+        return true;
+    }
 
     MemoryPtr getScratchPadMem(const MemoryDescPtr& desc) {
         if (!scratchpadMem || !scratchpadMem->getDesc().isCompatible(*desc)) {
@@ -899,6 +967,10 @@ private:
     }
 
     static bool isEdgesEmpty(const std::vector<EdgeWeakPtr>& edges);
+    // keeps the memory of the output edges in sync with their current shapes
+    void fetchOutputMemory() const;
+    bool recordMatchesInputDims(const ShapeInferRecord& record) const;
+    void prepareDynamicParams(ShapeInferRecord* record);
 
     std::vector<EdgeWeakPtr> parentEdges;
     std::vector<EdgeWeakPtr> childEdges;
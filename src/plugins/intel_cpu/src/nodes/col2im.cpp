@@ -4,6 +4,8 @@
 
 #include "col2im.h"
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
@@ -17,12 +19,12 @@
 #include "onednn/iml_type_mapper.h"
 #include "openvino/core/except.hpp"
 #include "openvino/core/node.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/type.hpp"
 #include "openvino/core/type/bfloat16.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/core/type/float16.hpp"
 #include "openvino/op/col2im.hpp"
-#include "openvino/reference/col2im.hpp"
 #include "selective_build.h"
 #include "shape_inference/shape_inference_cpu.hpp"
 
@@ -81,15 +83,69 @@ void Col2Im::executeDynamicImpl(const dnnl::stream& strm) {
 
 template <class T, class T_idx>
 void Col2Im::executeImpl() {
-    ov::reference::col2im<T, T_idx>(getSrcDataAtPortAs<const T>(0),
-                                    ov::Shape{getSrcMemoryAtPort(0)->getStaticDims()},
-                                    getSrcDataAtPortAs<const T_idx>(1),
-                                    getSrcDataAtPortAs<const T_idx>(2),
-                                    getDstDataAtPortAs<T>(0),
-                                    strides,
-                                    dilations,
-                                    padsBegin,
-                                    padsEnd);
+    const auto& dataDims = getSrcMemoryAtPort(0)->getStaticDims();
+    const auto* data = getSrcDataAtPortAs<const T>(0);
+    const auto* outputSize = getSrcDataAtPortAs<const T_idx>(1);
+    const auto* kernelSize = getSrcDataAtPortAs<const T_idx>(2);
+    auto* out = getDstDataAtPortAs<T>(0);
+
+    const bool isBatched = dataDims.size() == 3;
+    const auto batchCount = static_cast<int64_t>(isBatched ? dataDims[0] : 1);
+    const auto columnsPerBatch = static_cast<int64_t>(dataDims[isBatched ? 1 : 0]);
+    const int64_t kernelH = kernelSize[0];
+    const int64_t kernelW = kernelSize[1];
+    const int64_t kernelProduct = kernelH * kernelW;
+    const int64_t channelCount = columnsPerBatch / kernelProduct;
+    const int64_t outH = outputSize[0];
+    const int64_t outW = outputSize[1];
+    const auto strideH = static_cast<int64_t>(strides[0]);
+    const auto strideW = static_cast<int64_t>(strides[1]);
+    const auto dilationH = static_cast<int64_t>(dilations[0]);
+    const auto dilationW = static_cast<int64_t>(dilations[1]);
+    const auto padH = static_cast<int64_t>(padsBegin[0]);
+    const auto padW = static_cast<int64_t>(padsBegin[1]);
+    const auto padsH = padH + static_cast<int64_t>(padsEnd[0]);
+    const auto padsW = padW + static_cast<int64_t>(padsEnd[1]);
+    // the number of the blocks the kernel is applied to along each dimension
+    const int64_t blocksH = (outH + padsH - (dilationH * (kernelH - 1) + 1)) / strideH + 1;
+    const int64_t blocksW = (outW + padsW - (dilationW * (kernelW - 1) + 1)) / strideW + 1;
+
+    // the range of the blocks [first, last) whose element with the given kernel offset lands inside the image
+    auto getValidBlocks = [](int64_t blocks, int64_t size, int64_t stride, int64_t pad, int64_t offset) {
+        const int64_t shift = offset - pad;
+        const int64_t first = std::min(shift >= 0 ? 0 : (-shift + stride - 1) / stride, blocks);
+        const int64_t last = std::min(size - shift <= 0 ? 0 : (size - shift + stride - 1) / stride, blocks);
+        return std::make_pair(first, std::max(first, last));
+    };
+
+    // every image channel gathers its own columns, so the channels are accumulated in parallel without conflicts
+    parallel_for2d(batchCount, channelCount, [&](int64_t batch, int64_t channel) {
+        T* image = out + (batch * channelCount + channel) * outH * outW;
+        std::fill_n(image, outH * outW, T(0));
+        for (int64_t kh = 0; kh < kernelH; ++kh) {
+            const auto [firstH, lastH] = getValidBlocks(blocksH, outH, strideH, padH, kh * dilationH);
+            for (int64_t kw = 0; kw < kernelW; ++kw) {
+                const auto [firstW, lastW] = getValidBlocks(blocksW, outW, strideW, padW, kw * dilationW);
+                const int64_t column = (channel * kernelH + kh) * kernelW + kw;
+                const T* columnData = data + (batch * columnsPerBatch + column) * blocksH * blocksW;
+                const int64_t shiftW = kw * dilationW - padW;
+                for (int64_t blockH = firstH; blockH < lastH; ++blockH) {
+                    const T* src = columnData + blockH * blocksW;
+                    T* dst = image + (blockH * strideH - padH + kh * dilationH) * outW;
+                    if (strideW == 1) {
+                        // contiguous rows are accumulated with the vectorized loop
+                        for (int64_t blockW = firstW; blockW < lastW; ++blockW) {
+                            dst[blockW + shiftW] += src[blockW];
+                        }
+                    } else {
+                        for (int64_t blockW = firstW; blockW < lastW; ++blockW) {
+                            dst[blockW * strideW + shiftW] += src[blockW];
+                        }
+                    }
+                }
+            }
+        }
+    });
 }
 
 namespace {
@@ -217,6 +217,14 @@ void DepthToSpace::prepareParams() {
     execPtr = result.first;
 }
 
+PreparedParamsPtr DepthToSpace::savePreparedParams() const {
+    return std::make_shared<PreparedExecutor<DepthToSpaceExecutor>>(execPtr);
+}
+
+void DepthToSpace::restorePreparedParams(const PreparedParamsPtr& params) {
+    execPtr = std::static_pointer_cast<PreparedExecutor<DepthToSpaceExecutor>>(params)->executor;
+}
+
 DepthToSpace::DepthToSpaceExecutor::DepthToSpaceExecutor(const DepthToSpaceAttrs& attrs) {
     OPENVINO_ASSERT(
         any_of(attrs.layoutType, LayoutType::nCsp16c, LayoutType::nCsp8c, LayoutType::nspc, LayoutType::ncsp),
@@ -31,6 +31,8 @@ public:
     [[nodiscard]] bool created() const override;
 
     void prepareParams() override;
+    [[nodiscard]] PreparedParamsPtr savePreparedParams() const override;
+    void restorePreparedParams(const PreparedParamsPtr& params) override;
 
     enum Mode : uint8_t { BLOCKS_FIRST = 0, DEPTH_FIRST = 1 };
     struct DepthToSpaceAttrs {
@@ -57,6 +57,7 @@ public:
                     std::shared_ptr<std::unordered_map<std::string, MemoryPtr>> privateWeighCache = nullptr)
         : runtimeCache(graphContext->getParamsCache()),
           scratchPads(graphContext->getScratchPads()),
+          branchScratchPads(graphContext->getBranchScratchPads()),
           weightsCache(graphContext->getWeightsCache()),
           engine(graphContext->getEngine()),
           implPriorities(std::move(implPriorities)),
@@ -73,6 +74,10 @@ public:
     }
 
     [[nodiscard]] DnnlScratchPadPtr getScratchPad() const {
+        const auto lane = GraphContext::getBranchLane();
+        if (lane > 0 && static_cast<size_t>(lane) <= branchScratchPads.size()) {
+            return branchScratchPads[lane - 1];
+        }
         return scratchPads[curNumaNodeId];
     }
 
@@ -97,6 +102,7 @@ private:
     // since ExecutorContext is stored in Executor itself
     MultiCacheWeakPtr runtimeCache;
     std::vector<DnnlScratchPadPtr> scratchPads;
+    std::vector<DnnlScratchPadPtr> branchScratchPads;
     WeightsSharing::Ptr weightsCache;
     const dnnl::engine& engine;
     std::vector<impl_desc_type> implPriorities;
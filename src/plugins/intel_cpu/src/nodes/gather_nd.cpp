@@ -123,6 +123,14 @@ void GatherND::prepareParams() {
     execPtr = std::make_shared<GatherNDExecutor>(attrs);
 }
 
+PreparedParamsPtr GatherND::savePreparedParams() const {
+    return std::make_shared<PreparedExecutor<GatherNDExecutor>>(execPtr);
+}
+
+void GatherND::restorePreparedParams(const PreparedParamsPtr& params) {
+    execPtr = std::static_pointer_cast<PreparedExecutor<GatherNDExecutor>>(params)->executor;
+}
+
 GatherND::GatherNDExecutor::GatherNDExecutor(const GatherNDAttributes& attrs)
     : batchSize(std::accumulate(attrs.srcDims.begin(),
                                 attrs.srcDims.begin() + attrs.batchDims,
@@ -31,6 +31,8 @@ public:
 protected:
     void executeDynamicImpl(const dnnl::stream& strm) override;
     void prepareParams() override;
+    [[nodiscard]] PreparedParamsPtr savePreparedParams() const override;
+    void restorePreparedParams(const PreparedParamsPtr& params) override;
 
 private:
     struct GatherNDAttributes {
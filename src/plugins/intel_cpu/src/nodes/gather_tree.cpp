@@ -127,6 +127,14 @@ void GatherTree::prepareParams() {
     execPtr = std::make_shared<GatherTreeExecutor>(stepIdxDims, parentIdxDims, maxSeqLenDims, dstDims);
 }
 
+PreparedParamsPtr GatherTree::savePreparedParams() const {
+    return std::make_shared<PreparedExecutor<GatherTreeExecutor>>(execPtr);
+}
+
+void GatherTree::restorePreparedParams(const PreparedParamsPtr& params) {
+    execPtr = std::static_pointer_cast<PreparedExecutor<GatherTreeExecutor>>(params)->executor;
+}
+
 void GatherTree::executeDynamicImpl(const dnnl::stream& strm) {
     execute(strm);
 }
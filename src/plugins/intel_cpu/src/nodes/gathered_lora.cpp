@@ -0,0 +1,207 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "gathered_lora.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <oneapi/dnnl/dnnl_common.hpp>
+#include <string>
+#include <vector>
+
+#include "graph_context.h"
+#include "memory_desc/cpu_memory_desc.h"
+#include "node.h"
+#include "onednn/iml_type_mapper.h"
+#include "openvino/core/except.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/parallel.hpp"
+#include "openvino/core/type.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "ov_ops/gathered_lora.hpp"
+#include "shape_inference/shape_inference_pass_through.hpp"
+
+#ifdef OV_CPU_WITH_MLAS
+#    include "mlas/sgemm.hpp"
+#endif
+
+namespace ov::intel_cpu::node {
+
+bool GatheredLoRA::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        if (!ov::is_type<ov::op::internal::GatheredLora>(op)) {
+            errorMessage = "Unknown GatheredLoRA operation : " + std::string(op->get_type_info().name) +
+                           " with name '" + op->get_friendly_name() + "'";
+            return false;
+        }
+        if (op->get_input_partial_shape(0).rank() != 3) {
+            errorMessage = "Only 3D main flow input is supported";
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+GatheredLoRA::GatheredLoRA(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context)
+    : Node(op, context, PassThroughShapeInferFactory()) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        OPENVINO_THROW_NOT_IMPLEMENTED(errorMessage);
+    }
+}
+
+void GatheredLoRA::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty()) {
+        return;
+    }
+    // the adaptation is accumulated into the main flow, so the output reuses its memory when possible
+    addSupportedPrimDesc({{LayoutType::ncsp, ov::element::f32},
+                          {LayoutType::ncsp, ov::element::f32},
+                          {LayoutType::ncsp, ov::element::f32},
+                          {LayoutType::ncsp, ov::element::f32},
+                          {LayoutType::ncsp, ov::element::f32},
+                          {LayoutType::ncsp, ov::element::i32}},
+                         {{LayoutType::ncsp, ov::element::f32, false, 0}},
+                         impl_desc_type::ref_any);
+}
+
+namespace {
+
+// out[rows, N] += (x[rows, K] x a[rank, K]^T * alpha[rank]) x b[N, rank]^T
+void apply_adapter(const float* x,
+                   const float* a,
+                   const float* alpha,
+                   const float* b,
+                   float* out,
+                   size_t rows,
+                   size_t K,
+                   size_t N,
+                   size_t rank,
+                   float* scratch) {
+#ifdef OV_CPU_WITH_MLAS
+    const auto M = static_cast<int64_t>(rows);
+    const auto iK = static_cast<int64_t>(K);
+    const auto iN = static_cast<int64_t>(N);
+    const auto R = static_cast<int64_t>(rank);
+    mlas_sgemm("N", "T", M, R, iK, 1.0F, x, iK, a, iK, 0.0F, scratch, R);
+    parallel_for(rows, [&](size_t row) {
+        auto* t = scratch + row * rank;
+        for (size_t j = 0; j < rank; j++) {
+            t[j] *= alpha[j];
+        }
+    });
+    mlas_sgemm("N", "T", M, iN, R, 1.0F, scratch, R, b, R, 1.0F, out, iN);
+#else
+    parallel_for(rows, [&](size_t row) {
+        const auto* x_row = x + row * K;
+        auto* t = scratch + row * rank;
+        for (size_t j = 0; j < rank; j++) {
+            const auto* a_row = a + j * K;
+            float acc = 0.0F;
+            for (size_t k = 0; k < K; k++) {
+                acc += x_row[k] * a_row[k];
+            }
+            t[j] = acc * alpha[j];
+        }
+        auto* out_row = out + row * N;
+        for (size_t n = 0; n < N; n++) {
+            const auto* b_row = b + n * rank;
+            float acc = 0.0F;
+            for (size_t j = 0; j < rank; j++) {
+                acc += t[j] * b_row[j];
+            }
+            out_row[n] += acc;
+        }
+    });
+#endif
+}
+
+}  // namespace
+
+void GatheredLoRA::execute([[maybe_unused]] const dnnl::stream& strm) {
+    const auto& main_dims = getSrcMemoryAtPort(0)->getStaticDims();
+    const auto& a_dims = getSrcMemoryAtPort(2)->getStaticDims();
+    const size_t batch = main_dims[0];
+    const size_t seq = main_dims[1];
+    const size_t N = main_dims[2];
+    const size_t adapters = a_dims[0];
+    const size_t rank = a_dims[1];
+    const size_t K = a_dims[2];
+    // the rows of the LoRA input, alpha and the indices are addressed by the main flow rows and the adapter rank
+    const auto& x_dims = getSrcMemoryAtPort(1)->getStaticDims();
+    CPU_NODE_ASSERT(x_dims[0] == batch && x_dims[1] == seq && x_dims[2] == K,
+                    "has LoRA input shape incompatible with the main flow and the adapters");
+    const auto& alpha_dims = getSrcMemoryAtPort(3)->getStaticDims();
+    CPU_NODE_ASSERT(alpha_dims[0] == adapters && alpha_dims[1] == 1 && alpha_dims[2] == rank,
+                    "has alpha shape incompatible with the adapters");
+    const auto& b_dims = getSrcMemoryAtPort(4)->getStaticDims();
+    CPU_NODE_ASSERT(b_dims[0] == adapters && b_dims[1] == N && b_dims[2] == rank,
+                    "has B shape incompatible with the main flow and the adapters");
+    // a single index applies the same adapter to the whole batch
+    const size_t num_indices = getSrcMemoryAtPort(5)->getStaticDims()[0];
+    CPU_NODE_ASSERT(num_indices == batch || num_indices == 1,
+                    "has the number of indices different from the main flow batch");
+
+    const auto* main = getSrcDataAtPortAs<const float>(0);
+    auto* dst = getDstDataAtPortAs<float>(0);
+    if (dst != main) {
+        std::memcpy(dst, main, batch * seq * N * sizeof(float));
+    }
+    if (batch == 0 || seq == 0 || rank == 0) {
+        return;
+    }
+
+    const auto* x = getSrcDataAtPortAs<const float>(1);
+    const auto* a = getSrcDataAtPortAs<const float>(2);
+    const auto* alpha = getSrcDataAtPortAs<const float>(3);
+    const auto* b = getSrcDataAtPortAs<const float>(4);
+    const auto* indices = getSrcDataAtPortAs<const int32_t>(5);
+
+    auto adapter_of = [&](size_t row) -> int64_t {
+        int64_t idx = indices[num_indices == 1 ? 0 : row];
+        if (idx < 0) {
+            idx += static_cast<int64_t>(adapters);
+        }
+        return idx >= 0 && idx < static_cast<int64_t>(adapters) ? idx : -1;
+    };
+
+    // the rows sharing the adapter are usually adjacent (e.g. the requests of the same tenant), so the GEMMs run
+    // over the whole runs of such rows instead of the single rows
+    size_t max_run = 0;
+    for (size_t begin = 0, end = 0; begin < batch; begin = end) {
+        for (end = begin + 1; end < batch && adapter_of(end) == adapter_of(begin); end++) {
+        }
+        max_run = std::max(max_run, end - begin);
+    }
+    if (m_scratch.size() < max_run * seq * rank) {
+        m_scratch.resize(max_run * seq * rank);
+    }
+
+    for (size_t begin = 0, end = 0; begin < batch; begin = end) {
+        const auto idx = adapter_of(begin);
+        for (end = begin + 1; end < batch && adapter_of(end) == idx; end++) {
+        }
+        if (idx < 0) {
+            continue;
+        }
+        const auto i = static_cast<size_t>(idx);
+        apply_adapter(x + begin * seq * K,
+                      a + i * rank * K,
+                      alpha + i * rank,
+                      b + i * N * rank,
+                      dst + begin * seq * N,
+                      (end - begin) * seq,
+                      K,
+                      N,
+                      rank,
+                      m_scratch.data());
+    }
+}
+
+}  // namespace ov::intel_cpu::node
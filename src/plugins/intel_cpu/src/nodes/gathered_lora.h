@@ -0,0 +1,49 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <oneapi/dnnl/dnnl_common.hpp>
+#include <string>
+#include <vector>
+
+#include "cpu_types.h"
+#include "graph_context.h"
+#include "node.h"
+#include "openvino/core/node.hpp"
+
+namespace ov::intel_cpu::node {
+
+/**
+ * @brief Applies the adapter selected by the index of every batch row (see ov::op::internal::GatheredLora).
+ *
+ * The batch rows are grouped into the runs of the consecutive rows using the same adapter, and the LoRA GEMMs are
+ * executed once per run directly on the slices of the stacked adapter tables, so the gathered copies of the weights
+ * are never materialized.
+ */
+class GatheredLoRA : public Node {
+public:
+    GatheredLoRA(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context);
+
+    void getSupportedDescriptors() override {}
+    [[nodiscard]] bool created() const override {
+        return getType() == Type::GatheredLoRA;
+    }
+    [[nodiscard]] bool needPrepareParams() const override {
+        return false;
+    }
+    void executeDynamicImpl(const dnnl::stream& strm) override {
+        execute(strm);
+    }
+    void initSupportedPrimitiveDescriptors() override;
+    void execute(const dnnl::stream& strm) override;
+    static bool isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept;
+
+private:
+    // [rows, rank] intermediate result of the down projection
+    std::vector<float> m_scratch;
+};
+
+}  // namespace ov::intel_cpu::node
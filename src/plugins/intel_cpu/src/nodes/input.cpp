@@ -581,7 +581,9 @@ void Input::cloneBlobIfRequired() {
         // This is possible only in multistream case on multisocket machine.
         // TODO: don't clone blob for multisocket + multistream case if current stream is run on the numa node where
         // original weights are stored.
-        (!weightCache || context->getNumNumaNodes() == 1 || context->getCPUStreamExecutor()->get_streams_num() == 1);
+        (!weightCache || context->getNumNumaNodes() == 1 || context->getCPUStreamExecutor()->get_streams_num() == 1 ||
+         // all the sockets share a single copy of the weights anyway
+         context->getConfig().weightsReplicationPolicy == ov::intel_cpu::WeightsReplicationPolicy::SINGLE_COPY);
 
     memoryPtr = clone_is_not_needed ? std::make_shared<Memory>(getEngine(), memDesc, m_constOp->get_data_ptr())
                                     : std::const_pointer_cast<const IMemory>(
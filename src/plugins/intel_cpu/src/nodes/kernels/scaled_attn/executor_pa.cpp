@@ -1526,7 +1526,7 @@ struct MHA {
             const auto kv_block = item.kv_block_id;
             auto block_number =
                 block_indices.ptr<int32_t>()[block_indices_begins.ptr<int32_t>()[batch_in_seq] + kv_block];
-            if (block_number < 0) {
+            if (block_number < 0 || item.src_reorder_item >= 0) {
                 return;
             }
 
@@ -1612,6 +1612,34 @@ struct MHA {
             }
         });
 
+        // the cache blocks shared between sequences are packed once, copy them to the rest of the sequences
+        if (_workitems.shared_reorder_work_size() > 0) {
+            parallel_for2d_dynamic(reorder_work_count, Hk, [&](size_t w, size_t hk) {
+                constexpr bool q_cache_is_same = precision_of<DATA_TYPE>::value == VALUE_PREC;
+                const auto& item = _workitems.get_reorder_work_item(w);
+                if (item.src_reorder_item < 0) {
+                    return;
+                }
+                const auto& src = _workitems.get_reorder_work_item(item.src_reorder_item);
+                auto& qk_scratch_b = _helper._qk_scratch_b;
+                std::memcpy(qk_scratch_b.ptr_v(item.batch_in_reorder, item.kv_block_id, hk),
+                            qk_scratch_b.ptr_v(src.batch_in_reorder, src.kv_block_id, hk),
+                            qk_scratch_b.stride_bytes(2));
+                if (q_is_xf16 || !q_cache_is_same) {
+                    auto& wv_scratch_b = _helper._wv_scratch_b;
+                    if (_helper.AarchF16) {
+                        std::memcpy(wv_scratch_b.ptr_v(item.batch_in_reorder, hk, item.kv_block_id),
+                                    wv_scratch_b.ptr_v(src.batch_in_reorder, hk, src.kv_block_id),
+                                    wv_scratch_b.stride_bytes(2));
+                    } else {
+                        std::memcpy(wv_scratch_b.ptr_v(item.batch_in_reorder, item.kv_block_id, hk),
+                                    wv_scratch_b.ptr_v(src.batch_in_reorder, src.kv_block_id, hk),
+                                    wv_scratch_b.stride_bytes(2));
+                    }
+                }
+            });
+        }
+
         // loop along HK dimension: if mixed first/second token and elements count is enough, loop HK to reuse KV in the
         // CPU cache
         //    else if elements count is small, prefer to loop H to get more work to avoid thread imbalance
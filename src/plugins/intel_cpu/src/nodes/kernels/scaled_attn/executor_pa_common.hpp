@@ -8,6 +8,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <openvino/core/type/element_type.hpp>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -63,6 +64,7 @@ struct ReorderWorkItem {
     int32_t kv_block_id;       // block id in this kv cache seq
     int32_t block_number;      // block_number in global cache
     int32_t valid_block_len;
+    int32_t src_reorder_item;  // reorder item which packs the same cache block shared between sequences, -1 if none
 };
 struct WorkItems {
 private:
@@ -71,6 +73,9 @@ private:
     int32_t max_kv_len_in_reorder = 0;  // max kv len between first tokens
     int32_t max_batch_in_reorder = 0;
     int32_t total_kv_len = 0;
+    size_t shared_reorder_count = 0;
+    // cache block -> first reorder item packing it
+    std::unordered_map<int32_t, int32_t> packed_blocks;
 
 public:
     void reset([[maybe_unused]] const ov::intel_cpu::PlainTensor& query,
@@ -84,6 +89,8 @@ public:
         max_kv_len_in_reorder = 0;
         max_batch_in_reorder = 0;
         total_kv_len = 0;
+        shared_reorder_count = 0;
+        packed_blocks.clear();
         auto seq_cout = static_cast<int32_t>(past_lens.m_dims[0]);
         for (int32_t i = 0; i < seq_cout; i++) {
             auto q_len = subsequence_begins.ptr<int32_t>()[i + 1] - subsequence_begins.ptr<int32_t>()[i];
@@ -102,11 +109,23 @@ public:
                     int32_t valid_block_size =
                         block_id == (reorder_sub_work_count - 1) ? kv_len - block_id * block_size : block_size;
                     auto block_number = block_indices.ptr<int32_t>()[block_indices_begins.ptr<int32_t>()[i] + block_id];
+                    // the sequences with a common prefix (e.g. system prompt) reference the same cache blocks, such
+                    // block is packed once and copied for the rest of the sequences
+                    int32_t src_reorder_item = -1;
+                    if (block_number >= 0) {
+                        auto [it, inserted] =
+                            packed_blocks.emplace(block_number, static_cast<int32_t>(reorder_items.size()));
+                        if (!inserted && reorder_items[it->second].valid_block_len == valid_block_size) {
+                            src_reorder_item = it->second;
+                            shared_reorder_count++;
+                        }
+                    }
                     reorder_items.emplace_back(ReorderWorkItem{i,                     // batch_in_seq
                                                                max_batch_in_reorder,  // batch_in_reorder
                                                                block_id,              // kv_block_id
                                                                block_number,          // block_number
-                                                               valid_block_size});    // valid_block_len
+                                                               valid_block_size,      // valid_block_len
+                                                               src_reorder_item});    // src_reorder_item
                 }
 
                 // workitems for attention
@@ -136,6 +155,10 @@ public:
     [[nodiscard]] size_t reorder_work_size() const {
         return reorder_items.size();
     }
+    // number of reorder items which reuse the block packed by another item
+    [[nodiscard]] size_t shared_reorder_work_size() const {
+        return shared_reorder_count;
+    }
     [[nodiscard]] size_t get_reorder_max_batch_size() const {
         return static_cast<size_t>(max_batch_in_reorder);
     }
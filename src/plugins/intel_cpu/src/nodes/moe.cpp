@@ -0,0 +1,578 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "moe.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <oneapi/dnnl/dnnl_common.hpp>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "graph_context.h"
+#include "memory_desc/cpu_memory_desc.h"
+#include "node.h"
+#include "onednn/iml_type_mapper.h"
+#include "openvino/core/except.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/type.hpp"
+#include "openvino/core/type/bfloat16.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/core/type/float16.hpp"
+#include "shape_inference/shape_inference_cpu.hpp"
+#include "transformations/cpu_opset/x64/op/llm_mlp.hpp"
+#include "transformations/cpu_opset/x64/op/moe.hpp"
+#include "utils/general_utils.h"
+
+#if defined(OPENVINO_ARCH_X86_64)
+#    include <algorithm>
+#    include <cmath>
+#    include <common/utils.hpp>
+#    include <cstring>
+#    include <map>
+#    include <tuple>
+
+#    include "kernels/x64/brgemm_kernel.hpp"
+#    include "openvino/core/parallel.hpp"
+#    include "utils/plain_tensor.hpp"
+#endif
+
+namespace ov::intel_cpu::node {
+
+#if defined(OPENVINO_ARCH_X86_64)
+
+namespace {
+
+struct MoEBrgemmKey {
+    size_t M = 0UL;
+    size_t N = 0UL;
+    size_t K = 0UL;
+    size_t ldc = 0UL;
+    ov::element::Type in_type;
+
+    [[nodiscard]] size_t hash() const {
+        using namespace dnnl::impl;
+        size_t seed = 0;
+        seed = hash_combine(seed, M);
+        seed = hash_combine(seed, N);
+        seed = hash_combine(seed, K);
+        seed = hash_combine(seed, ldc);
+        seed = hash_combine(seed, in_type.hash());
+        return seed;
+    }
+    bool operator==(const MoEBrgemmKey& rhs) const {
+        return (rhs.M == M) && (rhs.N == N) && (rhs.K == K) && (rhs.ldc == ldc) && (rhs.in_type == in_type);
+    }
+};
+
+// output channels of the expert weights de-quantized & packed by one work item
+constexpr size_t OC_BLOCK = 64;
+
+constexpr float SQRT1_2 = 0.70710678118654752440F;
+
+inline float activation(LLMMLPNode::ACT_FN act, float x) {
+    if (act == LLMMLPNode::ACT_FN::SILU) {
+        return x / (1.0F + std::exp(-x));
+    }
+    return 0.5F * x * (1.0F + std::erf(x * SQRT1_2));
+}
+
+template <typename SRC, typename T>
+void convert_rows(const SRC* src, size_t count, T* dst) {
+    for (size_t i = 0; i < count; i++) {
+        dst[i] = static_cast<T>(static_cast<float>(src[i]));
+    }
+}
+
+// de-quantizes the rows [n0, n1) of the weight [N, K] of the expert into dst[n1 - n0, K]:
+// (w - zero_point) * scale with the per OC scales & zero points, the 4-bit values are packed low nibble first
+template <typename T>
+void dequantize_rows(const uint8_t* weight,
+                     ov::element::Type prec,
+                     size_t expert,
+                     size_t N,
+                     size_t K,
+                     size_t n0,
+                     size_t n1,
+                     const float* scales,
+                     const float* zero_points,
+                     T* dst) {
+    for (size_t n = n0; n < n1; n++, dst += K) {
+        const size_t oc = expert * N + n;
+        const size_t offset = oc * K;
+        switch (prec) {
+        case ov::element::f32:
+            convert_rows(reinterpret_cast<const float*>(weight) + offset, K, dst);
+            continue;
+        case ov::element::f16:
+            convert_rows(reinterpret_cast<const ov::float16*>(weight) + offset, K, dst);
+            continue;
+        case ov::element::bf16:
+            convert_rows(reinterpret_cast<const ov::bfloat16*>(weight) + offset, K, dst);
+            continue;
+        default:
+            break;
+        }
+
+        const float scale = scales[oc];
+        const float zp = zero_points ? zero_points[oc] : 0.0F;
+        switch (prec) {
+        case ov::element::u8: {
+            const auto* src = weight + offset;
+            for (size_t k = 0; k < K; k++) {
+                dst[k] = static_cast<T>((static_cast<float>(src[k]) - zp) * scale);
+            }
+            break;
+        }
+        case ov::element::i8: {
+            const auto* src = reinterpret_cast<const int8_t*>(weight) + offset;
+            for (size_t k = 0; k < K; k++) {
+                dst[k] = static_cast<T>((static_cast<float>(src[k]) - zp) * scale);
+            }
+            break;
+        }
+        case ov::element::u4:
+        case ov::element::i4: {
+            const bool is_signed = prec == ov::element::i4;
+            for (size_t k = 0; k < K; k++) {
+                const size_t idx = offset + k;
+                int32_t value = (idx & 1) ? (weight[idx >> 1] >> 4) : (weight[idx >> 1] & 0xF);
+                if (is_signed && value > 7) {
+                    value -= 16;
+                }
+                dst[k] = static_cast<T>((static_cast<float>(value) - zp) * scale);
+            }
+            break;
+        }
+        default:
+            OPENVINO_THROW("MoE: unsupported expert weight precision ", prec);
+        }
+    }
+}
+
+}  // namespace
+
+template <typename T>
+struct MoE::Executor : public MoE::ExecutorBase {
+    MoE* m_node;
+    MoENode::Config m_config;
+    GraphContext::CPtr m_context;
+
+    // (token, slot) pairs grouped by expert: rows [m_offsets[e], m_offsets[e + 1]) belong to the expert e
+    std::vector<size_t> m_offsets;
+    std::vector<size_t> m_row_pair;
+    std::vector<int64_t> m_pair_row;
+
+    PlainTensor m_src;  // [rows, hidden_size] gathered input of the experts
+    PlainTensor m_act;  // [rows, intermediate_size] act(gate) * up
+    PlainTensor m_dst;  // [rows, hidden_size] f32 output of the experts
+
+    // the uncompressed weights packed for brgemm once: [experts, OC blocks, packed B size]
+    PlainTensor m_packed_gate;
+    PlainTensor m_packed_up;
+    PlainTensor m_packed_down;
+
+    // per thread buffers
+    PlainTensor m_weight;     // [nthr, OC_BLOCK * K] de-quantized weight block of the compressed weights
+    PlainTensor m_packed;     // [nthr, 2, packed B size] gate & up (or down) weight blocks packed for brgemm
+    PlainTensor m_gemm_out;   // [nthr, 2, M_blk * OC_BLOCK] gate & up results
+    PlainTensor m_scratch_a;  // [nthr, scratch A size]
+    std::vector<float> m_wsp;
+    size_t m_wsp_size_per_thread = 0;
+
+    std::map<std::tuple<size_t, size_t, size_t, size_t>, std::shared_ptr<BrgemmKernel>> m_kernels;
+    size_t m_scratch_a_size = 0;
+    size_t m_packed_size = 0;
+
+    Executor(MoE* node, const MoENode::Config& config, GraphContext::CPtr context)
+        : m_node(node),
+          m_config(config),
+          m_context(std::move(context)) {
+        if (!m_config.weights_compressed) {
+            packWeights();
+        }
+    }
+
+    void dequantize(size_t port, size_t e, size_t N, size_t K, size_t n0, size_t n1, T* out) const {
+        const float* scales =
+            m_config.weights_compressed ? m_node->getSrcDataAtPortAs<const float>(port + 3) : nullptr;
+        const float* zero_points =
+            m_config.has_zero_points ? m_node->getSrcDataAtPortAs<const float>(port + 6) : nullptr;
+        dequantize_rows(m_node->getSrcDataAtPortAs<const uint8_t>(port),
+                        m_node->getOriginalInputPrecisionAtPort(port),
+                        e,
+                        N,
+                        K,
+                        n0,
+                        n1,
+                        scales,
+                        zero_points,
+                        out);
+    }
+
+    // the layout of the packed B does not depend on M, so the blocks are packed with the full M block kernels
+    void packWeights() {
+        const auto E = static_cast<size_t>(m_config.expert_num);
+        const auto H = static_cast<size_t>(m_config.hidden_size);
+        const auto I = static_cast<size_t>(m_config.intermediate_size);
+        const size_t M_blk = BrgemmKernel::get_mblk_size();
+
+        size_t gate_up_size = 0;
+        for (size_t n0 = 0; n0 < I; n0 += OC_BLOCK) {
+            const size_t nb = std::min(OC_BLOCK, I - n0);
+            prepareKernel(M_blk, nb, H, nb);
+            gate_up_size = std::max(gate_up_size, kernel(M_blk, nb, H, nb).get_scratch_b_size());
+        }
+        size_t down_size = 0;
+        for (size_t n0 = 0; n0 < H; n0 += OC_BLOCK) {
+            const size_t nb = std::min(OC_BLOCK, H - n0);
+            prepareKernel(M_blk, nb, I, H);
+            down_size = std::max(down_size, kernel(M_blk, nb, I, H).get_scratch_b_size());
+        }
+
+        const size_t I_blocks = div_up(I, OC_BLOCK);
+        const size_t H_blocks = div_up(H, OC_BLOCK);
+        m_packed_gate.resize<uint8_t>({E, I_blocks, gate_up_size});
+        m_packed_up.resize<uint8_t>({E, I_blocks, gate_up_size});
+        m_packed_down.resize<uint8_t>({E, H_blocks, down_size});
+
+        parallel_for2d(E, I_blocks, [&](size_t e, size_t b) {
+            const size_t n0 = b * OC_BLOCK;
+            const size_t nb = std::min(OC_BLOCK, I - n0);
+            std::vector<T> weight(nb * H);
+            auto& packer = kernel(M_blk, nb, H, nb);
+            dequantize(3, e, I, H, n0, n0 + nb, weight.data());
+            packer.copy_buffer_b(weight.data(), m_packed_gate.ptr<uint8_t>(e, b));
+            dequantize(4, e, I, H, n0, n0 + nb, weight.data());
+            packer.copy_buffer_b(weight.data(), m_packed_up.ptr<uint8_t>(e, b));
+        });
+        parallel_for2d(E, H_blocks, [&](size_t e, size_t b) {
+            const size_t n0 = b * OC_BLOCK;
+            const size_t nb = std::min(OC_BLOCK, H - n0);
+            std::vector<T> weight(nb * I);
+            dequantize(5, e, H, I, n0, n0 + nb, weight.data());
+            kernel(M_blk, nb, I, H).copy_buffer_b(weight.data(), m_packed_down.ptr<uint8_t>(e, b));
+        });
+    }
+
+    // C[M, N] (row stride ldc) = A[M, K] x B[N, K]^T
+    void prepareKernel(size_t M, size_t N, size_t K, size_t ldc) {
+        const auto key_tuple = std::make_tuple(M, N, K, ldc);
+        if (m_kernels.count(key_tuple)) {
+            return;
+        }
+        MoEBrgemmKey brg_key = {M, N, K, ldc, precision_of<T>::value};
+        auto builder = [](const MoEBrgemmKey& key) -> std::shared_ptr<BrgemmKernel> {
+            return std::make_shared<BrgemmKernel>(key.M, key.N, key.K, key.K, key.K, key.ldc, true, key.in_type);
+        };
+        auto result = m_context->getParamsCache()->getOrCreate(brg_key, builder);
+        OPENVINO_ASSERT(result.first, "MoE brgemm kernel creation fails");
+        m_scratch_a_size = std::max(m_scratch_a_size, result.first->get_scratch_a_size());
+        m_packed_size = std::max(m_packed_size, result.first->get_scratch_b_size());
+        m_kernels[key_tuple] = result.first;
+    }
+
+    [[nodiscard]] BrgemmKernel& kernel(size_t M, size_t N, size_t K, size_t ldc) const {
+        return *m_kernels.at(std::make_tuple(M, N, K, ldc));
+    }
+
+    void execute() override {
+        const auto E = static_cast<size_t>(m_config.expert_num);
+        const auto H = static_cast<size_t>(m_config.hidden_size);
+        const auto I = static_cast<size_t>(m_config.intermediate_size);
+        const auto& idx_dims = m_node->getSrcMemoryAtPort(1)->getStaticDims();
+        const size_t tokens = idx_dims[0];
+        const size_t topk = idx_dims[1];
+
+        const auto* src = m_node->getSrcDataAtPortAs<const T>(0);
+        const auto* indices = m_node->getSrcDataAtPortAs<const int32_t>(1);
+        const auto* routing = m_node->getSrcDataAtPortAs<const float>(2);
+        auto* dst = m_node->getDstDataAtPortAs<T>(0);
+
+        // counting sort keeps the order of the tokens inside every expert
+        m_offsets.assign(E + 1, 0);
+        for (size_t p = 0; p < tokens * topk; p++) {
+            const auto e = static_cast<size_t>(indices[p]);
+            if (e < E) {
+                m_offsets[e + 1]++;
+            }
+        }
+        for (size_t e = 0; e < E; e++) {
+            m_offsets[e + 1] += m_offsets[e];
+        }
+        const size_t rows = m_offsets[E];
+        m_row_pair.resize(rows);
+        m_pair_row.assign(tokens * topk, -1);
+        std::vector<size_t> cursor(m_offsets.begin(), m_offsets.end() - 1);
+        for (size_t p = 0; p < tokens * topk; p++) {
+            const auto e = static_cast<size_t>(indices[p]);
+            if (e < E) {
+                m_row_pair[cursor[e]] = p;
+                m_pair_row[p] = static_cast<int64_t>(cursor[e]++);
+            }
+        }
+        if (rows == 0) {
+            std::fill(dst, dst + tokens * H, T(0.0F));
+            return;
+        }
+
+        m_src.resize<T>({rows, H});
+        m_act.resize<T>({rows, I});
+        m_dst.resize<float>({rows, H});
+        parallel_for(rows, [&](size_t r) {
+            std::memcpy(m_src.ptr<T>(r), src + (m_row_pair[r] / topk) * H, H * sizeof(T));
+        });
+
+        // the kernels are looked up before the parallel sections, the params cache is not thread safe. They are kept
+        // between the calls, the M dimension takes at most M_blk values
+        const size_t M_blk = BrgemmKernel::get_mblk_size();
+        std::vector<std::pair<size_t, size_t>> gate_up_items;
+        std::vector<std::pair<size_t, size_t>> down_items;
+        for (size_t e = 0; e < E; e++) {
+            const size_t count = m_offsets[e + 1] - m_offsets[e];
+            if (count == 0) {
+                continue;
+            }
+            for (const size_t M : {std::min(count, M_blk), count % M_blk}) {
+                if (M == 0) {
+                    continue;
+                }
+                for (size_t n0 = 0; n0 < I; n0 += OC_BLOCK) {
+                    const size_t nb = std::min(OC_BLOCK, I - n0);
+                    prepareKernel(M, nb, H, nb);
+                }
+                for (size_t n0 = 0; n0 < H; n0 += OC_BLOCK) {
+                    prepareKernel(M, std::min(OC_BLOCK, H - n0), I, H);
+                }
+            }
+            for (size_t n0 = 0; n0 < I; n0 += OC_BLOCK) {
+                gate_up_items.emplace_back(e, n0);
+            }
+            for (size_t n0 = 0; n0 < H; n0 += OC_BLOCK) {
+                down_items.emplace_back(e, n0);
+            }
+        }
+
+        const bool prepacked = !m_config.weights_compressed;
+        const auto nthr = static_cast<size_t>(parallel_get_max_threads());
+        if (!prepacked) {
+            m_weight.resize<T>({nthr, OC_BLOCK * std::max(H, I)});
+            m_packed.resize<uint8_t>({nthr, 2, m_packed_size});
+        }
+        m_gemm_out.resize<float>({nthr, 2, M_blk * OC_BLOCK});
+        m_scratch_a.resize<uint8_t>({nthr, std::max<size_t>(m_scratch_a_size, 1)});
+        m_wsp_size_per_thread = BrgemmKernel::get_wsp_size();
+        m_wsp.resize(nthr * m_wsp_size_per_thread);
+
+        // gate & up projections: every item takes a block of the output channels of one expert (de-quantized and
+        // packed here if the weights are compressed) and applies it to all the tokens routed to the expert
+        parallel_for(gate_up_items.size(), [&](size_t i) {
+            const size_t ithr = parallel_get_thread_num();
+            const auto [e, n0] = gate_up_items[i];
+            const size_t nb = std::min(OC_BLOCK, I - n0);
+            const size_t begin = m_offsets[e];
+            const size_t count = m_offsets[e + 1] - begin;
+            auto* gate_out = m_gemm_out.ptr<float>(ithr, 0);
+            auto* up_out = m_gemm_out.ptr<float>(ithr, 1);
+            auto* wsp = m_wsp.data() + ithr * m_wsp_size_per_thread;
+            auto* scratch_a = m_scratch_a.ptr<uint8_t>(ithr);
+
+            uint8_t* packed_gate = nullptr;
+            uint8_t* packed_up = nullptr;
+            if (prepacked) {
+                packed_gate = m_packed_gate.ptr<uint8_t>(e, n0 / OC_BLOCK);
+                packed_up = m_packed_up.ptr<uint8_t>(e, n0 / OC_BLOCK);
+            } else {
+                // the packed layout of B does not depend on M
+                auto* weight = m_weight.ptr<T>(ithr);
+                auto& packer = kernel(std::min(count, M_blk), nb, H, nb);
+                packed_gate = m_packed.ptr<uint8_t>(ithr, 0);
+                packed_up = m_packed.ptr<uint8_t>(ithr, 1);
+                dequantize(3, e, I, H, n0, n0 + nb, weight);
+                packer.copy_buffer_b(weight, packed_gate);
+                dequantize(4, e, I, H, n0, n0 + nb, weight);
+                packer.copy_buffer_b(weight, packed_up);
+            }
+
+            for (size_t m0 = 0; m0 < count; m0 += M_blk) {
+                const size_t mb = std::min(M_blk, count - m0);
+                auto& gemm = kernel(mb, nb, H, nb);
+                auto* a = m_src.ptr<T>(begin + m0);
+                gemm.executeGemm(mb < M_blk, a, packed_gate, gate_out, nullptr, nullptr, wsp, scratch_a);
+                gemm.executeGemm(mb < M_blk, a, packed_up, up_out, nullptr, nullptr, wsp, scratch_a);
+                for (size_t m = 0; m < mb; m++) {
+                    auto* out = m_act.ptr<T>(begin + m0 + m) + n0;
+                    for (size_t n = 0; n < nb; n++) {
+                        out[n] = static_cast<T>(activation(m_config.act, gate_out[m * nb + n]) * up_out[m * nb + n]);
+                    }
+                }
+            }
+        });
+
+        // down projection writes directly into the f32 rows of the experts
+        parallel_for(down_items.size(), [&](size_t i) {
+            const size_t ithr = parallel_get_thread_num();
+            const auto [e, n0] = down_items[i];
+            const size_t nb = std::min(OC_BLOCK, H - n0);
+            const size_t begin = m_offsets[e];
+            const size_t count = m_offsets[e + 1] - begin;
+            auto* wsp = m_wsp.data() + ithr * m_wsp_size_per_thread;
+            auto* scratch_a = m_scratch_a.ptr<uint8_t>(ithr);
+
+            uint8_t* packed_down = nullptr;
+            if (prepacked) {
+                packed_down = m_packed_down.ptr<uint8_t>(e, n0 / OC_BLOCK);
+            } else {
+                auto* weight = m_weight.ptr<T>(ithr);
+                packed_down = m_packed.ptr<uint8_t>(ithr, 0);
+                dequantize(5, e, H, I, n0, n0 + nb, weight);
+                kernel(std::min(count, M_blk), nb, I, H).copy_buffer_b(weight, packed_down);
+            }
+
+            for (size_t m0 = 0; m0 < count; m0 += M_blk) {
+                const size_t mb = std::min(M_blk, count - m0);
+                kernel(mb, nb, I, H).executeGemm(mb < M_blk,
+                                                 m_act.ptr<T>(begin + m0),
+                                                 packed_down,
+                                                 m_dst.ptr<float>(begin + m0) + n0,
+                                                 nullptr,
+                                                 nullptr,
+                                                 wsp,
+                                                 scratch_a);
+            }
+        });
+
+        // combine the experts of every token with the routing weights
+        parallel_for(tokens, [&](size_t t) {
+            auto* out = dst + t * H;
+            for (size_t h = 0; h < H; h++) {
+                float sum = 0.0F;
+                for (size_t j = 0; j < topk; j++) {
+                    const auto row = m_pair_row[t * topk + j];
+                    if (row >= 0) {
+                        sum += routing[t * topk + j] * m_dst.ptr<float>(static_cast<size_t>(row))[h];
+                    }
+                }
+                out[h] = static_cast<T>(sum);
+            }
+        });
+    }
+};
+#else
+template <typename T>
+struct MoE::Executor : public MoE::ExecutorBase {
+    Executor(MoE* node, const MoENode::Config& config, const GraphContext::CPtr& context) {
+        (void)node;
+        (void)config;
+        (void)context;
+    }
+
+    void execute() override {}
+};
+#endif
+
+MoE::MoE(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context)
+    : Node(op, context, NgraphShapeInferFactory(op)) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        OPENVINO_THROW_NOT_IMPLEMENTED(errorMessage);
+    }
+    m_config = ov::as_type_ptr<const MoENode>(op)->get_config();
+}
+
+void MoE::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty()) {
+        return;
+    }
+
+    auto rtPrecision = getOriginalInputPrecisionAtPort(0);
+    if (rtPrecision == ov::element::f32) {
+        // fallback to supported precision if possible
+        if (dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core_amx_fp16)) {
+            rtPrecision = ov::element::f16;
+        } else if (dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core_amx)) {
+            rtPrecision = ov::element::bf16;
+        }
+    }
+    OPENVINO_ASSERT(any_of(rtPrecision, ov::element::bf16, ov::element::f16), "Unexpected rtPrecision:", rtPrecision);
+
+    std::vector<PortConfigurator> inPortConfigs;
+    std::vector<PortConfigurator> outPortConfigs;
+    inPortConfigs.emplace_back(LayoutType::ncsp, rtPrecision, getInputShapeAtPort(0), false, -1);       // input
+    inPortConfigs.emplace_back(LayoutType::ncsp, ov::element::i32, getInputShapeAtPort(1), false, -1);  // indices
+    inPortConfigs.emplace_back(LayoutType::ncsp, ov::element::f32, getInputShapeAtPort(2), false, -1);  // weights
+    // the expert weights are consumed in their original (compressed) precision
+    for (size_t port = 3; port < 6; port++) {
+        inPortConfigs.emplace_back(LayoutType::ncsp,
+                                   getOriginalInputPrecisionAtPort(port),
+                                   getInputShapeAtPort(port),
+                                   false,
+                                   -1);
+    }
+    // per OC scales & zero points
+    for (size_t port = 6; port < getOriginalInputsNumber(); port++) {
+        inPortConfigs.emplace_back(LayoutType::ncsp, ov::element::f32, getInputShapeAtPort(port), false, -1);
+    }
+    outPortConfigs.emplace_back(LayoutType::ncsp, rtPrecision, getOutputShapeAtPort(0), false, -1);
+    addSupportedPrimDesc(inPortConfigs, outPortConfigs, impl_desc_type::brgemm_avx512);
+}
+
+void MoE::createPrimitive() {
+    auto rtPrecision = getInputPrecisions()[0];
+    if (rtPrecision == ov::element::bf16) {
+        m_executor = std::make_shared<Executor<ov::bfloat16>>(this, m_config, context);
+    } else if (rtPrecision == ov::element::f16) {
+        m_executor = std::make_shared<Executor<ov::float16>>(this, m_config, context);
+    }
+    if (!m_executor) {
+        CPU_NODE_THROW("Executor creation fails with precision " + rtPrecision.to_string());
+    }
+}
+
+void MoE::execute([[maybe_unused]] const dnnl::stream& strm) {
+    m_executor->execute();
+}
+
+bool MoE::isSupportedOperation([[maybe_unused]] const std::shared_ptr<const ov::Node>& op,
+                               [[maybe_unused]] std::string& errorMessage) noexcept {
+#if defined(OPENVINO_ARCH_X86_64)
+    try {
+        const auto node_moe = ov::as_type_ptr<const MoENode>(op);
+        if (!node_moe) {
+            errorMessage = "Only MoENode operation is supported";
+            return false;
+        }
+        const auto& config = node_moe->get_config();
+        if (config.expert_num <= 0 || config.hidden_size <= 0 || config.intermediate_size <= 0) {
+            errorMessage = "MoENode has empty experts";
+            return false;
+        }
+        for (size_t port = 3; port < 6; port++) {
+            if (!op->get_input_partial_shape(port).is_static()) {
+                errorMessage = "MoENode expert weight shape is not static";
+                return false;
+            }
+            const auto prec = op->get_input_element_type(port);
+            const bool supported =
+                config.weights_compressed
+                    ? any_of(prec, ov::element::u8, ov::element::i8, ov::element::u4, ov::element::i4)
+                    : any_of(prec, ov::element::f32, ov::element::f16, ov::element::bf16);
+            if (!supported) {
+                errorMessage = "MoENode expert weight precision " + prec.to_string() + " is not supported";
+                return false;
+            }
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+}  // namespace ov::intel_cpu::node
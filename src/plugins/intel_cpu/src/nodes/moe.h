@@ -0,0 +1,57 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <oneapi/dnnl/dnnl_common.hpp>
+#include <string>
+
+#include "cpu_types.h"
+#include "graph_context.h"
+#include "node.h"
+#include "openvino/core/node.hpp"
+#include "transformations/cpu_opset/x64/op/moe.hpp"
+
+namespace ov::intel_cpu::node {
+
+/**
+ * @brief Mixture-of-Experts block (see ov::intel_cpu::MoENode).
+ *
+ * The (token, expert) pairs are grouped by expert, so every expert runs its gated MLP as the brgemm calls over all of
+ * its tokens at once and the idle experts are skipped. The uncompressed expert weights are packed once when the
+ * primitive is created, the compressed ones are de-quantized and packed per call for every block of the output
+ * channels of the active experts.
+ */
+class MoE : public Node {
+public:
+    MoE(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context);
+
+    void getSupportedDescriptors() override {}
+    [[nodiscard]] bool created() const override {
+        return getType() == Type::MoE;
+    }
+    [[nodiscard]] bool needPrepareParams() const override {
+        return false;
+    }
+    void createPrimitive() override;
+    void executeDynamicImpl(const dnnl::stream& strm) override {
+        execute(strm);
+    }
+    void initSupportedPrimitiveDescriptors() override;
+    void execute(const dnnl::stream& strm) override;
+    static bool isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept;
+
+private:
+    struct ExecutorBase {
+        virtual void execute() = 0;
+        virtual ~ExecutorBase() = default;
+    };
+    std::shared_ptr<ExecutorBase> m_executor;
+    template <typename T>
+    struct Executor;
+    MoENode::Config m_config{};
+};
+
+}  // namespace ov::intel_cpu::node
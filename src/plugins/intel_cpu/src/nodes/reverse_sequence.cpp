@@ -105,6 +105,14 @@ void ReverseSequence::prepareParams() {
     execPtr = std::make_shared<ReverseSequenceExecutor>(dataDims, seqLengthsDims, dstDims, batch_axis, seq_axis);
 }
 
+PreparedParamsPtr ReverseSequence::savePreparedParams() const {
+    return std::make_shared<PreparedExecutor<ReverseSequenceExecutor>>(execPtr);
+}
+
+void ReverseSequence::restorePreparedParams(const PreparedParamsPtr& params) {
+    execPtr = std::static_pointer_cast<PreparedExecutor<ReverseSequenceExecutor>>(params)->executor;
+}
+
 void ReverseSequence::executeDynamicImpl(const dnnl::stream& strm) {
     execute(strm);
 }
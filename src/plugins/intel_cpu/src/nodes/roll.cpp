@@ -128,6 +128,14 @@ void Roll::prepareParams() {
     execPtr = std::make_shared<RollExecutor>(dataDims, shiftDims, axesDims, dstDims);
 }
 
+PreparedParamsPtr Roll::savePreparedParams() const {
+    return std::make_shared<PreparedExecutor<RollExecutor>>(execPtr);
+}
+
+void Roll::restorePreparedParams(const PreparedParamsPtr& params) {
+    execPtr = std::static_pointer_cast<PreparedExecutor<RollExecutor>>(params)->executor;
+}
+
 void Roll::executeDynamicImpl(const dnnl::stream& strm) {
     execute(strm);
 }
@@ -28,6 +28,8 @@ public:
     [[nodiscard]] bool created() const override;
 
     void prepareParams() override;
+    [[nodiscard]] PreparedParamsPtr savePreparedParams() const override;
+    void restorePreparedParams(const PreparedParamsPtr& params) override;
     void executeDynamicImpl(const dnnl::stream& strm) override;
 
     static bool isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept;
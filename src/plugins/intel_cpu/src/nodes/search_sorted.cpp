@@ -4,11 +4,15 @@
 
 #include "search_sorted.h"
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
 #include <tuple>
+#include <vector>
 
 #include "cpu_types.h"
 #include "graph_context.h"
@@ -17,11 +21,11 @@
 #include "onednn/iml_type_mapper.h"
 #include "openvino/core/except.hpp"
 #include "openvino/core/node.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/type.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/core/type/element_type_traits.hpp"
 #include "openvino/op/search_sorted.hpp"
-#include "openvino/reference/search_sorted.hpp"
 #include "selective_build.h"
 #include "shape_inference/shape_inference_cpu.hpp"
 #include "utils/general_utils.h"
@@ -92,14 +96,83 @@ void SearchSorted::executeDynamicImpl(const dnnl::stream& strm) {
     execute(strm);
 }
 
+namespace {
+// The searches of a batch of the values go through the same steps, since the sorted sequence is the same, so the
+// independent loads of the batch overlap and the steps have no data dependent branches.
+template <size_t batch, typename T, typename TOut, typename Compare>
+void searchBatch(const T* sorted, size_t sortedLen, const T* values, TOut* out, const Compare& compare) {
+    size_t base[batch] = {};
+    for (size_t len = sortedLen; len > 1;) {
+        const size_t half = len / 2;
+        for (size_t k = 0; k < batch; ++k) {
+            base[k] = compare(sorted[base[k] + half - 1], values[k]) ? base[k] + half : base[k];
+        }
+        len -= half;
+    }
+    for (size_t k = 0; k < batch; ++k) {
+        out[k] = static_cast<TOut>(base[k] + (sortedLen && compare(sorted[base[k]], values[k]) ? 1 : 0));
+    }
+}
+
+template <typename T, typename TOut, typename Compare>
+void searchValues(const T* sorted, size_t sortedLen, const T* values, TOut* out, size_t count, const Compare& compare) {
+    constexpr size_t batch = 8;
+    size_t i = 0;
+    for (; i + batch <= count; i += batch) {
+        searchBatch<batch>(sorted, sortedLen, values + i, out + i, compare);
+    }
+    for (; i < count; ++i) {
+        searchBatch<1>(sorted, sortedLen, values + i, out + i, compare);
+    }
+}
+}  // namespace
+
 template <typename INPUT_TYPE, typename OUTPUT_TYPE>
 void SearchSorted::executeImpl() {
-    ov::reference::search_sorted<INPUT_TYPE, OUTPUT_TYPE>(getSrcDataAtPortAs<const INPUT_TYPE>(0),
-                                                          getSrcDataAtPortAs<const INPUT_TYPE>(1),
-                                                          getDstDataAtPortAs<OUTPUT_TYPE>(0),
-                                                          ov::Shape{getSrcMemoryAtPort(0)->getStaticDims()},
-                                                          ov::Shape{getSrcMemoryAtPort(1)->getStaticDims()},
-                                                          right_mode);
+    const auto& sortedDims = getSrcMemoryAtPort(0)->getStaticDims();
+    const auto& valuesDims = getSrcMemoryAtPort(1)->getStaticDims();
+    const auto* sorted = getSrcDataAtPortAs<const INPUT_TYPE>(0);
+    const auto* values = getSrcDataAtPortAs<const INPUT_TYPE>(1);
+    auto* out = getDstDataAtPortAs<OUTPUT_TYPE>(0);
+
+    const size_t sortedLen = sortedDims.back();
+    const size_t valuesLen = valuesDims.empty() ? 1 : valuesDims.back();
+    const size_t rows = valuesLen ? ov::shape_size(valuesDims) / valuesLen : 0;
+
+    // the offsets of the sorted sequences per row of the values, the unit dimensions of the sorted sequences are
+    // broadcast, the 1D sorted sequence is shared by all the rows
+    std::vector<size_t> sortedOffsets(rows, 0);
+    if (sortedDims.size() > 1) {
+        const size_t padding = valuesDims.size() - sortedDims.size();
+        parallel_for(rows, [&](size_t row) {
+            size_t offset = 0;
+            size_t stride = sortedLen;
+            size_t rest = row;
+            for (size_t axis = valuesDims.size() - 1; axis-- > 0;) {
+                const size_t coord = rest % valuesDims[axis];
+                rest /= valuesDims[axis];
+                if (axis >= padding && sortedDims[axis - padding] > 1) {
+                    offset += coord * stride;
+                    stride *= sortedDims[axis - padding];
+                }
+            }
+            sortedOffsets[row] = offset;
+        });
+    }
+
+    constexpr size_t blockSize = 256;
+    const size_t blocks = (valuesLen + blockSize - 1) / blockSize;
+    parallel_for2d(rows, blocks, [&](size_t row, size_t block) {
+        const size_t start = block * blockSize;
+        const size_t count = std::min(blockSize, valuesLen - start);
+        const size_t offset = row * valuesLen + start;
+        const auto* rowSorted = sorted + sortedOffsets[row];
+        if (right_mode) {
+            searchValues(rowSorted, sortedLen, values + offset, out + offset, count, std::less_equal<>());
+        } else {
+            searchValues(rowSorted, sortedLen, values + offset, out + offset, count, std::less<>());
+        }
+    });
 }
 
 namespace {
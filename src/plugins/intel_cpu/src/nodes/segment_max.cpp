@@ -4,12 +4,14 @@
 
 #include "segment_max.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <limits>
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
+#include <vector>
 
 #include "cpu_types.h"
 #include "graph_context.h"
@@ -18,6 +20,8 @@
 #include "onednn/iml_type_mapper.h"
 #include "openvino/core/except.hpp"
 #include "openvino/core/node.hpp"
+#include "openvino/core/parallel.hpp"
+#include "openvino/core/shape.hpp"
 #include "openvino/core/type.hpp"
 #include "openvino/core/type/bfloat16.hpp"
 #include "openvino/core/type/element_type.hpp"
@@ -132,17 +136,90 @@ bool SegmentMax::needShapeInfer() const {
     return false;
 }
 
+namespace {
+// NaN never replaces the accumulated value, so the result does not depend on the order the values are taken in
+template <class T>
+inline T maxOf(T acc, T value) {
+    return acc < value ? value : acc;
+}
+
+// reduces the contiguous values into the independent lanes, which the compiler maps to the vector registers
+template <class T>
+T reduceMax(const T* data, size_t count) {
+    constexpr size_t lanes = 16;
+    T acc[lanes];
+    std::fill_n(acc, lanes, std::numeric_limits<T>::lowest());
+    size_t i = 0;
+    for (; i + lanes <= count; i += lanes) {
+        for (size_t k = 0; k < lanes; ++k) {
+            acc[k] = maxOf(acc[k], data[i + k]);
+        }
+    }
+    for (; i < count; ++i) {
+        acc[0] = maxOf(acc[0], data[i]);
+    }
+    for (size_t k = 1; k < lanes; ++k) {
+        acc[0] = maxOf(acc[0], acc[k]);
+    }
+    return acc[0];
+}
+}  // namespace
+
 template <class T>
 void SegmentMax::executeImpl() {
-    const auto& data_shape = getSrcMemoryAtPort(0)->getStaticDims();
-    const auto& output_shape = getDstMemoryAtPort(0)->getShape().getStaticDims();
-    const auto empty_segment_value = fillMode == ov::op::FillMode::ZERO ? T(0) : std::numeric_limits<T>::lowest();
-    ov::reference::segment_max(getSrcDataAtPortAs<const T>(0),
-                               data_shape,
-                               getSrcDataAtPortAs<const int32_t>(1),
-                               getDstDataAtPortAs<T>(0),
-                               output_shape,
-                               empty_segment_value);
+    const auto& dataDims = getSrcMemoryAtPort(0)->getStaticDims();
+    const auto& outputDims = getDstMemoryAtPort(0)->getShape().getStaticDims();
+    const auto* data = getSrcDataAtPortAs<const T>(0);
+    const auto* segmentIds = getSrcDataAtPortAs<const int32_t>(1);
+    auto* out = getDstDataAtPortAs<T>(0);
+    const auto emptySegmentValue = fillMode == ov::op::FillMode::ZERO ? T(0) : std::numeric_limits<T>::lowest();
+    const size_t rows = dataDims[0];
+    const size_t numSegments = outputDims[0];
+    const size_t innerSize = ov::shape_size(dataDims.begin() + 1, dataDims.end());
+
+    if (!std::is_sorted(segmentIds, segmentIds + rows)) {
+        ov::reference::segment_max(data,
+                                   ov::Shape{dataDims},
+                                   segmentIds,
+                                   out,
+                                   ov::Shape{outputDims},
+                                   emptySegmentValue);
+        return;
+    }
+
+    // the rows of the segment s are [segmentBegins[s], segmentBegins[s + 1]) as the segment ids are sorted
+    std::vector<size_t> segmentBegins(numSegments + 1);
+    parallel_for(numSegments + 1, [&](size_t segment) {
+        segmentBegins[segment] =
+            std::lower_bound(segmentIds, segmentIds + rows, static_cast<int32_t>(segment)) - segmentIds;
+    });
+
+    if (innerSize == 1) {
+        parallel_for(numSegments, [&](size_t segment) {
+            const auto begin = segmentBegins[segment];
+            const auto end = segmentBegins[segment + 1];
+            out[segment] = begin == end ? emptySegmentValue : reduceMax(data + begin, end - begin);
+        });
+        return;
+    }
+
+    // the inner dimensions are split into the blocks, so a few long segments are processed in parallel as well
+    constexpr size_t blockSize = 256;
+    const size_t blocks = (innerSize + blockSize - 1) / blockSize;
+    parallel_for2d(numSegments, blocks, [&](size_t segment, size_t block) {
+        const auto begin = segmentBegins[segment];
+        const auto end = segmentBegins[segment + 1];
+        const size_t start = block * blockSize;
+        const size_t count = std::min(blockSize, innerSize - start);
+        T* dst = out + segment * innerSize + start;
+        std::fill_n(dst, count, begin == end ? emptySegmentValue : std::numeric_limits<T>::lowest());
+        for (size_t row = begin; row < end; ++row) {
+            const T* src = data + row * innerSize + start;
+            for (size_t j = 0; j < count; ++j) {
+                dst[j] = maxOf(dst[j], src[j]);
+            }
+        }
+    });
 }
 
 namespace {
@@ -177,6 +177,14 @@ void ShuffleChannels::prepareParams() {
     execPtr = result.first;
 }
 
+PreparedParamsPtr ShuffleChannels::savePreparedParams() const {
+    return std::make_shared<PreparedExecutor<ShuffleChannelsExecutor>>(execPtr);
+}
+
+void ShuffleChannels::restorePreparedParams(const PreparedParamsPtr& params) {
+    execPtr = std::static_pointer_cast<PreparedExecutor<ShuffleChannelsExecutor>>(params)->executor;
+}
+
 ShuffleChannels::ShuffleChannelsExecutor::ShuffleChannelsExecutor(const ShuffleChannelsAttributes& attrs) {
     OPENVINO_ASSERT(
         any_of(attrs.layoutType, LayoutType::nCsp16c, LayoutType::nCsp8c, LayoutType::nspc, LayoutType::ncsp),
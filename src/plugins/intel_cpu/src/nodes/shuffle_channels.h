@@ -32,6 +32,8 @@ public:
     [[nodiscard]] bool created() const override;
 
     void prepareParams() override;
+    [[nodiscard]] PreparedParamsPtr savePreparedParams() const override;
+    void restorePreparedParams(const PreparedParamsPtr& params) override;
     struct ShuffleChannelsAttributes {
         LayoutType layoutType = LayoutType::nspc;
         int dataRank = 0;
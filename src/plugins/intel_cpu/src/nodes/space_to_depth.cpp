@@ -215,6 +215,14 @@ void SpaceToDepth::prepareParams() {
     execPtr = result.first;
 }
 
+PreparedParamsPtr SpaceToDepth::savePreparedParams() const {
+    return std::make_shared<PreparedExecutor<SpaceToDepthExecutor>>(execPtr);
+}
+
+void SpaceToDepth::restorePreparedParams(const PreparedParamsPtr& params) {
+    execPtr = std::static_pointer_cast<PreparedExecutor<SpaceToDepthExecutor>>(params)->executor;
+}
+
 SpaceToDepth::SpaceToDepthExecutor::SpaceToDepthExecutor(const SpaceToDepthAttrs& attrs) {
     OPENVINO_ASSERT(
         any_of(attrs.layoutType, LayoutType::nCsp16c, LayoutType::nCsp8c, LayoutType::nspc, LayoutType::ncsp),
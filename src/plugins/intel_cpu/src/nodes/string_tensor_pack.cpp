@@ -4,6 +4,7 @@
 
 #include "string_tensor_pack.h"
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
@@ -16,11 +17,11 @@
 #include "onednn/iml_type_mapper.h"
 #include "openvino/core/except.hpp"
 #include "openvino/core/node.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/shape.hpp"
 #include "openvino/core/type.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/op/string_tensor_pack.hpp"
-#include "openvino/reference/string_tensor_pack.hpp"
 #include "selective_build.h"
 #include "shape_inference/shape_inference_cpu.hpp"
 
@@ -76,12 +77,15 @@ void StringTensorPack::executeDynamicImpl(const dnnl::stream& strm) {
 
 template <class T_idx>
 void StringTensorPack::executeImpl() {
-    const auto& data_shape = getSrcMemoryAtPort(0)->getStaticDims();
-    ov::reference::string_tensor_pack(getSrcDataAtPortAs<const T_idx>(0),
-                                      getSrcDataAtPortAs<const T_idx>(1),
-                                      getSrcDataAtPortAs<const uint8_t>(2),
-                                      getDstDataAtPortAs<std::string>(0),
-                                      ov::shape_size(data_shape));
+    const auto stringCount = ov::shape_size(getSrcMemoryAtPort(0)->getStaticDims());
+    const auto* begins = getSrcDataAtPortAs<const T_idx>(0);
+    const auto* ends = getSrcDataAtPortAs<const T_idx>(1);
+    const auto* chars = getSrcDataAtPortAs<const char>(2);
+    auto* dst = getDstDataAtPortAs<std::string>(0);
+    // the strings are independent, so each one is allocated and copied by the thread it is assigned to
+    parallel_for(stringCount, [&](size_t i) {
+        dst[i].assign(chars + begins[i], chars + ends[i]);
+    });
 }
 
 namespace {
@@ -4,9 +4,11 @@
 
 #include "string_tensor_unpack.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
-#include <functional>
+#include <cstring>
+#include <limits>
 #include <memory>
 #include <numeric>
 #include <oneapi/dnnl/dnnl_common.hpp>
@@ -19,11 +21,11 @@
 #include "onednn/iml_type_mapper.h"
 #include "openvino/core/except.hpp"
 #include "openvino/core/node.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/shape.hpp"
 #include "openvino/core/type.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/op/string_tensor_unpack.hpp"
-#include "openvino/reference/string_tensor_unpack.hpp"
 #include "shape_inference/shape_inference_internal_dyn.hpp"
 
 namespace ov::intel_cpu::node {
@@ -71,25 +73,68 @@ bool StringTensorUnpack::needPrepareParams() const {
     return false;
 }
 
-void StringTensorUnpack::executeDynamicImpl(const dnnl::stream& strm) {
-    const auto& srcMemory = getSrcMemoryAtPort(0);
-    const auto& srcDataDims = srcMemory->getStaticDims();
-    const auto& srcData = srcMemory->getDataAs<std::string>();
-    Dim stringCount = std::accumulate(srcDataDims.begin(), srcDataDims.end(), 1, std::multiplies<>());
-    size_t totalCharLength = 0;
-    for (Dim i = 0; i < stringCount; ++i) {
-        totalCharLength += srcData[i].length();
-    }
-    redefineOutputMemory({srcDataDims, srcDataDims, {totalCharLength}});
-    execute(strm);
+void StringTensorUnpack::computeOffsets() {
+    // the copy of a few short strings does not pay off the threading overhead
+    constexpr size_t minStringsPerChunk = 256;
+    const auto stringCount = ov::shape_size(getSrcMemoryAtPort(0)->getStaticDims());
+    const auto* srcData = getSrcDataAtPortAs<const std::string>(0);
+    const size_t chunks = std::max<size_t>(
+        std::min<size_t>(parallel_get_max_threads(), (stringCount + minStringsPerChunk - 1) / minStringsPerChunk),
+        1);
+
+    m_chunkOffsets.assign(chunks + 1, 0);
+    parallel_for(chunks, [&](size_t chunk) {
+        size_t start = 0;
+        size_t end = 0;
+        splitter(stringCount, chunks, chunk, start, end);
+        size_t length = 0;
+        for (size_t i = start; i < end; ++i) {
+            length += srcData[i].length();
+        }
+        m_chunkOffsets[chunk + 1] = length;
+    });
+    std::partial_sum(m_chunkOffsets.begin(), m_chunkOffsets.end(), m_chunkOffsets.begin());
+    CPU_NODE_ASSERT(m_chunkOffsets.back() <= static_cast<size_t>(std::numeric_limits<int32_t>::max()),
+                    "total length of the strings ",
+                    m_chunkOffsets.back(),
+                    " exceeds the range of the i32 offsets");
 }
 
-void StringTensorUnpack::execute([[maybe_unused]] const dnnl::stream& strm) {
+void StringTensorUnpack::unpack() {
     const auto stringCount = ov::shape_size(getSrcMemoryAtPort(0)->getStaticDims());
-    ov::reference::string_tensor_unpack(getSrcDataAtPortAs<const std::string>(0),
-                                        getDstDataAtPortAs<int32_t>(0),
-                                        getDstDataAtPortAs<int32_t>(1),
-                                        getDstDataAtPortAs<uint8_t>(2),
-                                        stringCount);
+    const auto* srcData = getSrcDataAtPortAs<const std::string>(0);
+    auto* begins = getDstDataAtPortAs<int32_t>(0);
+    auto* ends = getDstDataAtPortAs<int32_t>(1);
+    auto* symbols = getDstDataAtPortAs<uint8_t>(2);
+    const size_t chunks = m_chunkOffsets.size() - 1;
+
+    // every thread fills its own range of the strings starting from the offset of the range
+    parallel_for(chunks, [&](size_t chunk) {
+        size_t start = 0;
+        size_t end = 0;
+        splitter(stringCount, chunks, chunk, start, end);
+        auto offset = m_chunkOffsets[chunk];
+        for (size_t i = start; i < end; ++i) {
+            const auto length = srcData[i].length();
+            begins[i] = static_cast<int32_t>(offset);
+            if (length) {
+                std::memcpy(symbols + offset, srcData[i].data(), length);
+            }
+            offset += length;
+            ends[i] = static_cast<int32_t>(offset);
+        }
+    });
+}
+
+void StringTensorUnpack::executeDynamicImpl([[maybe_unused]] const dnnl::stream& strm) {
+    const auto& srcDataDims = getSrcMemoryAtPort(0)->getStaticDims();
+    computeOffsets();
+    redefineOutputMemory({srcDataDims, srcDataDims, {m_chunkOffsets.back()}});
+    unpack();
+}
+
+void StringTensorUnpack::execute([[maybe_unused]] const dnnl::stream& strm) {
+    computeOffsets();
+    unpack();
 }
 }  // namespace ov::intel_cpu::node
@@ -7,6 +7,7 @@
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
+#include <vector>
 
 #include "graph_context.h"
 #include "node.h"
@@ -25,6 +26,13 @@ public:
     [[nodiscard]] bool created() const override;
     [[nodiscard]] bool needPrepareParams() const override;
     void executeDynamicImpl(const dnnl::stream& strm) override;
+
+private:
+    void computeOffsets();
+    void unpack();
+
+    // the offsets of the symbols of the string ranges processed by the threads, the last one is the total length
+    std::vector<size_t> m_chunkOffsets;
 };
 
 }  // namespace ov::intel_cpu::node
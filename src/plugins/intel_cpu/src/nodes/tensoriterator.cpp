@@ -7,6 +7,7 @@
 #include <oneapi/dnnl/dnnl_types.h>
 
 #include <algorithm>
+#include <chrono>
 #include <common/utils.hpp>
 #include <cstddef>
 #include <cstdint>
@@ -40,6 +41,8 @@
 #include "openvino/op/loop.hpp"
 #include "openvino/op/tensor_iterator.hpp"
 #include "openvino/op/util/sub_graph_base.hpp"
+#include "openvino/runtime/profiling_info.hpp"
+#include "proxy_mem_blk.h"
 #include "shape_inference/shape_inference_internal_dyn.hpp"
 #include "utils/debug_capabilities.h"
 #include "utils/general_utils.h"
@@ -92,6 +95,44 @@ static std::vector<MemoryPtr> getToMemories(const Node* node, const size_t port)
     return memories;
 }
 
+// the chunks of a plain tensor sliced by the axis are dense only when all the outer dimensions are equal to one
+static bool isDenseChunk(const MemoryDesc& full_desc, const MemoryDesc& part_desc, const int axis, const int stride) {
+    if (!full_desc.isDefined() || !part_desc.isDefined() || full_desc.getPrecision() != part_desc.getPrecision()) {
+        return false;
+    }
+    const auto& full_dims = full_desc.getShape().getStaticDims();
+    if (axis < 0 || static_cast<size_t>(axis) >= full_dims.size() ||
+        !std::all_of(full_dims.begin(), full_dims.begin() + axis, [](const size_t dim) {
+            return dim == 1;
+        })) {
+        return false;
+    }
+    auto part_dims = full_dims;
+    part_dims[axis] = static_cast<size_t>(std::abs(stride));
+
+    const auto& precision = full_desc.getPrecision();
+    return full_desc.isCompatible(CpuBlockedMemoryDesc(precision, Shape(full_dims))) &&
+           part_desc.isCompatible(CpuBlockedMemoryDesc(precision, Shape(part_dims)));
+}
+
+// the memory of the edge may be rebound only if it is not shared in place with any other edge of the graph
+static bool isMemoryExclusive(const EdgePtr& edge) {
+    if (edge->getStatus() != Edge::Status::Uninitialized) {
+        return false;
+    }
+    const auto parent_port = edge->getInputNum();
+    const auto child_port = edge->getOutputNum();
+    const auto& parent_conf = edge->getParent()->getSelectedPrimitiveDescriptor()->getConfig();
+    const auto& child_conf = edge->getChild()->getSelectedPrimitiveDescriptor()->getConfig();
+    const auto refers_to = [](const std::vector<PortConfig>& confs, const int port) {
+        return std::any_of(confs.begin(), confs.end(), [port](const PortConfig& conf) {
+            return conf.inPlace() == port;
+        });
+    };
+    return parent_conf.outConfs[parent_port].inPlace() < 0 && !refers_to(parent_conf.inConfs, parent_port) &&
+           child_conf.inConfs[child_port].inPlace() < 0 && !refers_to(child_conf.outConfs, child_port);
+}
+
 static void nullifyUndefinedDims(VectorDims& dims) {
     std::transform(dims.begin(), dims.end(), dims.begin(), [](const size_t& dim) {
         return dim == Shape::UNDEFINED_DIM ? 0 : dim;
@@ -170,6 +211,81 @@ private:
     int iter_count;
 };
 
+/**
+ * Rebinds the body memory to the chunk of the outer tensor processed on the current iteration instead of copying it.
+ * Applicable only when every chunk is a dense part of the outer tensor with the same layout as the body memory.
+ */
+class PortRebindHelper : public PortMapHelper {
+public:
+    PortRebindHelper(MemoryPtr full_mem, ProxyMemoryBlockPtr part_block, const PortMap& slice_rule)
+        : full_mem(std::move(full_mem)),
+          part_block(std::move(part_block)) {
+        const auto& full_dims = this->full_mem->getStaticDims();
+        const auto axis = static_cast<size_t>(slice_rule.axis);
+        const auto abs_stride = static_cast<size_t>(std::abs(slice_rule.stride));
+
+        iter_count = static_cast<int>(full_dims[axis] / abs_stride);
+
+        const auto inner_size =
+            std::accumulate(full_dims.begin() + axis + 1, full_dims.end(), size_t{1}, std::multiplies<>());
+        chunk_size_in_byte = abs_stride * inner_size * this->full_mem->getDesc().getPrecision().size();
+        chunk_stride_in_byte = static_cast<ptrdiff_t>(chunk_size_in_byte);
+        chunk_offset_in_byte = slice_rule.stride < 0 ? (iter_count - 1) * chunk_stride_in_byte : 0;
+        chunk_stride_in_byte *= slice_rule.stride < 0 ? -1 : 1;
+    }
+
+    void execute([[maybe_unused]] const dnnl::stream& strm, int iter) override {
+        OPENVINO_ASSERT(iter >= 0 && iter < iter_count);
+        part_block->setExtBuff(full_mem->getDataAs<uint8_t>() + chunk_offset_in_byte + chunk_stride_in_byte * iter,
+                               chunk_size_in_byte);
+    }
+
+private:
+    MemoryPtr full_mem;
+    ProxyMemoryBlockPtr part_block;
+
+    ptrdiff_t chunk_stride_in_byte = 0;
+    ptrdiff_t chunk_offset_in_byte = 0;
+    size_t chunk_size_in_byte = 0;
+
+    int iter_count;
+};
+
+/**
+ * Accumulates the time spent on the port mapping during one inference, when the perf counters are collected
+ */
+class PortMappingTimer {
+public:
+    explicit PortMappingTimer(PortMappingPerf* perf) : perf(perf) {
+        if (perf) {
+            *perf = {};
+        }
+    }
+
+    void start() {
+        if (perf) {
+            begin = std::chrono::steady_clock::now();
+        }
+    }
+
+    void stop() {
+        if (perf) {
+            const auto elapsed = std::chrono::steady_clock::now() - begin;
+            perf->last_ns += std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+        }
+    }
+
+    void iteration() {
+        if (perf) {
+            perf->iterations++;
+        }
+    }
+
+private:
+    PortMappingPerf* perf;
+    std::chrono::steady_clock::time_point begin;
+};
+
 class BackEdgePortHelper : public PortMapHelper {
 public:
     BackEdgePortHelper(const MultiCachePtr& cache, const MemoryPtr& from, const MemoryPtr& to) {
@@ -590,7 +706,78 @@ void TensorIterator::createPrimitive() {
 }
 
 int TensorIterator::registerToAllocationContext(int offset, AllocationContext& context) {
-    return sub_graph.RegisterToAllocationContext(offset, context);
+    offset = sub_graph.RegisterToAllocationContext(offset, context);
+    // whether the body is dynamic is known only after its registration
+    if (!runAsDynamic()) {
+        prepareZeroCopyPorts();
+    }
+    return offset;
+}
+
+/**
+ * The body memory of the sliced inputs and the concatenated outputs is allocated as a proxy, which is rebound to the
+ * chunk of the outer tensor on every iteration, instead of being copied by a reorder. This is possible only for the
+ * dense chunks, when the body does not share the memory in place with other edges.
+ */
+void TensorIterator::prepareZeroCopyPorts() {
+    auto subgraphOp = ov::as_type_ptr<const ov::op::util::SubGraphOp>(ngraphOp);
+    CPU_NODE_ASSERT(subgraphOp, "cannot be cast to ov::op::util::SubGraphOp");
+
+    for (const auto& desc : subgraphOp->get_input_descriptions()) {
+        auto slice_desc = ov::as_type_ptr<const ov::op::util::SubGraphOp::SliceInputDescription>(desc);
+        if (!slice_desc) {
+            continue;
+        }
+        const auto inNode = sub_graph.getInputNodeByIndex(slice_desc->m_body_parameter_index);
+        if (!inNode) {
+            continue;
+        }
+        const auto& full_desc = *getBaseMemDescAtInputPort(slice_desc->m_input_index);
+        const auto edges = inNode->getChildEdgesAtPort(0);
+        const bool rebindable = std::all_of(edges.begin(), edges.end(), [&](const EdgePtr& edge) {
+            return isMemoryExclusive(edge) && isDenseChunk(full_desc,
+                                                           edge->getOriginalDesc(),
+                                                           static_cast<int>(slice_desc->m_axis),
+                                                           static_cast<int>(slice_desc->m_stride));
+        });
+        if (!rebindable) {
+            continue;
+        }
+        auto block = std::make_shared<ProxyMemoryBlock>();
+        for (const auto& edge : edges) {
+            edge->allocate(block);
+        }
+        zeroCopyInputs.emplace(static_cast<int>(slice_desc->m_body_parameter_index), block);
+    }
+
+    const auto& output_descs = subgraphOp->get_output_descriptions();
+    for (const auto& desc : output_descs) {
+        auto concat_desc = ov::as_type_ptr<const ov::op::util::SubGraphOp::ConcatOutputDescription>(desc);
+        if (!concat_desc) {
+            continue;
+        }
+        // the body output concatenated to several outputs is written once and copied to the others
+        const auto concatenations =
+            std::count_if(output_descs.begin(), output_descs.end(), [&](const auto& other) {
+                return other->m_body_value_index == desc->m_body_value_index &&
+                       ov::is_type<ov::op::util::SubGraphOp::ConcatOutputDescription>(other);
+            });
+        const auto outNode = sub_graph.getOutputNodeByIndex(concat_desc->m_body_value_index);
+        if (concatenations != 1 || !outNode) {
+            continue;
+        }
+        const auto edge = outNode->getParentEdgeAt(0);
+        if (edge->getParent()->getChildEdgesAtPort(edge->getInputNum()).size() != 1 || !isMemoryExclusive(edge) ||
+            !isDenseChunk(*getBaseMemDescAtOutputPort(concat_desc->m_output_index),
+                          edge->getOriginalDesc(),
+                          static_cast<int>(concat_desc->m_axis),
+                          static_cast<int>(concat_desc->m_stride))) {
+            continue;
+        }
+        auto block = std::make_shared<ProxyMemoryBlock>();
+        edge->allocate(block);
+        zeroCopyOutputs.emplace(static_cast<int>(concat_desc->m_body_value_index), block);
+    }
 }
 
 bool TensorIterator::needPrepareParams() const {
@@ -668,12 +855,15 @@ void TensorIterator::execute(const dnnl::stream& strm) {
         mapper.second->execute(strm, -1);
     }
 
+    PortMappingTimer timer(context->getConfig().collectPerfCounters ? &mappingPerf : nullptr);
     // use  "i != max_num_iter" only to allow "-1" works like infinite loop
     for (int i = 0; i != max_num_iter && continue_cond; i++) {
         // copy data to subgraph iteration
+        timer.start();
         for (auto& mapper : before_mappers) {
             mapper->execute(strm, i);
         }
+        timer.stop();
 
         sub_graph.Infer();
 
@@ -681,9 +871,12 @@ void TensorIterator::execute(const dnnl::stream& strm) {
 
         // copy data from subgraph iteration to outputs
         // or to the next iteration inputs
+        timer.start();
         for (auto& mapper : after_mappers) {
             mapper->execute(strm, i);
         }
+        timer.stop();
+        timer.iteration();
     }
 
     for (auto& mapper : last_mappers) {
@@ -702,23 +895,29 @@ void TensorIterator::executeDynamicImpl(const dnnl::stream& strm) {
         mapper.second->execute(strm, -1);
     }
 
+    PortMappingTimer timer(context->getConfig().collectPerfCounters ? &mappingPerf : nullptr);
     // use  "i != max_num_iter" only to allow "-1" works like infinite loop
     for (int i = 0; i != max_num_iter && continue_cond; i++) {
         // copy data to subgraph iteration
+        timer.start();
         for (auto& mapper : before_mappers) {
             mapper->execute(strm, i);
         }
         for (auto& mapper : back_mappers) {
             mapper->execute(strm, i);
         }
+        timer.stop();
 
         sub_graph.Infer();
 
         continue_cond = (continue_cond_check->getStatus() != 0);
 
+        timer.start();
         for (auto& buffer : buffers) {
             buffer->execute(eng, i);
         }
+        timer.stop();
+        timer.iteration();
 
         // on the last iteration we shouldn't reshape body inputs and init back edges
         if ((i + 1 != max_num_iter) && continue_cond) {
@@ -729,6 +928,24 @@ void TensorIterator::executeDynamicImpl(const dnnl::stream& strm) {
     reshapeAndFillOutput(strm);
 }
 
+void TensorIterator::appendInternalPerfData(std::vector<ov::ProfilingInfo>& perfMap) const {
+    ov::ProfilingInfo pc;
+    pc.node_name = getName() + "/port_mapping";
+    pc.node_type = "PortMapping";
+    // the time spent on passing the data between the outer tensors and the body in the last inference
+    pc.cpu_time = pc.real_time = std::chrono::microseconds(mappingPerf.last_ns / 1000);
+    pc.status = mappingPerf.iterations > 0 ? ov::ProfilingInfo::Status::EXECUTED : ov::ProfilingInfo::Status::NOT_RUN;
+    const bool zeroCopy = !zeroCopyInputs.empty() || !zeroCopyOutputs.empty();
+    const bool copy = std::any_of(before_mappers.begin(),
+                                  before_mappers.end(),
+                                  [](const std::shared_ptr<PortMapHelper>& mapper) {
+                                      return std::dynamic_pointer_cast<PortIteratorHelper>(mapper) != nullptr;
+                                  }) ||
+                      !after_mappers.empty() || !buffers.empty();
+    pc.exec_type = zeroCopy ? (copy ? "zero_copy_partial" : "zero_copy") : "copy";
+    perfMap.emplace_back(pc);
+}
+
 /* *==============* Prepare reorders, edges between body and TI *==============* */
 
 void TensorIterator::prepareInputPorts() {
@@ -741,6 +958,8 @@ void TensorIterator::prepareInputPorts() {
         if (map_rule.axis == -1) {
             first_mappers.emplace(std::make_pair(map_rule.from, map_rule.to),
                                   std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mem));
+        } else if (auto block = zeroCopyInputs.find(map_rule.to); block != zeroCopyInputs.end()) {
+            before_mappers.emplace_back(std::make_shared<PortRebindHelper>(from_mem, block->second, map_rule));
         } else {
             before_mappers.emplace_back(
                 std::make_shared<PortIteratorHelper>(context->getParamsCache(), from_mem, to_mem, true, map_rule, eng));
@@ -757,6 +976,9 @@ void TensorIterator::prepareOutputPorts() {
         if (map_rule.axis == -1) {
             last_mappers.emplace_back(
                 std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mem));
+        } else if (auto block = zeroCopyOutputs.find(map_rule.to); block != zeroCopyOutputs.end()) {
+            // the body writes the output of the iteration directly to the chunk of the outer tensor
+            before_mappers.emplace_back(std::make_shared<PortRebindHelper>(to_mem, block->second, map_rule));
         } else {
             after_mappers.emplace_back(std::make_shared<PortIteratorHelper>(context->getParamsCache(),
                                                                             from_mem,
@@ -773,7 +995,9 @@ void TensorIterator::prepareBackEdges() {
         auto from_mem = output_mem[map_rule.from];
         auto to_mem = input_mems[map_rule.to].front();
 
-        before_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mem));
+        // the back edges are passed before the rebinding of the outputs to the chunks of the current iteration
+        before_mappers.insert(before_mappers.begin(),
+                              std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mem));
     }
 }
 
@@ -22,6 +22,8 @@
 #include "cpu_memory.h"
 #include "graph_context.h"
 #include "openvino/core/node.hpp"
+#include "openvino/runtime/profiling_info.hpp"
+#include "proxy_mem_blk.h"
 
 namespace ov::intel_cpu::node {
 
@@ -54,6 +56,14 @@ protected:
     dnnl::memory mem_holder_dst;
 };
 
+/**
+ * Time of passing the data between the outer tensors and the body in the last inference
+ */
+struct PortMappingPerf {
+    uint64_t last_ns = 0;
+    uint64_t iterations = 0;
+};
+
 /**
  * Functor interface to perform check of data tensor (captured in constructor)
  * Information extracted as int. Meaning of returned value is specific for
@@ -122,6 +132,7 @@ public:
     int registerToAllocationContext(int offset, AllocationContext& context) override;
     bool created() const override;
     void execute(const dnnl::stream& strm) override;
+    void appendInternalPerfData(std::vector<ov::ProfilingInfo>& perfMap) const override;
     bool neverExecute() const override {
         return false;
     }
@@ -145,6 +156,7 @@ protected:
     void executeDynamicImpl(const dnnl::stream& strm) override;
 
 private:
+    void prepareZeroCopyPorts();
     void prepareInputPorts();
     void prepareOutputPorts();
     void prepareBackEdges();
@@ -192,6 +204,11 @@ private:
 
     std::vector<std::shared_ptr<DynamicBuffer>> buffers;
 
+    // proxy memory blocks of the body inputs / outputs rebound to the chunks of the outer tensors on every iteration
+    std::unordered_map<int, ProxyMemoryBlockPtr> zeroCopyInputs;   //!< body parameter index -> memory block
+    std::unordered_map<int, ProxyMemoryBlockPtr> zeroCopyOutputs;  //!< body result index -> memory block
+    PortMappingPerf mappingPerf;
+
     std::vector<PortMap> inputPortMap;   //!< Input ports map
     std::vector<PortMap> outputPortMap;  //!< Output ports map
     std::vector<PortMap> backEdges;      //!< Back edges map
@@ -223,6 +223,19 @@ void Transpose::prepareParams() {
     execPtr = result.first;
 }
 
+bool Transpose::isPreparedParamsReusable() const {
+    // the order taken from the input data and the reorder primitive bound to the memory are prepared every time
+    return isInputOrderConst && !performAsReorder;
+}
+
+PreparedParamsPtr Transpose::savePreparedParams() const {
+    return std::make_shared<PreparedExecutor<TransposeExecutor>>(execPtr);
+}
+
+void Transpose::restorePreparedParams(const PreparedParamsPtr& params) {
+    execPtr = std::static_pointer_cast<PreparedExecutor<TransposeExecutor>>(params)->executor;
+}
+
 void Transpose::createPrimitive() {
     if (isOptimized) {
         return;
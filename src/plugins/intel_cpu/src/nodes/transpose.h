@@ -42,6 +42,9 @@ public:
     [[nodiscard]] bool isExecutable() const override;
     [[nodiscard]] bool needPrepareParams() const override;
     void prepareParams() override;
+    [[nodiscard]] PreparedParamsPtr savePreparedParams() const override;
+    void restorePreparedParams(const PreparedParamsPtr& params) override;
+    [[nodiscard]] bool isPreparedParamsReusable() const override;
 
     void setOptimized(bool isOptimized) {
         this->isOptimized = isOptimized;
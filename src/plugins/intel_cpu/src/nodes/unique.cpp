@@ -36,6 +36,234 @@
 using namespace ov::intel_cpu;
 using namespace ov::intel_cpu::node;
 
+namespace {
+// the short inputs are not split between the threads
+constexpr size_t minElementsPerThread = 4096;
+
+size_t getThreadsNum(size_t len) {
+    return std::max<size_t>(std::min<size_t>(parallel_get_max_threads(), len / minElementsPerThread), 1);
+}
+
+// Splits [0, len) into the chunks processed in parallel and calls body(start, end, offset) per chunk, where offset is
+// the number of the positions marked by isMarked before the chunk. Returns the total number of the marked positions.
+template <typename IsMarked, typename Body>
+size_t forEachChunkWithOffset(size_t len, const IsMarked& isMarked, const Body& body) {
+    const size_t chunks = getThreadsNum(len);
+    std::vector<size_t> offsets(chunks + 1, 0);
+    parallel_for(chunks, [&](size_t chunk) {
+        size_t start = 0;
+        size_t end = 0;
+        splitter(len, chunks, chunk, start, end);
+        size_t marked = 0;
+        for (size_t i = start; i < end; i++) {
+            marked += isMarked(i) ? 1 : 0;
+        }
+        offsets[chunk + 1] = marked;
+    });
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+    parallel_for(chunks, [&](size_t chunk) {
+        size_t start = 0;
+        size_t end = 0;
+        splitter(len, chunks, chunk, start, end);
+        body(start, end, offsets[chunk]);
+    });
+    return offsets.back();
+}
+
+// Merge sort: the chunks are sorted in parallel, then the sorted runs are merged pairwise in parallel rounds.
+template <typename V, typename Less>
+void parallelSort(std::vector<V>& data, const Less& less) {
+    const size_t len = data.size();
+    const size_t chunks = getThreadsNum(len);
+    std::vector<size_t> bounds(chunks + 1, len);
+    for (size_t chunk = 0; chunk < chunks; chunk++) {
+        size_t end = 0;
+        splitter(len, chunks, chunk, bounds[chunk], end);
+    }
+    parallel_for(chunks, [&](size_t chunk) {
+        std::sort(data.begin() + bounds[chunk], data.begin() + bounds[chunk + 1], less);
+    });
+    if (chunks == 1) {
+        return;
+    }
+    std::vector<V> buffer(len);
+    for (size_t width = 1; width < chunks; width *= 2) {
+        const size_t merges = (chunks + 2 * width - 1) / (2 * width);
+        parallel_for(merges, [&](size_t merge) {
+            const auto lo = bounds[std::min(2 * merge * width, chunks)];
+            const auto mid = bounds[std::min((2 * merge + 1) * width, chunks)];
+            const auto hi = bounds[std::min((2 * merge + 2) * width, chunks)];
+            std::merge(data.begin() + lo,
+                       data.begin() + mid,
+                       data.begin() + mid,
+                       data.begin() + hi,
+                       buffer.begin() + lo,
+                       less);
+            std::copy(buffer.begin() + lo, buffer.begin() + hi, data.begin() + lo);
+        });
+    }
+}
+
+// The 8-bit values are counted per thread, the unique values are then ordered either by the value or by the first
+// occurrence.
+template <typename T>
+size_t uniqueByHistogram(const T* src,
+                         size_t len,
+                         bool sorted,
+                         T* uniData,
+                         int32_t* first,
+                         int32_t* inToOut,
+                         int32_t* occur) {
+    constexpr size_t range = 256;
+    const size_t threads = getThreadsNum(len);
+    std::vector<int32_t> counts(threads * range, 0);
+    std::vector<int32_t> firsts(threads * range, 0);
+    parallel_for(threads, [&](size_t thread) {
+        size_t start = 0;
+        size_t end = 0;
+        splitter(len, threads, thread, start, end);
+        auto* threadCounts = counts.data() + thread * range;
+        auto* threadFirsts = firsts.data() + thread * range;
+        for (size_t i = start; i < end; i++) {
+            const auto key = static_cast<uint8_t>(src[i]);
+            if (threadCounts[key]++ == 0) {
+                threadFirsts[key] = static_cast<int32_t>(i);
+            }
+        }
+    });
+
+    std::vector<size_t> keys;
+    std::vector<int32_t> keyCounts(range, 0);
+    std::vector<int32_t> keyFirsts(range, 0);
+    for (size_t key = 0; key < range; key++) {
+        // the threads process the ascending ranges, so the first thread meeting the value has its first occurrence
+        for (size_t thread = threads; thread-- > 0;) {
+            if (counts[thread * range + key]) {
+                keyCounts[key] += counts[thread * range + key];
+                keyFirsts[key] = firsts[thread * range + key];
+            }
+        }
+        if (keyCounts[key]) {
+            keys.push_back(key);
+        }
+    }
+    if (sorted) {
+        std::sort(keys.begin(), keys.end(), [](size_t lhs, size_t rhs) {
+            return static_cast<T>(lhs) < static_cast<T>(rhs);
+        });
+    } else {
+        std::sort(keys.begin(), keys.end(), [&](size_t lhs, size_t rhs) {
+            return keyFirsts[lhs] < keyFirsts[rhs];
+        });
+    }
+
+    std::vector<int32_t> keyIndices(range, 0);
+    for (size_t j = 0; j < keys.size(); j++) {
+        uniData[j] = static_cast<T>(keys[j]);
+        first[j] = keyFirsts[keys[j]];
+        occur[j] = keyCounts[keys[j]];
+        keyIndices[keys[j]] = static_cast<int32_t>(j);
+    }
+    parallel_for(len, [&](size_t i) {
+        inToOut[i] = keyIndices[static_cast<uint8_t>(src[i])];
+    });
+    return keys.size();
+}
+
+// The (value, index) pairs are sorted, so each run of the equal values starts with the first occurrence of the value.
+template <typename T>
+size_t uniqueBySort(const T* src, size_t len, T* uniData, int32_t* first, int32_t* inToOut, int32_t* occur) {
+    std::vector<std::pair<T, int32_t>> pairs(len);
+    parallel_for(len, [&](size_t i) {
+        pairs[i] = {src[i], static_cast<int32_t>(i)};
+    });
+    parallelSort(pairs, [](const std::pair<T, int32_t>& lhs, const std::pair<T, int32_t>& rhs) {
+        return lhs.first < rhs.first || (!(rhs.first < lhs.first) && lhs.second < rhs.second);
+    });
+
+    auto isRunStart = [&](size_t k) {
+        return k == 0 || !(pairs[k - 1].first == pairs[k].first);
+    };
+    std::vector<size_t> runStarts(len + 1, len);
+    const auto uniqueNum = forEachChunkWithOffset(len, isRunStart, [&](size_t start, size_t end, size_t offset) {
+        if (start == end) {
+            return;
+        }
+        // the chunk may start in the middle of the run counted by the previous chunk
+        size_t j = offset - (isRunStart(start) ? 0 : 1);
+        for (size_t k = start; k < end; k++) {
+            if (isRunStart(k)) {
+                j = offset++;
+                uniData[j] = pairs[k].first;
+                first[j] = pairs[k].second;
+                runStarts[j] = k;
+            }
+            inToOut[pairs[k].second] = static_cast<int32_t>(j);
+        }
+    });
+    parallel_for(uniqueNum, [&](size_t j) {
+        occur[j] = static_cast<int32_t>(runStarts[j + 1] - runStarts[j]);
+    });
+    return uniqueNum;
+}
+
+// Each thread keeps the values of its own hash partition, so the maps are filled without the synchronization. The
+// unique values are then ordered by their first occurrences.
+template <typename T>
+size_t uniqueByHash(const T* src, size_t len, T* uniData, int32_t* first, int32_t* inToOut, int32_t* occur) {
+    struct Entry {
+        int32_t first;
+        int32_t count;
+    };
+    const size_t partitions = getThreadsNum(len);
+    auto partitionOf = [partitions](const T& value) {
+        return static_cast<size_t>(((static_cast<uint64_t>(std::hash<T>{}(value)) * 0x9E3779B97F4A7C15ULL) >> 32) %
+                                   partitions);
+    };
+    std::vector<std::unordered_map<T, Entry>> maps(partitions);
+    std::vector<uint8_t> isFirst(len, 0);
+    parallel_for(partitions, [&](size_t partition) {
+        auto& map = maps[partition];
+        map.reserve(len / partitions);
+        for (size_t i = 0; i < len; i++) {
+            if (partitions > 1 && partitionOf(src[i]) != partition) {
+                continue;
+            }
+            auto it = map.emplace(src[i], Entry{static_cast<int32_t>(i), 0});
+            it.first->second.count++;
+            isFirst[i] = it.second ? 1 : 0;
+            // the first occurrence is replaced with the index of the unique value below
+            inToOut[i] = it.first->second.first;
+        }
+    });
+
+    std::vector<int32_t> uniqueIndices(len);
+    const auto uniqueNum = forEachChunkWithOffset(
+        len,
+        [&](size_t i) {
+            return isFirst[i] != 0;
+        },
+        [&](size_t start, size_t end, size_t offset) {
+            for (size_t i = start; i < end; i++) {
+                if (isFirst[i]) {
+                    uniData[offset] = src[i];
+                    first[offset] = static_cast<int32_t>(i);
+                    uniqueIndices[i] = static_cast<int32_t>(offset++);
+                }
+            }
+        });
+    parallel_for(partitions, [&](size_t partition) {
+        for (const auto& it : maps[partition]) {
+            occur[uniqueIndices[it.second.first]] = it.second.count;
+        }
+    });
+    parallel_for(len, [&](size_t i) {
+        inToOut[i] = uniqueIndices[inToOut[i]];
+    });
+    return uniqueNum;
+}
+}  // namespace
+
 bool Unique::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept {
     try {
         if (!ov::is_type<op::v10::Unique>(op)) {
@@ -190,91 +418,18 @@ void Unique::flattenTensorExec() {
     const size_t inputLen = getSrcMemoryAtPort(IN_DATA)->getSize() / sizeof(T);
     std::vector<T> uniDataTmp(inputLen);
     auto uniDataTmpPtr = uniDataTmp.data();
-    int* firstTmpPtr = nullptr;
-    int* inToOutTmpPtr = nullptr;
-    int* occurTmpPtr = nullptr;
-    if (definedOutputs[FIRST_UNIQUE_IDX]) {
-        firstTmpPtr = firstUniTmp.data();
-    }
-    if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
-        inToOutTmpPtr = inToOutTmp.data();
-    }
-    if (definedOutputs[OCCURRENCES_NUM]) {
-        occurTmpPtr = occurTmp.data();
-    }
-    uniqueLen = inputLen;
-
-    if (sorted) {
-        cpu_parallel_memcpy(uniDataTmpPtr, srcDataPtr, inputLen * sizeof(T));
-        std::sort(uniDataTmpPtr, uniDataTmpPtr + inputLen);
-        auto* last = std::unique(uniDataTmpPtr, uniDataTmpPtr + inputLen);
-        uniqueLen = last - uniDataTmpPtr;
-
-        if (definedOutputs[FIRST_UNIQUE_IDX]) {
-            T* first = uniDataTmpPtr;
-            for (T* it = first; it < last; it++) {
-                for (size_t i = 0; i < inputLen; i++) {
-                    if (srcDataPtr[i] == *it) {
-                        *firstTmpPtr++ = i;
-                        first++;
-                        break;
-                    }
-                }
-            }
-        }
-        if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
-            for (size_t i = 0; i < inputLen; i++) {
-                if (i > 0 && srcDataPtr[i] == srcDataPtr[i - 1]) {
-                    inToOutTmpPtr[i] = inToOutTmpPtr[i - 1];
-                    continue;
-                }
-                for (size_t j = 0; j < uniqueLen; j++) {
-                    if (srcDataPtr[i] == uniDataTmpPtr[j]) {
-                        inToOutTmpPtr[i] = j;
-                        break;
-                    }
-                }
-            }
-        }
-        if (definedOutputs[OCCURRENCES_NUM]) {
-            std::fill(occurTmpPtr, occurTmpPtr + uniqueLen, 0);
-            for (size_t j = 0; j < uniqueLen; j++) {
-                for (size_t i = 0; i < inputLen; i++) {
-                    if (srcDataPtr[i] == uniDataTmpPtr[j]) {
-                        occurTmpPtr[j]++;
-                    }
-                }
-            }
-        }
+    // all the outputs are computed, the tmp buffers are allocated for each of them in prepareParams
+    int* firstTmpPtr = firstUniTmp.data();
+    int* inToOutTmpPtr = inToOutTmp.data();
+    int* occurTmpPtr = occurTmp.data();
+
+    if constexpr (sizeof(T) == 1) {
+        uniqueLen =
+            uniqueByHistogram(srcDataPtr, inputLen, sorted, uniDataTmpPtr, firstTmpPtr, inToOutTmpPtr, occurTmpPtr);
+    } else if (sorted) {
+        uniqueLen = uniqueBySort(srcDataPtr, inputLen, uniDataTmpPtr, firstTmpPtr, inToOutTmpPtr, occurTmpPtr);
     } else {
-        std::unordered_map<T, int32_t> uniq;
-        uniq.reserve(inputLen);
-
-        if (definedOutputs[OCCURRENCES_NUM]) {
-            std::fill(occurTmpPtr, occurTmpPtr + inputLen, 1);
-        }
-
-        for (size_t i = 0, j = 0; i < inputLen; ++i) {
-            auto it = uniq.emplace(srcDataPtr[i], j);
-            if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
-                inToOutTmpPtr[i] = it.first->second;
-                if (it.second) {
-                    if (definedOutputs[FIRST_UNIQUE_IDX]) {
-                        firstTmpPtr[j] = i;
-                    }
-                    ++j;
-                } else {
-                    if (definedOutputs[OCCURRENCES_NUM]) {
-                        occurTmpPtr[inToOutTmpPtr[i]]++;
-                    }
-                }
-            }
-        }
-
-        uniqueLen = static_cast<int64_t>(uniq.size());
-        for (const auto& it : uniq) {
-            uniDataTmpPtr[it.second] = it.first;
-        }
+        uniqueLen = uniqueByHash(srcDataPtr, inputLen, uniDataTmpPtr, firstTmpPtr, inToOutTmpPtr, occurTmpPtr);
     }
 
     redefineOutputMemory({{uniqueLen}, {uniqueLen}, {inputLen}, {uniqueLen}});
@@ -41,6 +41,7 @@
 #include "nodes/gather_elements.h"
 #include "nodes/gather_nd.h"
 #include "nodes/gather_tree.h"
+#include "nodes/gathered_lora.h"
 #include "nodes/generate_proposals.h"
 #include "nodes/grn.h"
 #include "nodes/if.h"
@@ -113,6 +114,7 @@
 #    include "nodes/grid_sample.hpp"
 #    include "nodes/interaction.h"
 #    include "nodes/llm_mlp.h"
+#    include "nodes/moe.h"
 #    include "nodes/paged_attn.h"
 #    include "nodes/qkv_proj.h"
 #    include "nodes/rms_norm.h"
@@ -237,11 +239,13 @@ Node::NodesFactory::NodesFactory() : Factory("NodesFactory") {
     INTEL_CPU_NODE(SearchSorted, Type::SearchSorted);
     INTEL_CPU_NODE(SegmentMax, Type::SegmentMax);
     INTEL_CPU_NODE(LoRA, Type::LoRA);
+    INTEL_CPU_NODE(GatheredLoRA, Type::GatheredLoRA);
 #if defined(OPENVINO_ARCH_X86_64)
     INTEL_CPU_NODE(FakeQuantize, Type::FakeQuantize);
     INTEL_CPU_NODE(GridSample, Type::GridSample);
     INTEL_CPU_NODE(Interaction, Type::Interaction);
     INTEL_CPU_NODE(LLMMLP, Type::LLMMLP);
+    INTEL_CPU_NODE(MoE, Type::MoE);
     INTEL_CPU_NODE(QKVProjection, Type::QKVProjection);
     INTEL_CPU_NODE(PagedAttention, Type::PagedAttention);
     INTEL_CPU_NODE(RMSNorm, Type::RMS);
@@ -38,6 +38,7 @@
 #include "openvino/runtime/intel_cpu/properties.hpp"
 #include "openvino/runtime/internal_properties.hpp"
 #include "openvino/runtime/iplugin.hpp"
+#include "openvino/runtime/make_tensor.hpp"
 #include "openvino/runtime/properties.hpp"
 #include "openvino/runtime/shared_buffer.hpp"
 #include "openvino/runtime/threading/cpu_message.hpp"
@@ -593,6 +594,9 @@ std::shared_ptr<ov::ICompiledModel> Plugin::import_model(const ov::Tensor& model
         std::make_shared<ov::SharedBuffer<ov::Tensor>>(reinterpret_cast<char*>(model_tensor.data()),
                                                        model_tensor.get_byte_size(),
                                                        model_tensor);
+    // the blob mapped from the file keeps the mapping as the shared object of the tensor, while the blob read into
+    // memory owns its data
+    const bool mapped_blob = ov::get_tensor_impl(model_tensor)._so != nullptr;
 
     ModelDeserializer deserializer(
         model_buffer,
@@ -600,7 +604,8 @@ std::shared_ptr<ov::ICompiledModel> Plugin::import_model(const ov::Tensor& model
             return get_core()->read_model(model, weights);
         },
         decrypt,
-        decript_from_string);
+        decript_from_string,
+        mapped_blob);
 
     return deserialize_model(deserializer, config);
 }
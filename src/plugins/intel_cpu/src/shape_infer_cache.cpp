@@ -0,0 +1,82 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shape_infer_cache.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "common/primitive_hashing_utils.hpp"
+#include "cpu_types.h"
+#include "edge.h"
+#include "node.h"
+
+namespace ov::intel_cpu {
+
+size_t ShapeInferCache::Key::hash() const {
+    using namespace dnnl::impl::primitive_hashing;
+
+    size_t seed = 0;
+    for (const auto& d : dims) {
+        seed = get_vector_hash(seed, d);
+    }
+    return seed;
+}
+
+bool ShapeInferCache::Key::operator==(const Key& rhs) const {
+    return dims == rhs.dims;
+}
+
+ShapeInferCache::ShapeInferCache(const std::vector<NodePtr>& executableNodes, size_t capacity)
+    : m_records(capacity) {
+    m_reusable.reserve(executableNodes.size());
+    for (const auto& node : executableNodes) {
+        m_reusable.push_back(node->isShapeInferResultReusable());
+    }
+}
+
+bool ShapeInferCache::isApplicable(const std::vector<NodePtr>& executableNodes) {
+    return std::any_of(executableNodes.begin(), executableNodes.end(), [](const NodePtr& node) {
+        return node->isShapeInferResultReusable();
+    });
+}
+
+void ShapeInferCache::select(const std::vector<NodePtr>& inputNodes) {
+    m_key.dims.resize(inputNodes.size());
+    for (size_t i = 0; i < inputNodes.size(); ++i) {
+        const auto& node = inputNodes[i];
+        // the key does not have to be exact, since the records are validated per node
+        if (!node || node->getChildEdges().empty()) {
+            m_key.dims[i].clear();
+            continue;
+        }
+        m_key.dims[i] = node->getChildEdgeAt(0)->getMemory().getShape().getDims();
+    }
+
+    m_current = m_records.get(m_key);
+    if (!m_current) {
+        m_current = std::make_shared<Records>(m_reusable.size());
+        m_records.put(m_key, m_current);
+    }
+}
+
+void ShapeInferCache::updateShapes(const NodePtr& node, size_t index) {
+    if (m_current && m_reusable[index]) {
+        node->updateShapes((*m_current)[index]);
+    } else {
+        node->updateShapes();
+    }
+}
+
+void ShapeInferCache::updateDynamicParams(const NodePtr& node, size_t index) {
+    if (m_current && m_reusable[index]) {
+        node->updateDynamicParams((*m_current)[index]);
+    } else {
+        node->updateDynamicParams();
+    }
+}
+
+}  // namespace ov::intel_cpu
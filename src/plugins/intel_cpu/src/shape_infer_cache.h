@@ -0,0 +1,76 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "cache/lru_cache.h"
+#include "cpu_types.h"
+#include "node.h"
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Keeps the results of the shape inference of the dynamic graph nodes and the state prepared by the nodes for
+ * them per the graph input shapes, so the shape inference and prepareParams() of the nodes are skipped when the graph
+ * is executed with the input shapes seen before.
+ * The records of a node are additionally validated against the actual input shapes of the node, so the nodes
+ * downstream of the data dependent shapes (e.g. NonZero, Reshape with the target shape computed at runtime) fall back
+ * to the regular shape inference if their input shapes differ.
+ *
+ * @attention The cache IS NOT THREAD SAFE. select() must be called before the shapes update of the graph, while
+ * updateShapes() and updateDynamicParams() may be called for different nodes from one thread at a time, the latter
+ * after the former for the same node.
+ */
+class ShapeInferCache {
+public:
+    ShapeInferCache(const std::vector<NodePtr>& executableNodes, size_t capacity);
+
+    /**
+     * @brief Tells whether at least one of the nodes may reuse the shape inference results
+     */
+    static bool isApplicable(const std::vector<NodePtr>& executableNodes);
+
+    /**
+     * @brief Selects the records for the current input shapes of the graph
+     * @param inputNodes input nodes of the graph
+     */
+    void select(const std::vector<NodePtr>& inputNodes);
+
+    /**
+     * @brief Updates the output shapes of the dynamic executable node
+     * @param node the node to be updated
+     * @param index index of the node in the executable nodes the cache is created for
+     */
+    void updateShapes(const NodePtr& node, size_t index);
+
+    /**
+     * @brief Prepares the params of the dynamic executable node or restores the ones prepared for the same shapes
+     * @param node the node to be updated
+     * @param index index of the node in the executable nodes the cache is created for
+     */
+    void updateDynamicParams(const NodePtr& node, size_t index);
+
+private:
+    struct Key {
+        std::vector<VectorDims> dims;
+
+        [[nodiscard]] size_t hash() const;
+        bool operator==(const Key& rhs) const;
+    };
+
+    using Records = std::vector<ShapeInferRecord>;
+
+    std::vector<bool> m_reusable;
+    LruCache<Key, std::shared_ptr<Records>> m_records;
+    std::shared_ptr<Records> m_current;
+    Key m_key;
+};
+
+using ShapeInferCachePtr = std::shared_ptr<ShapeInferCache>;
+
+}  // namespace ov::intel_cpu
@@ -43,6 +43,11 @@ public:
         return EMPTY_PORT_MASK;
     }
 
+    // the subgraph keeps the inferred master shape, so the shape inference must not be skipped
+    [[nodiscard]] bool is_result_reusable() const override {
+        return false;
+    }
+
 private:
     std::shared_ptr<snippets::op::Subgraph> m_subgraph;
     std::map<snippets::ShapeInferStatus, ov::intel_cpu::ShapeInferStatus> m_status_map;
@@ -329,6 +329,10 @@ public:
         return EMPTY_PORT_MASK;
     }
 
+    [[nodiscard]] bool is_result_reusable() const override {
+        return true;
+    }
+
 protected:
     std::vector<int64_t> m_input_ranks;
     std::shared_ptr<ov::Node> m_node;
@@ -461,6 +465,11 @@ public:
         return m_pads_end;
     }
 
+    // the paddings are read by the node after the shape inference
+    [[nodiscard]] bool is_result_reusable() const override {
+        return false;
+    }
+
 protected:
     ov::CoordinateDiff m_pads_begin, m_pads_end;
 };
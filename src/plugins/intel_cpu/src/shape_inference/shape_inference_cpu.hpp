@@ -63,6 +63,17 @@ public:
      * @return port_mask_t a bit mask where each bit corresponds to an input port number.
      */
     [[nodiscard]] virtual port_mask_t get_port_mask() const = 0;
+
+    /**
+     * @brief Tells whether the result of the shape inference depends only on the input shapes and the input data
+     * defined by get_port_mask(), i.e. the implementation keeps no state which is used after the infer() call (like
+     * the paddings) and may be skipped if the inputs are the same as in one of the previous calls.
+     *
+     * @return true if the result of the previous call can be reused
+     */
+    [[nodiscard]] virtual bool is_result_reusable() const {
+        return false;
+    }
 };
 
 /**
@@ -78,6 +89,9 @@ public:
     const ov::CoordinateDiff& get_pads_end() override final {
         return m_emptyVec;
     }
+    [[nodiscard]] bool is_result_reusable() const override {
+        return true;
+    }
 
 private:
     static const ov::CoordinateDiff m_emptyVec;
@@ -0,0 +1,65 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "moe.hpp"
+
+#include <cstddef>
+#include <memory>
+
+#include "openvino/core/attribute_visitor.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/node_vector.hpp"
+#include "transformations/itt.hpp"
+
+namespace ov::intel_cpu {
+
+bool MoENode::visit_attributes(ov::AttributeVisitor& visitor) {
+    INTERNAL_OP_SCOPE(MoENode_visit_attributes);
+    visitor.start_structure("config");
+    visitor.on_attribute("act", m_config.act);
+    visitor.on_attribute("weights_compressed", m_config.weights_compressed);
+    visitor.on_attribute("has_zero_points", m_config.has_zero_points);
+    visitor.on_attribute("expert_num", m_config.expert_num);
+    visitor.on_attribute("topk", m_config.topk);
+    visitor.on_attribute("hidden_size", m_config.hidden_size);
+    visitor.on_attribute("intermediate_size", m_config.intermediate_size);
+    visitor.finish_structure();
+    return true;
+}
+
+void MoENode::validate_and_infer_types() {
+    INTERNAL_OP_SCOPE(MoENode_validate_and_infer_types);
+    size_t expect_input_size = 6;
+    if (m_config.weights_compressed) {
+        expect_input_size += 3;
+    }
+    if (m_config.has_zero_points) {
+        NODE_VALIDATION_CHECK(this, m_config.weights_compressed, "zero points require compressed weights");
+        expect_input_size += 3;
+    }
+    NODE_VALIDATION_CHECK(this, get_input_size() == expect_input_size);
+
+    const auto& ishape = get_input_partial_shape(0);
+    const auto& itype = get_input_element_type(0);
+    NODE_VALIDATION_CHECK(this, ishape.rank().is_static() && ishape.rank().get_length() >= 2);
+    NODE_VALIDATION_CHECK(this, ishape[ishape.size() - 1].compatible(m_config.hidden_size));
+    NODE_VALIDATION_CHECK(this, itype.is_real(), "feature data type must be real");
+
+    const auto& indices_shape = get_input_partial_shape(1);
+    NODE_VALIDATION_CHECK(this, indices_shape.rank().compatible(2), "expert indices must be 2D");
+    NODE_VALIDATION_CHECK(this, get_input_element_type(1).is_integral_number(), "expert indices must be integer");
+    NODE_VALIDATION_CHECK(this,
+                          get_input_partial_shape(2).compatible(indices_shape),
+                          "routing weights must have the shape of expert indices");
+
+    set_output_type(0, itype, ishape);
+}
+
+std::shared_ptr<Node> MoENode::clone_with_new_inputs(const ov::OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(MoENode_with_new_inputs);
+    check_new_args_count(this, new_args);
+    return std::make_shared<MoENode>(new_args, m_config);
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,72 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+
+#include "openvino/core/attribute_visitor.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/node_vector.hpp"
+#include "openvino/core/rtti.hpp"
+#include "openvino/op/op.hpp"
+#include "transformations/cpu_opset/x64/op/llm_mlp.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Mixture-of-Experts block: every token is processed by the gated MLPs of its top-k experts and the results
+ * are summed with the routing weights.
+ *
+ *     out[t] = sum_j weights[t, j] * down[e] x (act(gate[e] x in[t]) * (up[e] x in[t])),  e = indices[t, j]
+ *
+ * The expert weights are stacked along the leading dimension. The compressed experts keep the integer weights and
+ * are de-quantized per output channel: (w - zero_point) * scale.
+ */
+class MoENode : public ov::op::Op {
+public:
+    OPENVINO_OP("MoE", "cpu_plugin_opset");
+
+    MoENode() = default;
+
+    struct Config {
+        LLMMLPNode::ACT_FN act;
+        bool weights_compressed;
+        bool has_zero_points;
+        int expert_num;
+        int topk;
+        int hidden_size;
+        int intermediate_size;
+    };
+
+    // args:
+    //      0: input            [..., hidden_size]
+    //      1: expert indices   [tokens, topk]
+    //      2: routing weights  [tokens, topk]
+    //      3: gate_proj        [expert_num, intermediate_size, hidden_size]
+    //      4: up_proj          [expert_num, intermediate_size, hidden_size]
+    //      5: down_proj        [expert_num, hidden_size, intermediate_size]
+    //      6-8: gate/up/down scales per OC [expert_num, N, 1] (weights_compressed only)
+    //      9-11: gate/up/down zero points per OC [expert_num, N, 1] (has_zero_points only)
+    MoENode(const OutputVector& args, const Config& cfg) : Op(args), m_config(cfg) {
+        validate_and_infer_types();
+    }
+
+    bool visit_attributes(ov::AttributeVisitor& visitor) override;
+
+    void validate_and_infer_types() override;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+
+    const Config& get_config() const {
+        return m_config;
+    }
+
+private:
+    Config m_config{};
+};
+
+}  // namespace intel_cpu
+}  // namespace ov
@@ -0,0 +1,322 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "moe_fusion.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "openvino/cc/pass/itt.hpp"
+#include "openvino/core/graph_util.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/node_vector.hpp"
+#include "openvino/core/rt_info.hpp"
+#include "openvino/core/shape.hpp"
+#include "openvino/core/type.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/gelu.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/reduce_sum.hpp"
+#include "openvino/op/reshape.hpp"
+#include "openvino/op/scatter_elements_update.hpp"
+#include "openvino/op/subtract.hpp"
+#include "openvino/op/swish.hpp"
+#include "openvino/op/transpose.hpp"
+#include "openvino/op/unsqueeze.hpp"
+#include "openvino/op/util/broadcast_base.hpp"
+#include "openvino/op/util/topk_base.hpp"
+#include "openvino/pass/matcher_pass.hpp"
+#include "openvino/pass/pattern/matcher.hpp"
+#include "openvino/util/pp.hpp"
+#include "transformations/cpu_opset/x64/op/llm_mlp.hpp"
+#include "transformations/cpu_opset/x64/op/moe.hpp"
+#include "transformations/utils/gen_pattern.hpp"
+#include "utils/general_utils.h"
+
+using namespace ov::gen_pattern;
+using namespace ov::pass;
+
+namespace {
+
+// stacked expert weights [experts, N, K], either plain or de-quantized per OC: (convert(w) - zp) * scale
+struct ExpertWeightPattern {
+    std::shared_ptr<ov::Node> weight;
+    std::shared_ptr<ov::Node> zero_point;
+    std::shared_ptr<ov::Node> scale;
+    std::shared_ptr<ov::Node> output;
+
+    ExpertWeightPattern() {
+        weight = makePattern<ov::op::v0::Constant>({});
+        auto converted = makePattern<ov::op::v0::Convert>({weight});
+
+        zero_point = makePattern<ov::op::v0::Constant>({});
+        auto zero_point_f32 = makePattern<ov::op::v0::Convert>({zero_point});
+        auto shifted =
+            makePattern<ov::op::v1::Subtract>({converted, zero_point | zero_point_f32}, {{"auto_broadcast", "numpy"}});
+
+        scale = makePattern<ov::op::v0::Constant>({});
+        auto scale_f32 = makePattern<ov::op::v0::Convert>({scale});
+        auto scaled = makePattern<ov::op::v1::Multiply>({converted | shifted, scale | scale_f32},
+                                                        {{"auto_broadcast", "numpy"}});
+        auto scaled_f32 = makePattern<ov::op::v0::Convert>({scaled});
+
+        output = weight | converted | scaled | scaled_f32;
+    }
+};
+
+struct ExpertWeight {
+    ov::Output<ov::Node> weight;
+    std::shared_ptr<ov::Node> scale;
+    std::shared_ptr<ov::Node> zero_point;
+    bool compressed = false;
+};
+
+// per OC constant [experts, N, 1] (or a scalar broadcasted to it) re-created in f32 for the node
+std::shared_ptr<ov::Node> make_per_oc_constant(const ov::Output<ov::Node>& value, size_t experts, size_t N) {
+    auto constant = ov::as_type_ptr<ov::op::v0::Constant>(value.get_node_shared_ptr());
+    if (!constant) {
+        return nullptr;
+    }
+    const ov::Shape shape{experts, N, 1};
+    const auto& src_shape = constant->get_shape();
+    auto values = constant->cast_vector<float>();
+    if (ov::shape_size(src_shape) == 1) {
+        values.resize(ov::shape_size(shape), values[0]);
+    } else if (src_shape != shape) {
+        return nullptr;
+    }
+    return std::make_shared<ov::op::v0::Constant>(ov::element::f32, shape, values);
+}
+
+bool match_expert_weight(const ov::pass::pattern::PatternValueMap& pattern_map,
+                         const ExpertWeightPattern& pattern,
+                         const ov::Shape& expected_shape,
+                         ExpertWeight& result) {
+    const auto& weight = pattern_map.at(pattern.weight);
+    if (weight.get_partial_shape() != expected_shape) {
+        return false;
+    }
+    const auto type = weight.get_element_type();
+    result.weight = weight;
+    result.compressed = pattern_map.count(pattern.scale) > 0;
+    if (!result.compressed) {
+        return ov::intel_cpu::any_of(type, ov::element::f32, ov::element::f16, ov::element::bf16);
+    }
+    if (!ov::intel_cpu::any_of(type, ov::element::u8, ov::element::i8, ov::element::u4, ov::element::i4)) {
+        return false;
+    }
+    const auto experts = expected_shape[0];
+    const auto N = expected_shape[1];
+    result.scale = make_per_oc_constant(pattern_map.at(pattern.scale), experts, N);
+    if (!result.scale) {
+        return false;
+    }
+    if (pattern_map.count(pattern.zero_point) > 0) {
+        result.zero_point = make_per_oc_constant(pattern_map.at(pattern.zero_point), experts, N);
+        if (!result.zero_point) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// the routing matrix is built by scattering the routing weights into zeros
+bool is_zero_filled(const ov::Output<ov::Node>& value) {
+    auto node = value.get_node_shared_ptr();
+    if (ov::is_type<ov::op::util::BroadcastBase>(node)) {
+        node = node->get_input_node_shared_ptr(0);
+    }
+    auto constant = ov::as_type_ptr<ov::op::v0::Constant>(node);
+    if (!constant) {
+        return false;
+    }
+    const auto values = constant->cast_vector<float>();
+    return std::all_of(values.begin(), values.end(), [](float v) {
+        return v == 0.0F;
+    });
+}
+
+// every token must select distinct experts, otherwise the scatter overwrites the duplicates
+bool is_topk_indices(const ov::Output<ov::Node>& value) {
+    auto output = value;
+    if (ov::is_type<ov::op::v0::Convert>(output.get_node())) {
+        output = output.get_node()->input_value(0);
+    }
+    return ov::is_type<ov::op::util::TopKBase>(output.get_node()) && output.get_index() == 1;
+}
+
+}  // namespace
+
+ov::intel_cpu::MoEFusion::MoEFusion() {
+    MATCHER_SCOPE(MoEFusion);
+
+    auto input = makePattern("[?,?]");  // [tokens, hidden_size]
+
+    // routing matrix [tokens, experts] of the top-k experts of every token
+    auto zeros = makePattern();
+    auto expert_indices = makePattern();
+    auto routing_weights = makePattern();
+    auto scatter_axis = makePattern();
+    auto routing_v3 =
+        makePattern<ov::op::v3::ScatterElementsUpdate>({zeros, expert_indices, routing_weights, scatter_axis});
+    auto routing_v12 =
+        makePattern<ov::op::v12::ScatterElementsUpdate>({zeros, expert_indices, routing_weights, scatter_axis});
+    auto routing = routing_v3 | routing_v12;
+    auto routing_t = makePattern<ov::op::v1::Transpose>({routing, {1, 0}});  // [experts, tokens]
+    auto routing_unsqueeze = makePattern<ov::op::v0::Unsqueeze>({routing_t, makePattern()});
+    auto routing_reshape = makePattern<ov::op::v1::Reshape>({routing_t, makePattern()});
+    auto expert_scales = routing_unsqueeze | routing_reshape;  // [experts, tokens, 1]
+
+    ExpertWeightPattern gate_weight;  // [experts, intermediate_size, hidden_size]
+    ExpertWeightPattern up_weight;    // [experts, intermediate_size, hidden_size]
+    ExpertWeightPattern down_weight;  // [experts, hidden_size, intermediate_size]
+
+    // every expert is applied to every token: [experts, tokens, N]
+    auto gate_proj = makePattern<ov::op::v0::MatMul>({input, gate_weight.output},
+                                                     {{"transpose_a", false}, {"transpose_b", true}});
+    auto up_proj = makePattern<ov::op::v0::MatMul>({input, up_weight.output},
+                                                   {{"transpose_a", false}, {"transpose_b", true}});
+    auto silu_gate = makePattern<ov::op::v4::Swish>({gate_proj});
+    auto gelu_gate = makePattern<ov::op::v7::Gelu>({gate_proj});
+    auto gated_up =
+        makePattern<ov::op::v1::Multiply>({silu_gate | gelu_gate, up_proj}, {{"auto_broadcast", "numpy"}});
+    auto down_proj = makePattern<ov::op::v0::MatMul>({gated_up, down_weight.output},
+                                                     {{"transpose_a", false}, {"transpose_b", true}});
+
+    auto weighted = makePattern<ov::op::v1::Multiply>({down_proj, expert_scales}, {{"auto_broadcast", "numpy"}}) |
+                    makePattern<ov::op::v1::Multiply>({expert_scales, down_proj}, {{"auto_broadcast", "numpy"}});
+    auto result = makePattern<ov::op::v1::ReduceSum>({weighted, 0}, {{"keep_dims", false}});  // [tokens, hidden_size]
+
+    matcher_pass_callback callback = [OV_CAPTURE_CPY_AND_THIS](ov::pass::pattern::Matcher& m) {
+        PatternValidator validator(m);
+        if (!validator) {
+            return false;
+        }
+
+        const auto& pattern_map = m.get_pattern_value_map();
+        auto root = m.get_match_root();
+        auto src = pattern_map.at(input);
+        if (!src.get_element_type().is_real()) {
+            return false;
+        }
+
+        // gelu is fused in its exact form only
+        LLMMLPNode::ACT_FN act = LLMMLPNode::ACT_FN::SILU;
+        if (pattern_map.count(gelu_gate) > 0) {
+            auto gelu = ov::as_type_ptr<ov::op::v7::Gelu>(pattern_map.at(gelu_gate).get_node_shared_ptr());
+            if (!gelu || gelu->get_approximation_mode() != ov::op::GeluApproximationMode::ERF) {
+                return false;
+            }
+            act = LLMMLPNode::ACT_FN::GELU;
+        }
+
+        if (pattern_map.count(routing_v12) > 0) {
+            auto scatter = ov::as_type_ptr<ov::op::v12::ScatterElementsUpdate>(
+                pattern_map.at(routing_v12).get_node_shared_ptr());
+            if (!scatter || none_of(scatter->get_reduction(),
+                                    ov::op::v12::ScatterElementsUpdate::Reduction::NONE,
+                                    ov::op::v12::ScatterElementsUpdate::Reduction::SUM)) {
+                return false;
+            }
+        }
+        auto axis = ov::as_type_ptr<ov::op::v0::Constant>(pattern_map.at(scatter_axis).get_node_shared_ptr());
+        if (!axis || ov::shape_size(axis->get_shape()) != 1 || none_of(axis->cast_vector<int64_t>()[0], 1, -1)) {
+            return false;
+        }
+        if (!is_zero_filled(pattern_map.at(zeros)) || !is_topk_indices(pattern_map.at(expert_indices))) {
+            return false;
+        }
+
+        const auto& gate_pshape = pattern_map.at(gate_weight.weight).get_partial_shape();
+        if (!gate_pshape.is_static() || gate_pshape.size() != 3) {
+            return false;
+        }
+        const auto experts = gate_pshape[0].get_length();
+        const auto intermediate_size = gate_pshape[1].get_length();
+        const auto hidden_size = gate_pshape[2].get_length();
+        const ov::Shape gate_up_shape{static_cast<size_t>(experts),
+                                      static_cast<size_t>(intermediate_size),
+                                      static_cast<size_t>(hidden_size)};
+        const ov::Shape down_shape{static_cast<size_t>(experts),
+                                   static_cast<size_t>(hidden_size),
+                                   static_cast<size_t>(intermediate_size)};
+
+        ExpertWeight gate_w;
+        ExpertWeight up_w;
+        ExpertWeight down_w;
+        if (!match_expert_weight(pattern_map, gate_weight, gate_up_shape, gate_w) ||
+            !match_expert_weight(pattern_map, up_weight, gate_up_shape, up_w) ||
+            !match_expert_weight(pattern_map, down_weight, down_shape, down_w)) {
+            return false;
+        }
+        // all the projections are compressed (with or without zero points) or none of them
+        if (gate_w.compressed != up_w.compressed || gate_w.compressed != down_w.compressed) {
+            return false;
+        }
+        const bool has_zero_points = gate_w.zero_point != nullptr;
+        if ((up_w.zero_point != nullptr) != has_zero_points || (down_w.zero_point != nullptr) != has_zero_points) {
+            return false;
+        }
+
+        // the routing matrix must be [tokens, experts] and the top-k size must be known
+        const auto& routing_pshape = pattern_map.at(routing).get_partial_shape();
+        const auto& indices_pshape = pattern_map.at(expert_indices).get_partial_shape();
+        if (routing_pshape.size() != 2 || !routing_pshape[1].compatible(experts) || indices_pshape.size() != 2 ||
+            indices_pshape[1].is_dynamic()) {
+            return false;
+        }
+        const auto& scales_pshape = pattern_map.at(expert_scales).get_partial_shape();
+        if (scales_pshape.size() != 3 || !scales_pshape[0].compatible(experts) || scales_pshape[2] != 1) {
+            return false;
+        }
+
+        MoENode::Config config{};
+        config.act = act;
+        config.weights_compressed = gate_w.compressed;
+        config.has_zero_points = has_zero_points;
+        config.expert_num = static_cast<int>(experts);
+        config.topk = static_cast<int>(indices_pshape[1].get_length());
+        config.hidden_size = static_cast<int>(hidden_size);
+        config.intermediate_size = static_cast<int>(intermediate_size);
+
+        OutputVector new_args{src,
+                              pattern_map.at(expert_indices),
+                              pattern_map.at(routing_weights),
+                              gate_w.weight,
+                              up_w.weight,
+                              down_w.weight};
+        if (config.weights_compressed) {
+            new_args.insert(new_args.end(), {gate_w.scale, up_w.scale, down_w.scale});
+        }
+        if (config.has_zero_points) {
+            new_args.insert(new_args.end(), {gate_w.zero_point, up_w.zero_point, down_w.zero_point});
+        }
+
+        const auto& old_node = root;
+        auto new_node = std::make_shared<MoENode>(new_args, config);
+        new_node->set_friendly_name(old_node->get_friendly_name());
+        ov::copy_runtime_info({pattern_map.at(gate_proj).get_node_shared_ptr(),
+                               pattern_map.at(up_proj).get_node_shared_ptr(),
+                               pattern_map.at(down_proj).get_node_shared_ptr(),
+                               pattern_map.at(routing).get_node_shared_ptr(),
+                               old_node},
+                              new_node);
+        // callback is for plugin implementation to check if it can be supported
+        if (!transformation_callback(new_node)) {
+            return false;
+        }
+
+        ov::replace_node(old_node, new_node);
+        return true;
+    };
+
+    auto m = std::make_shared<ov::pass::pattern::Matcher>(result, matcher_name);
+    this->register_matcher(m, callback);
+}
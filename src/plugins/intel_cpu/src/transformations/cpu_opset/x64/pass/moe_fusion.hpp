@@ -0,0 +1,24 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/matcher_pass.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Fuses the dense form of the Mixture-of-Experts block into MoENode.
+ *
+ * The top-k routing weights are scattered into the [tokens, experts] matrix, all the experts are applied to all the
+ * tokens by the MatMuls with the stacked [experts, N, K] weights, and the expert outputs are weighted by the
+ * transposed routing matrix and reduced over the experts. MoENode computes only the selected experts.
+ */
+class MoEFusion : public ov::pass::MatcherPass {
+public:
+    OPENVINO_MATCHER_PASS_RTTI("MoEFusion");
+    MoEFusion();
+};
+
+}  // namespace ov::intel_cpu
@@ -64,6 +64,7 @@
 #include "transformations/common_optimizations/convert_quantize_dequantize.hpp"
 #include "transformations/common_optimizations/fq_mul_fusion.hpp"
 #include "transformations/common_optimizations/fuse_rotary_positional_embeddings.hpp"
+#include "transformations/common_optimizations/gathered_lora_fusion.hpp"
 #include "transformations/common_optimizations/lora_subgraph_fusion.hpp"
 #include "transformations/common_optimizations/lstm_cell_fusion.hpp"
 #include "transformations/common_optimizations/mark_precision_sensitive_shapeof_subgraphs.hpp"
@@ -224,6 +225,7 @@
 #    include "low_precision/fuse_convert.hpp"
 #    include "low_precision/weightable_layer_transformation.hpp"
 #    include "nodes/llm_mlp.h"
+#    include "nodes/moe.h"
 #    include "nodes/qkv_proj.h"
 #    include "nodes/rms_norm.h"
 #    include "onednn/dnnl.h"
@@ -239,6 +241,7 @@
 #    include "transformations/cpu_opset/common/pass/decompose_rms_norm.hpp"
 #    include "transformations/cpu_opset/x64/pass/convert_to_interaction.hpp"
 #    include "transformations/cpu_opset/x64/pass/mlp_fusion.hpp"
+#    include "transformations/cpu_opset/x64/pass/moe_fusion.hpp"
 #    include "transformations/cpu_opset/x64/pass/qkv_proj_fusion.hpp"
 #    include "transformations/op_conversions/group_normalization_decomposition.hpp"
 #    include "transformations/op_conversions/hsigmoid_decomposition.hpp"
@@ -888,6 +891,7 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::KeepConstAndDecompression);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::ConstantFolding);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::LoraSubgraphFusion);
+    CPU_REGISTER_PASS_COMMON(manager, ov::pass::GatheredLoraFusion);
 
     manager.run_passes(model);
 }
@@ -1082,6 +1086,16 @@ void Transformations::PostLpt() {
 
     if (can_use_amx_bf16_int8 || can_use_amx_fp16) {
         const auto fcDynamicQuantizationGroupSize = config.fcDynamicQuantizationGroupSize;
+        // MoE goes first, so the expert MLPs stay inside the fused MoE block
+        CPU_REGISTER_PASS_X64(postLPTPassManager, MoEFusion);
+        CPU_SET_CALLBACK_X64(
+            postLPTPassManager,
+            [](const_node_ptr& node) -> bool {
+                std::string errorMsg;
+                return node::MoE::isSupportedOperation(node, errorMsg);
+            },
+            MoEFusion);
+
         CPU_REGISTER_PASS_X64(postLPTPassManager, MLPFusion);
         CPU_SET_CALLBACK_X64(
             postLPTPassManager,
@@ -720,6 +720,11 @@ std::ostream& operator<<(std::ostream& os, const MemoryStatisticsRecord& record)
     os << "Total unique blocks: " << record.total_unique_blocks << "\n";
     os << "Total size: " << record.total_size << " bytes\n";
     os << "Optimal total size: " << record.optimal_total_size << " bytes\n";
+    if (record.optimal_total_size > 0) {
+        // the optimal size is the lower bound (the max sum of the sizes of the regions alive at the same time)
+        const auto gap = static_cast<double>(record.total_size) / static_cast<double>(record.optimal_total_size) - 1.0;
+        os << "Gap to optimal total size: " << gap * 100.0 << " %\n";
+    }
     os << "Max region size: " << record.max_region_size << " bytes\n";
     return os;
 }
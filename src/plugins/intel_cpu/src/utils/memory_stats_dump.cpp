@@ -49,9 +49,14 @@ static void dumpStatistics(std::ostream& os,
         }
     }
     os << "Weights cache statistics\n";
+    os << "Replication policy: " << weights_cache.getPolicy() << "\n";
     auto weights_statistics = weights_cache.dumpStatistics();
     for (auto&& item : weights_statistics) {
-        os << "Socket ID: " << item.first << "\n";
+        if (item.first < 0) {
+            os << "Socket ID: all\n";
+        } else {
+            os << "Socket ID: " << item.first << "\n";
+        }
         os << "Total size: " << item.second.total_size << " bytes\n";
         os << "Total memory objects: " << item.second.total_memory_objects << "\n";
     }
@@ -91,6 +96,7 @@ static void dumpStatisticsCSV(std::ofstream& os,
     if (!weights_statistics.empty()) {
         os << ";;;;;;\n";
         os << "Weights cache statistics;;;;;;\n";
+        os << "Replication policy;" << weights_cache.getPolicy() << ";;;;;\n";
         os << "Socket ID;Total size [bytes];Total memory objects [-];;;\n";
     }
 
@@ -4,9 +4,17 @@
 
 #include "serialize.hpp"
 
+#if defined(__linux__)
+#    include <sys/mman.h>
+#    include <unistd.h>
+#endif
+
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
 #include <functional>
+#include <future>
 #include <istream>
 #include <memory>
 #include <ostream>
@@ -16,6 +24,7 @@
 
 #include "openvino/core/except.hpp"
 #include "openvino/core/model.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/shape.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/pass/serialize.hpp"
@@ -23,9 +32,42 @@
 #include "openvino/runtime/shared_buffer.hpp"
 #include "openvino/runtime/tensor.hpp"
 #include "utils/codec_xor.hpp"
+#include "utils/general_utils.h"
 
 namespace ov::intel_cpu {
 
+namespace {
+// Faults in the pages of the mmaped weights section by chunks in parallel. It runs concurrently with the
+// topology deserialization, so the weights are resident by the time the graph compilation accesses them instead of
+// being read page by page on the first access.
+std::future<void> prefetch_weights(const char* data, size_t size) {
+    // not worth a thread for small models
+    constexpr size_t min_prefetch_size = 64 * 1024 * 1024;
+    if (size < min_prefetch_size) {
+        return {};
+    }
+
+    return std::async(std::launch::async, [data, size]() {
+#if defined(__linux__)
+        // start the asynchronous readahead of the whole section first
+        const auto page_size = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+        const auto begin = reinterpret_cast<uintptr_t>(data) & ~(page_size - 1);
+        madvise(reinterpret_cast<void*>(begin), reinterpret_cast<uintptr_t>(data) + size - begin, MADV_WILLNEED);
+#endif
+        constexpr size_t chunk_size = 4 * 1024 * 1024;
+        constexpr size_t page_stride = 4096;
+        ov::parallel_for(div_up(size, chunk_size), [&](size_t chunk_idx) {
+            const size_t end = std::min(size, (chunk_idx + 1) * chunk_size);
+            char sum = 0;
+            for (size_t offset = chunk_idx * chunk_size; offset < end; offset += page_stride) {
+                sum ^= data[offset];
+            }
+            [[maybe_unused]] volatile char sink = sum;
+        });
+    });
+}
+}  // namespace
+
 ////////// ModelSerializer //////////
 
 ModelSerializer::ModelSerializer(std::ostream& ostream, const CacheEncrypt& encrypt_fn)
@@ -52,10 +94,12 @@ bool ModelSerializer::use_absolute_offset() {
 ModelDeserializer::ModelDeserializer(std::shared_ptr<ov::AlignedBuffer>& model_buffer,
                                      ModelBuilder fn,
                                      const CacheDecrypt& decrypt_fn,
-                                     bool decript_from_string)
+                                     bool decript_from_string,
+                                     bool mapped_buffer)
     : m_model(model_buffer),
       m_model_builder(std::move(fn)),
-      m_decript_from_string(decript_from_string) {
+      m_decript_from_string(decript_from_string),
+      m_mapped_buffer(mapped_buffer) {
     if (m_decript_from_string) {
         m_cache_decrypt.m_decrypt_str = decrypt_fn.m_decrypt_str;
     } else {
@@ -117,11 +161,16 @@ void ModelDeserializer::process_model(std::shared_ptr<ov::Model>& model,
 
     // Map blob content
     std::shared_ptr<ov::AlignedBuffer> weights_buf;
+    std::future<void> weights_prefetch;
     if (hdr.consts_size) {
         weights_buf =
             std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::AlignedBuffer>>>(buffer_base + hdr.consts_offset,
                                                                                    hdr.consts_size,
                                                                                    model_buffer);
+        // the blob read into memory is resident already
+        if (m_mapped_buffer) {
+            weights_prefetch = prefetch_weights(buffer_base + hdr.consts_offset, hdr.consts_size);
+        }
     }
 
     // XML content
@@ -142,6 +191,10 @@ void ModelDeserializer::process_model(std::shared_ptr<ov::Model>& model,
 
     model = m_model_builder(model_buf, weights_buf);
 
+    if (weights_prefetch.valid()) {
+        weights_prefetch.wait();
+    }
+
     // Set Info
     pugi::xml_node root = xml_in_out_doc.child("cnndata");
     set_info(root, model);
@@ -38,7 +38,8 @@ public:
     ModelDeserializer(std::shared_ptr<ov::AlignedBuffer>& model_buffer,
                       ModelBuilder fn,
                       const CacheDecrypt& decrypt_fn,
-                      bool decript_from_string);
+                      bool decript_from_string,
+                      bool mapped_buffer = false);
 
     ModelDeserializer(std::istream& model_stream,
                       ModelBuilder fn,
@@ -59,6 +60,8 @@ protected:
     ModelBuilder m_model_builder;
     CacheDecrypt m_cache_decrypt;
     bool m_decript_from_string;
+    // the buffer is mapped from the file, so its weights are worth to be prefetched
+    bool m_mapped_buffer = false;
 };
 
 }  // namespace ov::intel_cpu
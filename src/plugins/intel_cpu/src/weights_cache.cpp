@@ -13,8 +13,10 @@
 #include <vector>
 
 #include "cpu_memory.h"
+#include "internal_properties.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/runtime/system_conf.hpp"
+#include "utils/debug_capabilities.h"
 
 namespace ov::intel_cpu {
 
@@ -60,6 +62,7 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::findOrCreate(const std::string
 
         if (!isCached()) {
             newPtr = create();
+            place(newPtr);
             ptr = std::make_shared<MemoryInfo>(newPtr, valid);
             sharedWeights[key] = ptr;
         }
@@ -91,10 +94,43 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::get(const std::string& key) co
                                           newPtr);
 }
 
-SocketsWeights::SocketsWeights() {
+void WeightsSharing::place(const MemoryPtr& memory) const {
+    if (!memory || memory->getSize() == 0 || get_num_numa_nodes() < 2) {
+        return;
+    }
+    switch (m_policy) {
+    case WeightsReplicationPolicy::REPLICATE:
+        // the memory is created on the streams of the socket, so bind it to the NUMA node of the calling stream unless
+        // the stream runs on another socket
+        if (m_socketId >= 0 && get_current_socket_id() == m_socketId &&
+            !mbind_move(memory, get_current_numa_node_id())) {
+            DEBUG_LOG("Failed to bind the weights to the NUMA node of socket ", m_socketId);
+        }
+        break;
+    case WeightsReplicationPolicy::INTERLEAVE:
+        if (!mbind_interleave(memory)) {
+            DEBUG_LOG("Failed to interleave the weights between the NUMA nodes");
+        }
+        break;
+    case WeightsReplicationPolicy::PER_SOCKET:
+    case WeightsReplicationPolicy::SINGLE_COPY:
+    default:
+        break;
+    }
+}
+
+bool SocketsWeights::isPerSocket() const {
+    return _policy == WeightsReplicationPolicy::PER_SOCKET || _policy == WeightsReplicationPolicy::REPLICATE;
+}
+
+SocketsWeights::SocketsWeights(WeightsReplicationPolicy policy) : _policy(policy) {
     int num_sockets = get_num_sockets();
+    WeightsSharing::Ptr shared;
+    if (!isPerSocket()) {
+        shared = std::make_shared<WeightsSharing>(policy, -1);
+    }
     for (int socket_id = 0; socket_id < num_sockets; socket_id++) {
-        _cache_map[socket_id] = std::make_shared<WeightsSharing>();
+        _cache_map[socket_id] = shared ? shared : std::make_shared<WeightsSharing>(policy, socket_id);
     }
 }
 
@@ -129,6 +165,12 @@ WeightsSharing::Statistics WeightsSharing::dumpStatistics() const {
 
 std::vector<std::pair<int, WeightsSharing::Statistics>> SocketsWeights::dumpStatistics() const {
     std::vector<std::pair<int, WeightsSharing::Statistics>> retVal;
+    if (!isPerSocket()) {
+        if (!_cache_map.empty() && _cache_map.begin()->second) {
+            retVal.emplace_back(-1, _cache_map.begin()->second->dumpStatistics());
+        }
+        return retVal;
+    }
     for (const auto& item : _cache_map) {
         if (item.second) {
             retVal.emplace_back(item.first, item.second->dumpStatistics());
@@ -16,6 +16,7 @@
 #include <vector>
 
 #include "cpu_memory.h"
+#include "internal_properties.hpp"
 
 // TODO: While CPU plugin has no ease way to clone graph object we use weight
 //       caching in global Engine context to avoid tensor memory duplication.
@@ -51,6 +52,13 @@ public:
 
     using Ptr = std::shared_ptr<WeightsSharing>;
 
+    WeightsSharing() = default;
+    /**
+     * @param policy defines the placement of the created memory objects on the NUMA nodes
+     * @param socketId the socket whose streams use the cache, -1 if the cache is shared between the sockets
+     */
+    WeightsSharing(WeightsReplicationPolicy policy, int socketId) : m_policy(policy), m_socketId(socketId) {}
+
     class SharedMemory {
     public:
         using Ptr = std::shared_ptr<SharedMemory>;
@@ -80,25 +88,43 @@ public:
 protected:
     mutable std::mutex guard;
     std::unordered_map<std::string, MemoryInfo::Ptr> sharedWeights;
+
+private:
+    void place(const MemoryPtr& memory) const;
+
+    // the default instance keeps the first touch placement
+    WeightsReplicationPolicy m_policy = WeightsReplicationPolicy::SINGLE_COPY;
+    int m_socketId = -1;
 };
 
 /**
  * Collection of memory caching store per socket
+ * Depending on the replication policy every socket has its own store or all the sockets share the same one
  *
  * Is a thread safe
  */
 class SocketsWeights {
 public:
-    SocketsWeights();
+    explicit SocketsWeights(WeightsReplicationPolicy policy = WeightsReplicationPolicy::PER_SOCKET);
 
     WeightsSharing::Ptr& operator[](int socket_id);
     const WeightsSharing::Ptr& operator[](int socket_id) const;
 
+    [[nodiscard]] WeightsReplicationPolicy getPolicy() const {
+        return _policy;
+    }
+
 #ifdef CPU_DEBUG_CAPS
+    /**
+     * Statistics per store, the store shared between all the sockets is reported with socket id -1
+     */
     [[nodiscard]] std::vector<std::pair<int, WeightsSharing::Statistics>> dumpStatistics() const;
 #endif  // CPU_DEBUG_CAPS
 
 private:
+    [[nodiscard]] bool isPerSocket() const;
+
+    WeightsReplicationPolicy _policy;
     std::map<int, WeightsSharing::Ptr> _cache_map;
 };
 
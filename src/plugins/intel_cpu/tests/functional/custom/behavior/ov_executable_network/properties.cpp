@@ -541,4 +541,29 @@ TEST_F(OVClassConfigTestCPU, smoke_CpuModelDistributionPolicyTensorParallel) {
     ASSERT_EQ(enable_tensor_parallel, true);
 }
 
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkRequestPriority) {
+    ov::Core core;
+    ov::CompiledModel compiledModel =
+        core.compile_model(model, deviceName, {ov::intel_cpu::request_priority(ov::hint::Priority::HIGH)});
+    ASSERT_EQ(compiledModel.get_property(ov::intel_cpu::request_priority), ov::hint::Priority::HIGH);
+
+    auto highRequest = compiledModel.create_infer_request();
+    // the priority is taken by the requests created afterwards
+    OV_ASSERT_NO_THROW(compiledModel.set_property({ov::intel_cpu::request_priority(ov::hint::Priority::LOW)}));
+    ASSERT_EQ(compiledModel.get_property(ov::intel_cpu::request_priority), ov::hint::Priority::LOW);
+    auto lowRequest = compiledModel.create_infer_request();
+    OV_ASSERT_NO_THROW(highRequest.infer());
+    OV_ASSERT_NO_THROW(lowRequest.start_async());
+    OV_ASSERT_NO_THROW(lowRequest.wait());
+
+    std::map<std::string, uint64_t> statistics;
+    OV_ASSERT_NO_THROW(statistics = compiledModel.get_property(ov::intel_cpu::cpu_task_queue_statistics));
+    // the executor may be reused from the models compiled before, so the statistics are accumulated
+    ASSERT_GE(statistics["LOW_TASKS"], 1);
+    ASSERT_GE(statistics["LOW_MAX_WAIT_US"], statistics["LOW_AVERAGE_WAIT_US"]);
+
+    ASSERT_THROW(compiledModel.set_property({{ov::intel_cpu::request_priority.name(), "UNKNOWN"}}), ov::Exception);
+    ASSERT_THROW(compiledModel.set_property({ov::num_streams(2)}), ov::Exception);
+}
+
 }  // namespace
@@ -203,6 +203,31 @@ const std::vector<SegmentMaxSpecificParams> SegmentMaxParamsVector = {
         12,
         ov::op::FillMode::LOWEST
     },
+    // Long segments reduced by multiple threads
+    SegmentMaxSpecificParams {
+        InputShape{{}, {{4096}}},
+        [] {
+            std::vector<int64_t> ids(4096);
+            for (size_t i = 0; i < ids.size(); i++) {
+                ids[i] = static_cast<int64_t>(i / 100) * 2;
+            }
+            return ids;
+        }(),
+        80,
+        ov::op::FillMode::ZERO
+    },
+    SegmentMaxSpecificParams {
+        InputShape{{-1, -1}, {{1024, 300}, {1024, 7}}},
+        [] {
+            std::vector<int64_t> ids(1024);
+            for (size_t i = 0; i < ids.size(); i++) {
+                ids[i] = static_cast<int64_t>(i / 33);
+            }
+            return ids;
+        }(),
+        40,
+        ov::op::FillMode::LOWEST
+    },
 };
 
 }  // namespace SegmentMax
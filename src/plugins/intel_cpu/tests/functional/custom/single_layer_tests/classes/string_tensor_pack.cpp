@@ -140,6 +140,15 @@ const std::vector<StringTensorPackSpecificParams> StringTensorPackParamsVector =
         InputShape{{-1, -1, -1}, {{1, 1, 3}, {1, 1, 4}, {1, 3, 4}, {1, 3, 4}}},     // begins/ends shape
         InputShape{{-1}, {{9}, {0}, {108}, {0}}},                                   // utf-8 encoded symbols shape
     },
+    // the strings are split between the threads
+    StringTensorPackSpecificParams{
+        InputShape{{}, {{16384}}},                                                  // begins/ends shape
+        InputShape{{}, {{3072}}},                                                   // utf-8 encoded symbols shape
+    },
+    StringTensorPackSpecificParams{
+        InputShape{{-1, -1}, {{64, 64}, {1, 1}, {8, 1000}}},                        // begins/ends shape
+        InputShape{{-1}, {{3072}, {9}, {3072}}},                                    // utf-8 encoded symbols shape
+    },
 };
 
 }  // namespace StringTensorPack
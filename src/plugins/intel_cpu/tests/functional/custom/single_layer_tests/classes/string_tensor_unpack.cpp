@@ -104,6 +104,13 @@ const std::vector<StringTensorUnpackSpecificParams> StringTensorUnpackParamsVect
     StringTensorUnpackSpecificParams {
         InputShape{{3, -1, {3, 8}}, {{3, 1, 3}, {3, 2, 8}}}
     },
+    // the strings are split between the threads
+    StringTensorUnpackSpecificParams {
+        InputShape{{}, {{16384}}}
+    },
+    StringTensorUnpackSpecificParams {
+        InputShape{{-1, -1}, {{64, 64}, {1, 1}, {8, 1000}, {64, 64}}}
+    },
 };
 
 }  // namespace StringTensorUnpack
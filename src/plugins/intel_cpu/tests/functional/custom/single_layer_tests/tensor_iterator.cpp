@@ -7,6 +7,7 @@
 #include "shared_test_classes/base/ov_subgraph.hpp"
 #include "openvino/op/add.hpp"
 #include "openvino/op/tensor_iterator.hpp"
+#include "openvino/runtime/core.hpp"
 
 using namespace ov;
 using namespace test;
@@ -57,7 +58,7 @@ protected:
 
         ov::ParameterVector body_params;
         for (size_t i = 0; i < shapes.size(); i++) {
-            ov::PartialShape shape = shapes[i].first;
+            ov::PartialShape shape = inputDynamicShapes[i];
             shape[sequence_axis] = 1;
             auto paramNode = std::make_shared<ov::op::v0::Parameter>(inType, shape);
             body_params.push_back(paramNode);
@@ -138,4 +139,49 @@ INSTANTIATE_TEST_SUITE_P(smoke_TensorIteratorSimple,
                                             ::testing::ValuesIn(inputPrecisions)),
                          TensorIteratorCPUTest::getTestCaseName);
 
+// the chunks of the first shapes are dense, so the body memory is rebound to them instead of copying
+std::vector<std::vector<InputShape>> staticInputs = {{{{}, {{1, 12, 10}}}, {{}, {{1, 12, 10}}}},
+                                                     {{{}, {{1, 7, 3, 4}}}, {{}, {{1, 7, 3, 4}}}},
+                                                     {{{}, {{3, 12, 10}}}, {{}, {{1, 12, 10}}}}};
+
+INSTANTIATE_TEST_SUITE_P(smoke_TensorIteratorStatic,
+                         TensorIteratorCPUTest,
+                         ::testing::Combine(::testing::ValuesIn(staticInputs),
+                                            ::testing::ValuesIn(direction),
+                                            ::testing::ValuesIn(inputPrecisions)),
+                         TensorIteratorCPUTest::getTestCaseName);
+
+TEST(TensorIteratorCPUPerfTest, PortMappingIsReported) {
+    const ov::Shape shape{1, 16, 8};
+    auto params = ov::ParameterVector{std::make_shared<ov::op::v0::Parameter>(ElementType::f32, shape),
+                                      std::make_shared<ov::op::v0::Parameter>(ElementType::f32, shape)};
+    const ov::Shape body_shape{1, 1, 8};
+    auto body_params = ov::ParameterVector{std::make_shared<ov::op::v0::Parameter>(ElementType::f32, body_shape),
+                                           std::make_shared<ov::op::v0::Parameter>(ElementType::f32, body_shape)};
+    auto add = std::make_shared<ov::op::v1::Add>(body_params[0], body_params[1]);
+    auto tensor_iterator = std::make_shared<ov::op::v0::TensorIterator>();
+    tensor_iterator->set_function(std::make_shared<ov::Model>(ov::OutputVector{add}, body_params, "body"));
+    tensor_iterator->set_sliced_input(body_params[0], params[0], 0, 1, 1, -1, 1);
+    tensor_iterator->set_sliced_input(body_params[1], params[1], 0, 1, 1, -1, 1);
+    tensor_iterator->get_concatenated_slices(add, 0, 1, 1, -1, 1);
+    tensor_iterator->set_friendly_name("tensor_iterator");
+    auto model = std::make_shared<ov::Model>(ov::OutputVector{tensor_iterator->output(0)}, params);
+
+    ov::Core core;
+    auto request = core.compile_model(model,
+                                      ov::test::utils::DEVICE_CPU,
+                                      ov::enable_profiling(true),
+                                      ov::hint::inference_precision(ElementType::f32))
+                       .create_infer_request();
+    request.infer();
+
+    const auto perf = request.get_profiling_info();
+    const auto mapping = std::find_if(perf.begin(), perf.end(), [](const ov::ProfilingInfo& info) {
+        return info.node_name == "tensor_iterator/port_mapping";
+    });
+    ASSERT_NE(mapping, perf.end());
+    EXPECT_EQ(mapping->status, ov::ProfilingInfo::Status::EXECUTED);
+    EXPECT_EQ(mapping->exec_type, "zero_copy");
+}
+
 }  // namespace
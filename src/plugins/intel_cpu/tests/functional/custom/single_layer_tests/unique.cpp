@@ -181,6 +181,22 @@ INSTANTIATE_TEST_SUITE_P(smoke_static_1D,
                                             ::testing::Values(additionalConfig[0])),
                          UniqueLayerTestCPU::getTestCaseName);
 
+// the flattened inputs long enough to be processed by multiple threads
+std::vector<std::vector<InputShape>> largeShapes1D = {
+    {{{}, {{65536}}}},                             // Static shapes
+    {{{-1}, {{100000}, {7}, {16384}, {100000}}}},  // Dynamic shape and target shapes
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_large_1D,
+                         UniqueLayerTestCPU,
+                         ::testing::Combine(::testing::ValuesIn(largeShapes1D),
+                                            ::testing::Values(std::tuple<bool, int>{true, 0}),
+                                            ::testing::ValuesIn(sorted),
+                                            ::testing::ValuesIn(dataPrecisionSmoke),
+                                            ::testing::ValuesIn(getCPUInfo()),
+                                            ::testing::Values(additionalConfig[0])),
+                         UniqueLayerTestCPU::getTestCaseName);
+
 std::vector<std::vector<InputShape>> getStaticShapes() {
     std::vector<std::vector<InputShape>> result = {
         {{{}, {{1, 1, 1}}}},     // Static shapes
@@ -0,0 +1,108 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/gather.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/multiply.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "utils/cpu_test_utils.hpp"
+
+/*This test runs the following subgraph:
+
+     x        indices ------------------------------
+     | \         |                |                 |
+     |  \     Gather(A)     Gather(alpha)       Gather(B)
+     |   \       |                |                 |
+     |    ---- MatMul --------- Multiply --------- MatMul
+     |                                              |
+   MatMul(W) ---------------------------------------Add
+                                                    |
+                                                  Result
+
+Every batch row uses the adapter selected by its index, the indices contain the repeated, the negative and the out
+of range values. The test checks that the subgraph is executed by the single GatheredLoRA node and the results match
+the reference implementation.
+*/
+
+namespace ov {
+namespace test {
+
+using GatheredLoraParams = std::vector<int32_t>;  // adapter indices of the batch rows
+
+class GatheredLoraCPUTest : public testing::WithParamInterface<GatheredLoraParams>,
+                            virtual public ov::test::SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<GatheredLoraParams>& obj) {
+        std::ostringstream result;
+        result << "indices=" << ov::test::utils::vec2str(obj.param);
+        return result.str();
+    }
+
+protected:
+    static constexpr size_t adapters = 3;
+    static constexpr size_t rank = 16;
+    static constexpr size_t K = 64;
+    static constexpr size_t N = 48;
+    static constexpr size_t seq = 5;
+
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        indices_values = GetParam();
+
+        const auto precision = ov::element::f32;
+        const size_t batch = indices_values.size();
+        init_input_shapes({InputShape{{-1, -1, K}, {{batch, seq, K}, {batch, 1, K}}},
+                           InputShape{{-1}, {{batch}, {batch}}}});
+        auto x = std::make_shared<ov::op::v0::Parameter>(precision, inputDynamicShapes[0]);
+        auto indices = std::make_shared<ov::op::v0::Parameter>(ov::element::i32, inputDynamicShapes[1]);
+
+        auto make_constant = [&](const ov::Shape& shape) {
+            auto tensor = ov::test::utils::create_and_fill_tensor_real_distribution(precision, shape, -0.5f, 0.5f, 1);
+            return std::make_shared<ov::op::v0::Constant>(tensor);
+        };
+        auto gather = [&](const ov::Output<ov::Node>& table) {
+            return std::make_shared<ov::op::v8::Gather>(table,
+                                                        indices,
+                                                        ov::op::v0::Constant::create(ov::element::i32, {}, {0}));
+        };
+
+        auto main_mm = std::make_shared<ov::op::v0::MatMul>(x, make_constant({N, K}), false, true);
+        auto mm_a = std::make_shared<ov::op::v0::MatMul>(x, gather(make_constant({adapters, rank, K})), false, true);
+        auto mul = std::make_shared<ov::op::v1::Multiply>(mm_a, gather(make_constant({adapters, 1, rank})));
+        auto mm_b = std::make_shared<ov::op::v0::MatMul>(mul, gather(make_constant({adapters, N, rank})), false, true);
+        auto add = std::make_shared<ov::op::v1::Add>(main_mm, mm_b);
+
+        function = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(add)},
+                                               ov::ParameterVector{x, indices},
+                                               "GatheredLora");
+    }
+
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        SubgraphBaseTest::generate_inputs(targetInputStaticShapes);
+        const auto& indices_input = inputs.find(function->get_parameters()[1]);
+        ASSERT_NE(indices_input, inputs.end());
+        std::copy(indices_values.begin(), indices_values.end(), indices_input->second.data<int32_t>());
+    }
+
+private:
+    std::vector<int32_t> indices_values;
+};
+
+TEST_P(GatheredLoraCPUTest, CompareWithRefs) {
+    run();
+    CPUTestUtils::CheckNumberOfNodesWithType(compiledModel, "GatheredLoRA", 1);
+    CPUTestUtils::CheckNumberOfNodesWithType(compiledModel, "Gather", 0);
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_GatheredLora,
+                         GatheredLoraCPUTest,
+                         ::testing::Values(GatheredLoraParams{0},
+                                           GatheredLoraParams{1, 1, 2, 2, 0, 0},
+                                           GatheredLoraParams{2, 0, -1, 1, 5, 2}),
+                         GatheredLoraCPUTest::getTestCaseName);
+
+}  // namespace test
+}  // namespace ov
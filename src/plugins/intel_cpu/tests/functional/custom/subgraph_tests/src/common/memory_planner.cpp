@@ -0,0 +1,92 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/node_builders/convolution.hpp"
+#include "common_test_utils/node_builders/eltwise.hpp"
+#include "internal_properties.hpp"
+#include "openvino/op/concat.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+
+/*This test runs the following subgraph:
+
+                 param
+               /   |   \
+            Conv  Conv  Add
+             |     |     |
+            Conv  Mul    |
+             |     |     |
+            Conv   |     |
+               \   |    /
+                Concat
+                  |
+                Result
+
+The main purpose of the test is to check that all the memory planners place the intermediate tensors of the
+branches with different sizes and live time in the common memory arena without overlapping.
+*/
+
+namespace ov {
+namespace test {
+
+using MemoryPlannerParams = ov::intel_cpu::MemoryPlanner;
+
+class MemoryPlannerCPUTest : public testing::WithParamInterface<MemoryPlannerParams>,
+                             virtual public ov::test::SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<MemoryPlannerParams>& obj) {
+        std::ostringstream result;
+        result << "planner=" << obj.param;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        configuration.insert({ov::intel_cpu::memory_planner.name(), GetParam()});
+
+        const auto precision = ov::element::f32;
+        init_input_shapes({InputShape{{}, {{1, 16, 14, 14}}}});
+        auto param = std::make_shared<ov::op::v0::Parameter>(precision, inputDynamicShapes.front());
+
+        auto makeConv = [&](const ov::Output<ov::Node>& input, size_t kernel, size_t channels) {
+            const auto pad = static_cast<ptrdiff_t>(kernel / 2);
+            return utils::make_convolution(input,
+                                           precision,
+                                           {kernel, kernel},
+                                           {1, 1},
+                                           {pad, pad},
+                                           {pad, pad},
+                                           {1, 1},
+                                           ov::op::PadType::EXPLICIT,
+                                           channels);
+        };
+
+        auto branch1 = makeConv(makeConv(makeConv(param, 1, 32), 3, 4), 3, 16);
+        auto branch2 = utils::make_eltwise(makeConv(param, 3, 8),
+                                           ov::op::v0::Constant::create(precision, {1}, {0.5f}),
+                                           utils::EltwiseTypes::MULTIPLY);
+        auto branch3 = utils::make_eltwise(param,
+                                           ov::op::v0::Constant::create(precision, {1}, {1.0f}),
+                                           utils::EltwiseTypes::ADD);
+
+        auto concat = std::make_shared<ov::op::v0::Concat>(ov::OutputVector{branch1, branch2, branch3}, 1);
+        function = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(concat)},
+                                               ov::ParameterVector{param},
+                                               "MemoryPlanner");
+    }
+};
+
+TEST_P(MemoryPlannerCPUTest, CompareWithRefs) {
+    run();
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_MemoryPlanner,
+                         MemoryPlannerCPUTest,
+                         ::testing::Values(ov::intel_cpu::MemoryPlanner::GREEDY,
+                                           ov::intel_cpu::MemoryPlanner::BEST_FIT,
+                                           ov::intel_cpu::MemoryPlanner::BEST_OF),
+                         MemoryPlannerCPUTest::getTestCaseName);
+
+}  // namespace test
+}  // namespace ov
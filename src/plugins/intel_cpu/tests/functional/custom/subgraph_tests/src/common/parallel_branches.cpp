@@ -0,0 +1,104 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/node_builders/convolution.hpp"
+#include "common_test_utils/node_builders/eltwise.hpp"
+#include "internal_properties.hpp"
+#include "openvino/op/concat.hpp"
+#include "openvino/op/max_pool.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+
+/*This test runs the following Inception-like subgraph:
+
+                         param
+                  _______/ | \________
+                 /     /   |   \      \
+              Conv  Conv  Conv  MaxPool Add
+               |     |     |     |      |
+              Conv  Mul   Conv  Conv    |
+               |     |     |     |      |
+                \     \    |    /      /
+                 \_____\   |   /______/
+                         Concat
+                           |
+                         Result
+
+The main purpose of the test is to check that the parallel execution of independent branches
+produces the same results as the sequential one, including the memory reuse between the branches.
+*/
+
+namespace ov {
+namespace test {
+
+using ParallelBranchesParams = std::tuple<int32_t,  // max number of concurrently executed branches
+                                          bool>;    // core partitioning
+
+class ParallelBranchesCPUTest : public testing::WithParamInterface<ParallelBranchesParams>,
+                                virtual public ov::test::SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<ParallelBranchesParams>& obj) {
+        const auto& [branches, partitioning] = obj.param;
+        std::ostringstream result;
+        result << "branches=" << branches << "_partitioning=" << partitioning;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        const auto& [branches, partitioning] = GetParam();
+        configuration.insert({ov::intel_cpu::parallel_branches.name(), branches});
+        configuration.insert({ov::intel_cpu::parallel_branches_core_partitioning.name(), partitioning});
+
+        const auto precision = ov::element::f32;
+        init_input_shapes({InputShape{{}, {{1, 16, 14, 14}}}});
+        auto param = std::make_shared<ov::op::v0::Parameter>(precision, inputDynamicShapes.front());
+
+        auto makeConv = [&](const ov::Output<ov::Node>& input, size_t kernel, size_t channels) {
+            const auto pad = static_cast<ptrdiff_t>(kernel / 2);
+            return utils::make_convolution(input,
+                                           precision,
+                                           {kernel, kernel},
+                                           {1, 1},
+                                           {pad, pad},
+                                           {pad, pad},
+                                           {1, 1},
+                                           ov::op::PadType::EXPLICIT,
+                                           channels);
+        };
+
+        auto branch1 = makeConv(makeConv(param, 1, 8), 3, 8);
+        auto branch2 = utils::make_eltwise(makeConv(param, 1, 8),
+                                           ov::op::v0::Constant::create(precision, {1}, {0.5f}),
+                                           utils::EltwiseTypes::MULTIPLY);
+        auto branch3 = makeConv(makeConv(param, 1, 4), 5, 8);
+        auto pool = std::make_shared<ov::op::v1::MaxPool>(param,
+                                                          ov::Strides{1, 1},
+                                                          ov::Shape{1, 1},
+                                                          ov::Shape{1, 1},
+                                                          ov::Shape{3, 3});
+        auto branch4 = makeConv(pool, 1, 8);
+        auto branch5 = utils::make_eltwise(param,
+                                           ov::op::v0::Constant::create(precision, {1}, {1.0f}),
+                                           utils::EltwiseTypes::ADD);
+
+        auto concat = std::make_shared<ov::op::v0::Concat>(ov::OutputVector{branch1, branch2, branch3, branch4, branch5},
+                                                           1);
+        function = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(concat)},
+                                               ov::ParameterVector{param},
+                                               "ParallelBranches");
+    }
+};
+
+TEST_P(ParallelBranchesCPUTest, CompareWithRefs) {
+    run();
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_ParallelBranches,
+                         ParallelBranchesCPUTest,
+                         ::testing::Combine(::testing::Values(0, 2, 4), ::testing::Values(false, true)),
+                         ParallelBranchesCPUTest::getTestCaseName);
+
+}  // namespace test
+}  // namespace ov
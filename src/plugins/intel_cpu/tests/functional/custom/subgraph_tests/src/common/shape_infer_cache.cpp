@@ -0,0 +1,120 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/node_builders/convolution.hpp"
+#include "common_test_utils/node_builders/eltwise.hpp"
+#include "internal_properties.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/depth_to_space.hpp"
+#include "openvino/op/max_pool.hpp"
+#include "openvino/op/non_zero.hpp"
+#include "openvino/op/reduce_sum.hpp"
+#include "openvino/op/transpose.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+
+/*This test runs the following subgraph with the alternating input shapes:
+
+                  param
+                 /     \
+              Conv    NonZero
+               |        |
+            MaxPool   Convert
+               |        |
+         DepthToSpace ReduceSum
+               |        |
+           Transpose   Mul
+               |        |
+              Add     Result
+               |
+             Result
+
+The main purpose of the test is to check that the shape inference results reused for the input shapes seen before
+are the same as the inferred ones, including the nodes producing the paddings (Conv, MaxPool) and the nodes
+downstream of the data dependent shapes (NonZero), which must not be reused for the same input shapes. The executors
+prepared by DepthToSpace and Transpose for the input shapes seen before are reused as well.
+*/
+
+namespace ov {
+namespace test {
+
+using ShapeInferCacheParams = int32_t;  // capacity of the shape inference cache
+
+class ShapeInferCacheCPUTest : public testing::WithParamInterface<ShapeInferCacheParams>,
+                               virtual public ov::test::SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<ShapeInferCacheParams>& obj) {
+        std::ostringstream result;
+        result << "capacity=" << obj.param;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        configuration.insert({ov::intel_cpu::cpu_shape_infer_cache_capacity.name(), GetParam()});
+
+        const auto precision = ov::element::f32;
+        // the repeated shapes are expected to take the shape inference results from the cache
+        const std::vector<ov::Shape> targetShapes{{1, 16, 14, 14},
+                                                  {2, 16, 10, 10},
+                                                  {1, 16, 14, 14},
+                                                  {2, 16, 10, 10},
+                                                  {1, 16, 14, 14}};
+        init_input_shapes({InputShape{{-1, 16, -1, -1}, targetShapes}});
+        auto param = std::make_shared<ov::op::v0::Parameter>(precision, inputDynamicShapes.front());
+
+        auto conv = utils::make_convolution(param,
+                                            precision,
+                                            {3, 3},
+                                            {1, 1},
+                                            {1, 1},
+                                            {1, 1},
+                                            {1, 1},
+                                            ov::op::PadType::EXPLICIT,
+                                            8);
+        auto pool = std::make_shared<ov::op::v1::MaxPool>(conv,
+                                                          ov::Strides{2, 2},
+                                                          ov::Shape{0, 0},
+                                                          ov::Shape{0, 0},
+                                                          ov::Shape{2, 2},
+                                                          ov::op::RoundingType::CEIL);
+        auto depthToSpace = std::make_shared<ov::op::v0::DepthToSpace>(
+            pool,
+            ov::op::v0::DepthToSpace::DepthToSpaceMode::BLOCKS_FIRST,
+            2);
+        auto transpose = std::make_shared<ov::op::v1::Transpose>(
+            depthToSpace,
+            ov::op::v0::Constant::create(ov::element::i32, {4}, {0, 2, 3, 1}));
+        auto add = utils::make_eltwise(transpose,
+                                       ov::op::v0::Constant::create(precision, {1}, {1.0f}),
+                                       utils::EltwiseTypes::ADD);
+
+        auto nonZero = std::make_shared<ov::op::v3::NonZero>(param, ov::element::i32);
+        auto convert = std::make_shared<ov::op::v0::Convert>(nonZero, precision);
+        auto reduce = std::make_shared<ov::op::v1::ReduceSum>(
+            convert,
+            ov::op::v0::Constant::create(ov::element::i32, {1}, {0}),
+            false);
+        auto mul = utils::make_eltwise(reduce,
+                                       ov::op::v0::Constant::create(precision, {1}, {0.5f}),
+                                       utils::EltwiseTypes::MULTIPLY);
+
+        function = std::make_shared<ov::Model>(
+            ov::ResultVector{std::make_shared<ov::op::v0::Result>(add), std::make_shared<ov::op::v0::Result>(mul)},
+            ov::ParameterVector{param},
+            "ShapeInferCache");
+    }
+};
+
+TEST_P(ShapeInferCacheCPUTest, CompareWithRefs) {
+    run();
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_ShapeInferCache,
+                         ShapeInferCacheCPUTest,
+                         ::testing::Values(0, 1, 16),
+                         ShapeInferCacheCPUTest::getTestCaseName);
+
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,231 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <vector>
+
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "openvino/op/broadcast.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/divide.hpp"
+#include "openvino/op/gelu.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/reduce_sum.hpp"
+#include "openvino/op/scatter_elements_update.hpp"
+#include "openvino/op/shape_of.hpp"
+#include "openvino/op/softmax.hpp"
+#include "openvino/op/subtract.hpp"
+#include "openvino/op/swish.hpp"
+#include "openvino/op/topk.hpp"
+#include "openvino/op/transpose.hpp"
+#include "openvino/op/unsqueeze.hpp"
+#include "openvino/runtime/exec_model_info.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+
+/*
+ * Dense form of the Mixture-of-Experts block: every expert is applied to every token and the results are weighted
+ * by the [experts, tokens, 1] routing matrix holding the normalized top-k router probabilities.
+ *
+ *        input ---------------------------+
+ *          |                              |
+ *   MatMul(router) -> Softmax -> TopK      |
+ *                          |      |        |
+ *                ScatterElementsUpdate   gate/up MatMul [experts, tokens, N]
+ *                          |               |
+ *                      Transpose         act * up -> down MatMul
+ *                          |               |
+ *                      Unsqueeze -----> Multiply -> ReduceSum(experts)
+ */
+
+namespace ov {
+namespace test {
+
+struct MoEFusionParams {
+    ov::test::InputShape inputShape;
+    size_t experts;
+    size_t topk;
+    size_t hidden_size;
+    size_t intermediate_size;
+    std::string act_type;
+    ov::element::Type weights_type;
+    bool per_oc_zero_point = false;
+};
+
+class MoEFusionTest : public testing::WithParamInterface<MoEFusionParams>, public ov::test::SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<MoEFusionParams>& obj) {
+        std::ostringstream result;
+        result << "IS=" << ov::test::utils::partialShape2str({obj.param.inputShape.first}) << "_";
+        result << "TS=";
+        for (const auto& shape : obj.param.inputShape.second) {
+            result << ov::test::utils::vec2str(shape);
+            result << "_";
+        }
+        result << "experts=" << obj.param.experts << "_";
+        result << "topk=" << obj.param.topk << "_";
+        result << "hidden_size=" << obj.param.hidden_size << "_";
+        result << "intermediate_size=" << obj.param.intermediate_size << "_";
+        result << "act_type=" << obj.param.act_type << "_";
+        result << "weights_type=" << obj.param.weights_type << "_";
+        result << "per_oc_zero_point=" << obj.param.per_oc_zero_point << "_";
+        result << obj.index;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+
+        auto& param = this->GetParam();
+
+        configuration[ov::hint::inference_precision.name()] = "bf16";
+
+        init_input_shapes({param.inputShape});
+
+        auto src = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, inputDynamicShapes[0]);
+
+        auto create_const = [&](const ov::Shape& shape, int resolution) -> std::shared_ptr<ov::Node> {
+            ov::test::utils::InputGenerateData in_data;
+            in_data.start_from = -0.5;
+            in_data.range = 1;
+            in_data.resolution = resolution;
+            auto tensor = ov::test::utils::create_and_fill_tensor(ov::element::f32, shape, in_data);
+            return std::make_shared<ov::op::v0::Constant>(tensor);
+        };
+
+        // stacked expert weights [experts, OC, IC], compressed per OC: (w - zp) * scale, the zero point is either
+        // a scalar or a per OC one
+        auto create_expert_weight = [&](size_t OC, size_t IC, int resolution) -> std::shared_ptr<ov::Node> {
+            if (param.weights_type == ov::element::f32) {
+                return create_const({param.experts, OC, IC}, resolution);
+            }
+            const bool is_signed = param.weights_type.is_signed();
+            ov::test::utils::InputGenerateData in_data;
+            in_data.start_from = is_signed ? -8 : 0;
+            in_data.range = 15;
+            auto tensor = ov::test::utils::create_and_fill_tensor(param.weights_type, {param.experts, OC, IC}, in_data);
+            auto weight = std::make_shared<ov::op::v0::Convert>(std::make_shared<ov::op::v0::Constant>(tensor),
+                                                                ov::element::f32);
+            std::shared_ptr<ov::Node> zero_point;
+            if (param.per_oc_zero_point) {
+                in_data.start_from = is_signed ? -2 : 6;
+                in_data.range = 4;
+                zero_point = std::make_shared<ov::op::v0::Constant>(
+                    ov::test::utils::create_and_fill_tensor(param.weights_type, {param.experts, OC, 1}, in_data));
+            } else {
+                zero_point = ov::op::v0::Constant::create(param.weights_type, {}, {is_signed ? 0 : 8});
+            }
+            auto shifted = std::make_shared<ov::op::v1::Subtract>(
+                weight,
+                std::make_shared<ov::op::v0::Convert>(zero_point, ov::element::f32));
+            in_data.start_from = 0.01;
+            in_data.range = 1;
+            in_data.resolution = 64;
+            auto scale = ov::test::utils::create_and_fill_tensor(ov::element::f32, {param.experts, OC, 1}, in_data);
+            return std::make_shared<ov::op::v1::Multiply>(shifted, std::make_shared<ov::op::v0::Constant>(scale));
+        };
+
+        // router: normalized top-k probabilities scattered into [tokens, experts]
+        auto router_weight = create_const({param.experts, param.hidden_size}, 100);
+        auto router_logits = std::make_shared<ov::op::v0::MatMul>(src, router_weight, false, true);
+        auto probs = std::make_shared<ov::op::v8::Softmax>(router_logits, -1);
+        auto topk_k = ov::op::v0::Constant::create(ov::element::i64, {}, {param.topk});
+        auto topk = std::make_shared<ov::op::v11::TopK>(probs,
+                                                        topk_k,
+                                                        -1,
+                                                        ov::op::TopKMode::MAX,
+                                                        ov::op::TopKSortType::SORT_VALUES,
+                                                        ov::element::i64);
+        auto last_axis = ov::op::v0::Constant::create(ov::element::i64, {1}, {-1});
+        auto topk_sum = std::make_shared<ov::op::v1::ReduceSum>(topk->output(0), last_axis, true);
+        auto routing_weights = std::make_shared<ov::op::v1::Divide>(topk->output(0), topk_sum);
+        auto zeros = std::make_shared<ov::op::v3::Broadcast>(ov::op::v0::Constant::create(ov::element::f32, {}, {0}),
+                                                             std::make_shared<ov::op::v3::ShapeOf>(router_logits));
+        auto routing = std::make_shared<ov::op::v12::ScatterElementsUpdate>(
+            zeros,
+            topk->output(1),
+            routing_weights,
+            ov::op::v0::Constant::create(ov::element::i64, {}, {1}));
+        auto transpose_order = ov::op::v0::Constant::create(ov::element::i64, {2}, {1, 0});
+        auto routing_t = std::make_shared<ov::op::v1::Transpose>(routing, transpose_order);
+        auto expert_scales =
+            std::make_shared<ov::op::v0::Unsqueeze>(routing_t, ov::op::v0::Constant::create(ov::element::i64, {}, {2}));
+
+        // experts applied to all the tokens: [experts, tokens, N]
+        auto gate_proj = std::make_shared<ov::op::v0::MatMul>(
+            src,
+            create_expert_weight(param.intermediate_size, param.hidden_size, 100),
+            false,
+            true);
+        auto up_proj = std::make_shared<ov::op::v0::MatMul>(
+            src,
+            create_expert_weight(param.intermediate_size, param.hidden_size, 100),
+            false,
+            true);
+
+        std::shared_ptr<Node> gate_act;
+        if (param.act_type == "Swish")
+            gate_act = std::make_shared<ov::op::v4::Swish>(gate_proj);
+        if (param.act_type == "Gelu")
+            gate_act = std::make_shared<ov::op::v7::Gelu>(gate_proj);
+
+        auto gate_up = std::make_shared<ov::op::v1::Multiply>(gate_act, up_proj);
+        auto down_proj = std::make_shared<ov::op::v0::MatMul>(
+            gate_up,
+            create_expert_weight(param.hidden_size, param.intermediate_size, 16),
+            false,
+            true);
+        auto weighted = std::make_shared<ov::op::v1::Multiply>(down_proj, expert_scales);
+        auto output = std::make_shared<ov::op::v1::ReduceSum>(weighted,
+                                                              ov::op::v0::Constant::create(ov::element::i64, {1}, {0}),
+                                                              false);
+
+        function = std::make_shared<ov::Model>(ov::OutputVector{output}, ov::ParameterVector{src});
+    }
+
+    void check_results() {
+        auto exec_model = compiledModel.get_runtime_model();
+
+        int fused_node_found = 0;
+        for (const auto& n : exec_model->get_ordered_ops()) {
+            auto layer_type = n->get_rt_info().at(ov::exec_model_info::LAYER_TYPE).as<std::string>();
+            if (layer_type == "MoE")
+                fused_node_found++;
+        }
+        ASSERT_EQ(fused_node_found, 1);
+    }
+};
+
+TEST_P(MoEFusionTest, CompareWithRefs) {
+    if (!ov::with_cpu_x86_avx512_core_amx_bf16())
+        GTEST_SKIP();
+    run();
+    check_results();
+}
+
+namespace {
+
+static ov::test::InputShape ishape{ov::PartialShape{-1, 256}, {ov::Shape{1, 256}, ov::Shape{45, 256}}};
+
+const std::vector<MoEFusionParams> moe_params = {
+    {ishape, 8, 2, 256, 320, "Swish", ov::element::f32},
+    {ishape, 8, 2, 256, 320, "Gelu", ov::element::f32},
+    {ishape, 8, 2, 256, 320, "Swish", ov::element::u8},
+    {ishape, 4, 2, 256, 320, "Swish", ov::element::u4},
+    {ishape, 8, 2, 256, 320, "Swish", ov::element::i8},
+    {ishape, 4, 2, 256, 320, "Swish", ov::element::i4},
+    {ishape, 8, 2, 256, 320, "Swish", ov::element::u8, true},
+    {ishape, 4, 2, 256, 320, "Gelu", ov::element::u4, true},
+    {ishape, 4, 2, 256, 320, "Swish", ov::element::i4, true},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_MoEFusion,
+                         MoEFusionTest,
+                         ::testing::ValuesIn(moe_params),
+                         MoEFusionTest::getTestCaseName);
+
+}  // namespace
+}  // namespace test
+}  // namespace ov
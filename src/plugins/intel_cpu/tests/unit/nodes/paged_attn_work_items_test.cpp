@@ -0,0 +1,67 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "nodes/kernels/scaled_attn/executor_pa_common.hpp"
+#include "utils/plain_tensor.hpp"
+
+using namespace ov::intel_cpu;
+using namespace ov::Extensions::Cpu;
+
+namespace {
+
+struct BlockTables {
+    std::vector<int32_t> past_lens;
+    std::vector<int32_t> subsequence_begins;
+    std::vector<int32_t> block_indices;
+    std::vector<int32_t> block_indices_begins;
+
+    WorkItems make_work_items(size_t block_size) {
+        PlainTensor query, past_lens_t, subsequence_begins_t, block_indices_t, block_indices_begins_t;
+        past_lens_t.resize<int32_t>({past_lens.size()}, past_lens.data());
+        subsequence_begins_t.resize<int32_t>({subsequence_begins.size()}, subsequence_begins.data());
+        block_indices_t.resize<int32_t>({block_indices.size()}, block_indices.data());
+        block_indices_begins_t.resize<int32_t>({block_indices_begins.size()}, block_indices_begins.data());
+        WorkItems items;
+        items.reset(query, past_lens_t, subsequence_begins_t, block_indices_t, block_indices_begins_t, block_size);
+        return items;
+    }
+};
+
+}  // namespace
+
+TEST(PagedAttnWorkItemsTest, NoSharedBlocks) {
+    BlockTables tables{{0, 0}, {0, 8, 16}, {0, 1, 2, 3}, {0, 2, 4}};
+    auto items = tables.make_work_items(4);
+    ASSERT_EQ(items.reorder_work_size(), 4);
+    ASSERT_EQ(items.shared_reorder_work_size(), 0);
+    for (size_t i = 0; i < items.reorder_work_size(); i++) {
+        ASSERT_EQ(items.get_reorder_work_item(i).src_reorder_item, -1);
+    }
+}
+
+TEST(PagedAttnWorkItemsTest, SharedPrefixBlocks) {
+    // both sequences have 8 cached prefix tokens in blocks 0, 1 and own blocks for the rest of prompt
+    BlockTables tables{{8, 8}, {0, 4, 6}, {0, 1, 2, 0, 1, 3}, {0, 3, 6}};
+    auto items = tables.make_work_items(4);
+    ASSERT_EQ(items.reorder_work_size(), 6);
+    ASSERT_EQ(items.shared_reorder_work_size(), 2);
+
+    const std::vector<int32_t> expected_src = {-1, -1, -1, 0, 1, -1};
+    for (size_t i = 0; i < items.reorder_work_size(); i++) {
+        ASSERT_EQ(items.get_reorder_work_item(i).src_reorder_item, expected_src[i]) << "reorder item " << i;
+    }
+}
+
+TEST(PagedAttnWorkItemsTest, PartiallyFilledSharedBlock) {
+    // block 0 is shared, but the second sequence sees more tokens in it, so it must be packed separately
+    BlockTables tables{{0, 0}, {0, 2, 5}, {0, 0}, {0, 1, 2}};
+    auto items = tables.make_work_items(4);
+    ASSERT_EQ(items.reorder_work_size(), 2);
+    ASSERT_EQ(items.shared_reorder_work_size(), 0);
+}
@@ -7,6 +7,7 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
+#include "cache/concurrent_lru_cache.h"
 #include "cache/lru_cache.h"
 #include "cache/multi_cache.h"
 #include "common_test_utils/test_assertions.hpp"
@@ -97,6 +98,84 @@ TEST(LruCacheTests, Empty) {
         ASSERT_EQ(cache.get({i}), int());
     }
 }
+TEST(ConcurrentLruCacheTests, Evict) {
+    constexpr size_t capacity = 10;
+    ConcurrentLruCache<IntKey, int> cache(capacity);
+    for (int i = 0; i < static_cast<int>(capacity); ++i) {
+        OV_ASSERT_NO_THROW(cache.put({i}, i));
+    }
+    OV_ASSERT_NO_THROW(cache.evict(5));
+    ASSERT_EQ(cache.size(), capacity - 5);
+    ASSERT_EQ(cache.getEvictedCount(), 5);
+    OV_ASSERT_NO_THROW(cache.evict(10));
+    ASSERT_EQ(cache.size(), 0);
+    ASSERT_EQ(cache.get({9}), int());
+    OV_ASSERT_NO_THROW(cache.evict(0));
+}
+
+TEST(ConcurrentLruCacheTests, Put) {
+    constexpr size_t capacity = 10;
+    ConcurrentLruCache<IntKey, int> cache(capacity);
+    for (size_t i = 0; i < 2 * capacity; ++i) {
+        OV_ASSERT_NO_THROW(cache.put({10}, static_cast<int>(i)));
+    }
+
+    ASSERT_EQ(cache.get({10}), static_cast<int>(2 * capacity - 1));
+    ASSERT_EQ(cache.size(), 1);
+}
+
+TEST(ConcurrentLruCacheTests, LruPolicy) {
+    constexpr int capacity = 10;
+    ConcurrentLruCache<IntKey, int> cache(capacity);
+    for (int i = 1; i < capacity; ++i) {
+        OV_ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 4; i < capacity; ++i) {
+        ASSERT_EQ(cache.get({i}), i);
+    }
+
+    for (int i = 21; i < 25; ++i) {
+        OV_ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 1; i < 4; ++i) {
+        ASSERT_EQ(cache.get({i}), int());
+    }
+
+    for (int i = 4; i < capacity; ++i) {
+        ASSERT_EQ(cache.get({i}), i);
+    }
+    ASSERT_EQ(cache.getEvictedCount(), 3);
+}
+
+TEST(ConcurrentLruCacheTests, Empty) {
+    constexpr size_t capacity = 0;
+    constexpr int attempts = 10;
+    ConcurrentLruCache<IntKey, int> cache(capacity);
+    for (int i = 1; i < attempts; ++i) {
+        OV_ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 1; i < attempts; ++i) {
+        ASSERT_EQ(cache.get({i}), int());
+    }
+}
+
+TEST(ConcurrentLruCacheTests, Sharded) {
+    constexpr int capacity = 5000;
+    ConcurrentLruCache<IntKey, int> cache(capacity);
+    for (int i = 0; i < 10 * capacity; ++i) {
+        OV_ASSERT_NO_THROW(cache.put({i}, i + 1));
+    }
+    ASSERT_LE(cache.size(), static_cast<size_t>(capacity));
+    ASSERT_EQ(cache.getEvictedCount(), 10 * capacity - cache.size());
+    // the most recent records are kept
+    for (int i = 10 * capacity - capacity / 2; i < 10 * capacity; ++i) {
+        ASSERT_EQ(cache.get({i}), i + 1);
+    }
+}
+
 namespace {
 template<typename T, typename K>
 class mockBuilder {
@@ -380,3 +459,55 @@ TEST(MultiCacheTests, SmokeTypeIdSync) {
         vecThreads.emplace_back(std::thread(testRoutine, std::ref(vecCache[i])));
     }
 }
+
+TEST(MultiCacheTests, Statistics) {
+    constexpr int capacity = 10;
+    auto builder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+
+    MultiCache cache(capacity);
+    for (int i = 0; i < 2 * capacity; ++i) {
+        cache.getOrCreate(IntKey{i}, builder);
+    }
+    for (int i = capacity; i < 2 * capacity; ++i) {
+        auto result = cache.getOrCreate(IntKey{i}, builder);
+        ASSERT_EQ(result.second, CacheEntryBase::LookUpStatus::Hit);
+    }
+
+    const auto statistics = cache.getStatistics();
+    ASSERT_EQ(statistics.hits, capacity);
+    ASSERT_EQ(statistics.misses, 2 * capacity);
+    ASSERT_EQ(statistics.evictions, capacity);
+}
+
+TEST(MultiCacheTests, SmokeSharedCacheSync) {
+    using IntValueType = std::shared_ptr<int>;
+
+    constexpr int capacity = 100;
+    constexpr size_t numThreads = 16;
+    constexpr int iterations = 100;
+
+    auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+
+    MultiCache cache(capacity);
+
+    auto testRoutine = [&]() {
+        for (int j = 0; j < iterations; ++j) {
+            for (int i = 0; i < 2 * capacity; ++i) {
+                auto intResult = cache.getOrCreate(IntKey{i}, intBuilder);
+                ASSERT_NE(intResult.first, IntValueType());
+                ASSERT_EQ(*intResult.first, i);
+            }
+        }
+    };
+
+    {
+        std::vector<ScopedThread> vecThreads;
+        vecThreads.reserve(numThreads);
+        for (size_t i = 0; i < numThreads; ++i) {
+            vecThreads.emplace_back(std::thread(testRoutine));
+        }
+    }
+
+    const auto statistics = cache.getStatistics();
+    ASSERT_EQ(statistics.hits + statistics.misses, numThreads * iterations * 2 * capacity);
+}
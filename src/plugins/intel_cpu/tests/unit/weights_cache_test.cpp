@@ -0,0 +1,80 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+#include "openvino/runtime/system_conf.hpp"
+#include "weights_cache.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+MemoryPtr findOrCreate(const WeightsSharing::Ptr& cache, const std::string& key, int& created) {
+    static const dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    return *cache->findOrCreate(key, [&]() -> MemoryPtr {
+        created++;
+        auto desc = std::make_shared<CpuBlockedMemoryDesc>(ov::element::f32, Shape{1024, 16});
+        return std::make_shared<Memory>(eng, desc);
+    });
+}
+}  // namespace
+
+TEST(WeightsCacheTest, CopyPerSocket) {
+    const int sockets = ov::get_num_sockets();
+    if (sockets < 1) {
+        GTEST_SKIP();
+    }
+    // the default policy keeps a copy per socket without the explicit NUMA binding
+    EXPECT_EQ(SocketsWeights().getPolicy(), WeightsReplicationPolicy::PER_SOCKET);
+    for (auto policy : {WeightsReplicationPolicy::PER_SOCKET, WeightsReplicationPolicy::REPLICATE}) {
+        SocketsWeights weights(policy);
+        int created = 0;
+        std::vector<MemoryPtr> memories;
+        for (int socket = 0; socket < sockets; socket++) {
+            memories.push_back(findOrCreate(weights[socket], "weights", created));
+            // the second lookup on the same socket takes the cached object
+            EXPECT_EQ(findOrCreate(weights[socket], "weights", created), memories.back());
+        }
+        EXPECT_EQ(created, sockets);
+    }
+}
+
+TEST(WeightsCacheTest, SharedBetweenSockets) {
+    const int sockets = ov::get_num_sockets();
+    if (sockets < 1) {
+        GTEST_SKIP();
+    }
+    for (auto policy : {WeightsReplicationPolicy::INTERLEAVE, WeightsReplicationPolicy::SINGLE_COPY}) {
+        SocketsWeights weights(policy);
+        int created = 0;
+        const auto memory = findOrCreate(weights[0], "weights", created);
+        for (int socket = 0; socket < sockets; socket++) {
+            EXPECT_EQ(weights[socket], weights[0]);
+            EXPECT_EQ(findOrCreate(weights[socket], "weights", created), memory);
+        }
+        EXPECT_EQ(created, 1);
+    }
+}
+
+TEST(WeightsCacheTest, PolicyConversion) {
+    for (auto policy : {WeightsReplicationPolicy::PER_SOCKET,
+                        WeightsReplicationPolicy::REPLICATE,
+                        WeightsReplicationPolicy::INTERLEAVE,
+                        WeightsReplicationPolicy::SINGLE_COPY}) {
+        std::stringstream ss;
+        ss << policy;
+        WeightsReplicationPolicy parsed = WeightsReplicationPolicy::REPLICATE;
+        ss >> parsed;
+        EXPECT_EQ(parsed, policy);
+    }
+    std::stringstream ss("UNKNOWN");
+    WeightsReplicationPolicy parsed = WeightsReplicationPolicy::REPLICATE;
+    EXPECT_THROW(ss >> parsed, ov::Exception);
+}
@@ -68,6 +68,14 @@ public:
     /// \param func The function to compile
     /// \returns compiled function or nullptr on failure
     virtual std::shared_ptr<Executable> compile(std::shared_ptr<ov::Model> model) = 0;
+
+    /// \brief Compiles a Function.
+    /// \param func The function to compile
+    /// \param parallel_execution Allows to evaluate the independent operations of the function concurrently
+    /// \returns compiled function or nullptr on failure
+    virtual std::shared_ptr<Executable> compile(std::shared_ptr<ov::Model> model, bool /*parallel_execution*/) {
+        return compile(std::move(model));
+    }
 };
 
 }  // namespace runtime
@@ -29,3 +29,8 @@ std::shared_ptr<ov::runtime::Executable> ov::runtime::interpreter::INTBackend::c
     std::shared_ptr<ov::Model> model) {
     return std::make_shared<INTExecutable>(model);
 }
+
+std::shared_ptr<ov::runtime::Executable> ov::runtime::interpreter::INTBackend::compile(std::shared_ptr<ov::Model> model,
+                                                                                      bool parallel_execution) {
+    return std::make_shared<INTExecutable>(model, parallel_execution);
+}
@@ -33,6 +33,8 @@ public:
 
     std::shared_ptr<Executable> compile(std::shared_ptr<ov::Model> model) override;
 
+    std::shared_ptr<Executable> compile(std::shared_ptr<ov::Model> model, bool parallel_execution) override;
+
 private:
     std::set<std::string> m_unsupported_op_name_list;
 };
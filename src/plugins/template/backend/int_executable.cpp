@@ -4,11 +4,16 @@
 
 #include "int_executable.hpp"
 
+#include <algorithm>
 #include <cstring>
+#include <exception>
 #include <limits>
+#include <mutex>
+#include <unordered_map>
 
 #include "evaluates_map.hpp"
 #include "openvino/core/except.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/shape_util.hpp"
 #include "openvino/op/parameter.hpp"
 #include "openvino/op/result.hpp"
@@ -19,35 +24,93 @@
 
 class TemporaryOverrideOutputs {
     std::shared_ptr<ov::Model> model;
-    std::unordered_map<std::shared_ptr<ov::descriptor::Tensor>, ov::PartialShape> orig_paramter_shapes_map;
+    std::vector<ov::PartialShape> orig_parameter_shapes;
 
 public:
     TemporaryOverrideOutputs(std::shared_ptr<ov::Model>& model) : model(model) {}
 
-    void overide_outputs(const std::unordered_map<std::shared_ptr<ov::descriptor::Tensor>, ov::Tensor>& tensor_map) {
-        for (const auto& param : model->get_parameters()) {
-            auto output_tensor = param->output(0).get_tensor_ptr();
-            orig_paramter_shapes_map.insert({output_tensor, param->get_partial_shape()});
-            param->set_partial_shape(tensor_map.at(output_tensor).get_shape());
+    void overide_outputs(const std::vector<ov::Tensor>& inputs) {
+        const auto& parameters = model->get_parameters();
+        for (size_t i = 0; i < parameters.size(); ++i) {
+            orig_parameter_shapes.push_back(parameters[i]->get_partial_shape());
+            parameters[i]->set_partial_shape(inputs.at(i).get_shape());
         }
         model->validate_nodes_and_infer_types();
     }
 
     void restore_outputs() {
-        for (const auto& param : model->get_parameters()) {
-            auto output_tensor = param->output(0).get_tensor_ptr();
-            param->set_partial_shape(orig_paramter_shapes_map.at(output_tensor));
+        const auto& parameters = model->get_parameters();
+        for (size_t i = 0; i < parameters.size(); ++i) {
+            parameters[i]->set_partial_shape(orig_parameter_shapes.at(i));
         }
         model->validate_nodes_and_infer_types();
     }
 };
 
-ov::runtime::interpreter::INTExecutable::INTExecutable(const std::shared_ptr<ov::Model>& model) : m_is_compiled{true} {
+namespace {
+bool has_variables(const ov::NodeVector& nodes) {
+    return std::any_of(nodes.begin(), nodes.end(), [](const std::shared_ptr<ov::Node>& op) {
+        if (auto multi_subgraph_op = ov::as_type_ptr<ov::op::util::MultiSubGraphOp>(op)) {
+            for (const auto& sub_graph : multi_subgraph_op->get_functions()) {
+                if (has_variables(sub_graph->get_ordered_ops())) {
+                    return true;
+                }
+            }
+        }
+        return std::dynamic_pointer_cast<ov::op::util::VariableExtension>(op) != nullptr;
+    });
+}
+}  // namespace
+
+ov::runtime::interpreter::INTExecutable::INTExecutable(const std::shared_ptr<ov::Model>& model, bool parallel_execution)
+    : m_is_compiled{true} {
     m_model = model->clone();
     for (auto node : m_model->get_ordered_ops()) {
         m_nodes.push_back(node);
     }
     set_parameters_and_results(*m_model);
+
+    std::unordered_map<const ov::descriptor::Tensor*, size_t> slots;
+    std::unordered_map<const ov::Node*, size_t> levels;
+    m_input_slots.resize(m_nodes.size());
+    m_output_slots.resize(m_nodes.size());
+    m_result_index.resize(m_nodes.size(), -1);
+    for (size_t idx = 0; idx < m_nodes.size(); ++idx) {
+        const auto& node = m_nodes[idx];
+        size_t level = 0;
+        for (const auto& input : node->inputs()) {
+            m_input_slots[idx].push_back(slots.at(&input.get_tensor()));
+            level = std::max(level, levels.at(input.get_source_output().get_node()) + 1);
+        }
+        for (const auto& dependency : node->get_control_dependencies()) {
+            level = std::max(level, levels.at(dependency.get()) + 1);
+        }
+        for (const auto& output : node->outputs()) {
+            m_output_slots[idx].push_back(m_tensors_count);
+            slots.emplace(&output.get_tensor(), m_tensors_count++);
+        }
+        levels.emplace(node.get(), level);
+        if (ov::as_type_ptr<ov::op::v0::Parameter>(node)) {
+            continue;
+        }
+        if (m_levels.size() <= level) {
+            m_levels.resize(level + 1);
+        }
+        m_levels[level].push_back(idx);
+    }
+
+    for (const auto& param : get_parameters()) {
+        m_parameter_slots.push_back(slots.at(&param->get_output_tensor(0)));
+    }
+    const auto& results = get_results();
+    for (size_t idx = 0; idx < m_nodes.size(); ++idx) {
+        const auto it = std::find(results.begin(), results.end(), m_nodes[idx]);
+        if (it != results.end()) {
+            m_result_index[idx] = std::distance(results.begin(), it);
+        }
+    }
+    // the variables are shared by the nodes through the evaluation context, so the stateful models run sequentially
+    m_parallel_execution = parallel_execution && !has_variables(m_nodes);
 }
 
 void ov::runtime::interpreter::INTExecutable::cancel() {
@@ -96,79 +159,98 @@ bool ov::runtime::interpreter::INTExecutable::call(std::vector<ov::Tensor>& outp
 
     CHECK_TERMINATE()
     // map function params -> ov::Tensor
-    std::unordered_map<std::shared_ptr<ov::descriptor::Tensor>, ov::Tensor> tensor_map;
-    size_t input_count = 0;
-    for (const auto& param : get_parameters()) {
-        for (size_t i = 0; i < param->get_output_size(); ++i) {
-            auto tensor = param->output(i).get_tensor_ptr();
-            tensor_map.insert({tensor, inputs[input_count++]});
-        }
-    }
-
-    std::unordered_map<std::shared_ptr<ov::descriptor::Tensor>, size_t> results_map;
-    // map function outputs -> ov::Tensor
-    for (size_t output_count = 0; output_count < get_results().size(); ++output_count) {
-        auto output = get_results()[output_count]->output(0).get_tensor_ptr();
-        if (!results_map.count(output))
-            results_map.emplace(output, output_count);
+    std::vector<ov::Tensor> tensors(m_tensors_count);
+    for (size_t i = 0; i < m_parameter_slots.size(); ++i) {
+        tensors[m_parameter_slots[i]] = inputs[i];
     }
 
     auto overrider = TemporaryOverrideOutputs(m_model);
-    overrider.overide_outputs(tensor_map);
+    overrider.overide_outputs(inputs);
 
-    // for each ordered op in the graph
-    for (const auto& op : m_nodes) {
-        CHECK_TERMINATE()
-        if (ov::as_type_ptr<ov::op::v0::Parameter>(op)) {
-            continue;
-        }
-        // get op inputs from map
-        std::vector<ov::Tensor> op_inputs;
-        for (auto input : op->inputs()) {
-            auto tensor = input.get_tensor_ptr();
-            op_inputs.push_back(tensor_map.at(tensor));
-        }
-
-        // get op outputs from map or create
-        std::vector<ov::Tensor> op_outputs;
-        for (size_t i = 0; i < op->get_output_size(); ++i) {
-            auto tensor = op->output(i).get_tensor_ptr();
-            auto it = tensor_map.find(tensor);
-            auto output = op->output(i);
-            if (op::util::is_output(op) || it == tensor_map.end() || !it->second) {
-                op_outputs.emplace_back(output);
-            } else {
-                op_outputs.push_back(it->second);
+    if (!m_parallel_execution) {
+        // for each ordered op in the graph
+        for (size_t idx = 0; idx < m_nodes.size(); ++idx) {
+            CHECK_TERMINATE()
+            if (ov::as_type_ptr<ov::op::v0::Parameter>(m_nodes[idx])) {
+                continue;
             }
+            evaluate_op(idx, tensors, outputs, context, collect_performance);
         }
-
-        {
-            PERF(op, collect_performance);
-            // Call evaluate for cloned_node with static shapes
-            if (!op->evaluate(op_outputs, op_inputs, context)) {
-                // TODO: extend evaluate map for the context
-                evaluate_node(op, op_outputs, op_inputs);
+    } else {
+        for (const auto& level : m_levels) {
+            CHECK_TERMINATE()
+            if (level.size() == 1) {
+                evaluate_op(level.front(), tensors, outputs, context, collect_performance);
+                continue;
             }
-        }
-        // Update tensors in tensor map
-        for (size_t i = 0; i < op->get_output_size(); ++i) {
-            auto tensor = op->output(i).get_tensor_ptr();
-            tensor_map.insert({tensor, op_outputs[i]});
-            if (op::util::is_output(op)) {
-                auto& output = outputs[results_map[tensor]];
-                if (!output || output.get_shape() != op_outputs[i].get_shape()) {
-                    outputs[results_map[tensor]] = op_outputs[i];
-                } else {
-                    op_outputs[i].copy_to(output);
+            std::exception_ptr error;
+            std::mutex error_mutex;
+            ov::parallel_for(level.size(), [&](size_t i) {
+                if (m_cancel_execution) {
+                    return;
                 }
+                try {
+                    evaluate_op(level[i], tensors, outputs, context, collect_performance);
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(error_mutex);
+                    if (!error) {
+                        error = std::current_exception();
+                    }
+                }
+            });
+            if (error) {
+                std::rethrow_exception(error);
             }
         }
+        CHECK_TERMINATE()
     }
 
     overrider.restore_outputs();
     return true;
 }
 
+void ov::runtime::interpreter::INTExecutable::evaluate_op(size_t index,
+                                                          std::vector<ov::Tensor>& tensors,
+                                                          std::vector<ov::Tensor>& outputs,
+                                                          const ov::EvaluationContext& context,
+                                                          bool collect_performance) const {
+    const auto& op = m_nodes[index];
+    // get op inputs from slots
+    std::vector<ov::Tensor> op_inputs;
+    op_inputs.reserve(m_input_slots[index].size());
+    for (const auto slot : m_input_slots[index]) {
+        op_inputs.push_back(tensors[slot]);
+    }
+
+    // create op outputs
+    std::vector<ov::Tensor> op_outputs;
+    op_outputs.reserve(op->get_output_size());
+    for (size_t i = 0; i < op->get_output_size(); ++i) {
+        op_outputs.emplace_back(op->output(i));
+    }
+
+    {
+        PERF(op, collect_performance);
+        // Call evaluate for cloned_node with static shapes
+        if (!op->evaluate(op_outputs, op_inputs, context)) {
+            // TODO: extend evaluate map for the context
+            evaluate_node(op, op_outputs, op_inputs);
+        }
+    }
+    // Update tensors in slots
+    for (size_t i = 0; i < op_outputs.size(); ++i) {
+        tensors[m_output_slots[index][i]] = op_outputs[i];
+    }
+    if (m_result_index[index] >= 0) {
+        auto& output = outputs[m_result_index[index]];
+        if (!output || output.get_shape() != op_outputs[0].get_shape()) {
+            output = op_outputs[0];
+        } else {
+            op_outputs[0].copy_to(output);
+        }
+    }
+}
+
 std::shared_ptr<ov::op::v0::Parameter> ov::runtime::interpreter::INTExecutable::get_parameter(size_t index) const {
     const ParameterVector& parameters = get_parameters();
     OPENVINO_ASSERT(index < parameters.size(), "create_tensor for input out of bounds");
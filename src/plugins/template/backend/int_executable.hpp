@@ -26,7 +26,7 @@ class INTExecutable : public Executable {
     friend class INTBackend;
 
 public:
-    INTExecutable(const std::shared_ptr<ov::Model>& model);
+    INTExecutable(const std::shared_ptr<ov::Model>& model, bool parallel_execution = false);
 
     void cancel() override;
 
@@ -54,9 +54,24 @@ protected:
     bool evaluate_node(const std::shared_ptr<Node>& node,
                        ov::TensorVector& outputs,
                        const ov::TensorVector& inputs) const;
+    void evaluate_op(size_t index,
+                     std::vector<ov::Tensor>& tensors,
+                     std::vector<ov::Tensor>& outputs,
+                     const ov::EvaluationContext& context,
+                     bool collect_performance) const;
     bool m_is_compiled = false;
     std::shared_ptr<ov::Model> m_model;
     std::vector<std::shared_ptr<Node>> m_nodes;
+    // Output tensors of the nodes are resolved to the slots once, so the execution does not look them up
+    size_t m_tensors_count = 0;
+    std::vector<std::vector<size_t>> m_input_slots;
+    std::vector<std::vector<size_t>> m_output_slots;
+    std::vector<size_t> m_parameter_slots;
+    // Index of the model output per node, or -1 if the node is not Result
+    std::vector<int64_t> m_result_index;
+    // Indices of the nodes which depend only on the nodes of the previous levels, so they may be evaluated concurrently
+    std::vector<std::vector<size_t>> m_levels;
+    bool m_parallel_execution = false;
     std::atomic_bool m_cancel_execution{false};
     std::mutex m_mutex;
 
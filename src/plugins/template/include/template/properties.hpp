@@ -25,6 +25,11 @@ namespace template_plugin {
  */
 static constexpr Property<bool, PropertyMutability::RW> disable_transformations{"DISABLE_TRANSFORMATIONS"};
 
+/**
+ * @brief Allows to evaluate the independent operations of the model concurrently inside the TEMPLATE plugin.
+ */
+static constexpr Property<bool, PropertyMutability::RW> parallel_execution{"PARALLEL_EXECUTION"};
+
 // ! [properties:public_header]
 
 }  // namespace template_plugin
@@ -17,6 +17,8 @@ Configuration::Configuration(const ov::AnyMap& config, const Configuration& defa
     for (auto&& [key, value] : config) {
         if (ov::template_plugin::disable_transformations == key) {
             disable_transformations = value.as<bool>();
+        } else if (ov::template_plugin::parallel_execution == key) {
+            parallel_execution = value.as<bool>();
         } else if (ov::internal::exclusive_async_requests == key) {
             exclusive_async_requests = value.as<bool>();
         } else if (ov::num_streams.name() == key) {
@@ -141,6 +143,8 @@ ov::Any Configuration::Get(const std::string& name) const {
         return {exclusive_async_requests};
     } else if (name == ov::template_plugin::disable_transformations) {
         return {disable_transformations};
+    } else if (name == ov::template_plugin::parallel_execution) {
+        return {parallel_execution};
     } else if (name == ov::num_streams) {
         return {std::to_string(streams)};
     } else if (name == ov::inference_num_threads) {
@@ -40,6 +40,7 @@ struct Configuration {
     ov::hint::PerformanceMode performance_mode = ov::hint::PerformanceMode::LATENCY;
     uint32_t num_requests = 1;
     bool disable_transformations = false;
+    bool parallel_execution = false;
     bool exclusive_async_requests = false;
 
     // unused
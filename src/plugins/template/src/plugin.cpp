@@ -365,6 +365,7 @@ ov::Any ov::template_plugin::Plugin::get_property(const std::string& name, const
             ov::hint::execution_mode,
             ov::num_streams,
             ov::template_plugin::disable_transformations,
+            ov::template_plugin::parallel_execution,
             ov::log::level,
             ov::hint::model_priority,
             ov::hint::enable_hyper_threading,
@@ -85,7 +85,9 @@ ov::template_plugin::InferRequest::InferRequest(const std::shared_ptr<const ov::
                               "_WaitPipline"),
     };
     m_durations = {};
-    m_executable = get_template_model()->get_template_plugin()->m_backend->compile(get_template_model()->m_model);
+    m_executable = get_template_model()->get_template_plugin()->m_backend->compile(
+        get_template_model()->m_model,
+        get_template_model()->m_cfg.parallel_execution);
 
     // Allocate plugin backend specific memory handles
     m_backend_input_tensors.resize(get_inputs().size());
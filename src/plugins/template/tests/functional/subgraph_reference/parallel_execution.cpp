@@ -0,0 +1,93 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+#include "common_test_utils/ov_plugin_cache.hpp"
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/concat.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convolution.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/reduce_sum.hpp"
+#include "openvino/op/reshape.hpp"
+#include "openvino/op/result.hpp"
+#include "template/properties.hpp"
+
+namespace {
+
+/*
+             param
+          /    |    \
+       Conv   Conv   MatMul
+        |      |       |
+       Add  Multiply  ReduceSum
+          \    |
+          Concat
+*/
+std::shared_ptr<ov::Model> make_branches_model() {
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{2, 16, 24, 24});
+    auto make_conv = [&](float value) {
+        auto weights = ov::op::v0::Constant::create(ov::element::f32,
+                                                    ov::Shape{32, 16, 3, 3},
+                                                    std::vector<float>(32 * 16 * 3 * 3, value));
+        return std::make_shared<ov::op::v1::Convolution>(param,
+                                                         weights,
+                                                         ov::Strides{1, 1},
+                                                         ov::CoordinateDiff{1, 1},
+                                                         ov::CoordinateDiff{1, 1},
+                                                         ov::Strides{1, 1});
+    };
+    auto bias = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{1, 32, 1, 1}, std::vector<float>(32, 0.5f));
+    auto add = std::make_shared<ov::op::v1::Add>(make_conv(0.01f), bias);
+    auto scale = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{1, 1, 1, 24}, std::vector<float>(24, 2.f));
+    auto mul = std::make_shared<ov::op::v1::Multiply>(make_conv(-0.02f), scale);
+    auto concat = std::make_shared<ov::op::v0::Concat>(ov::OutputVector{add, mul}, 1);
+
+    auto reshape = std::make_shared<ov::op::v1::Reshape>(
+        param,
+        ov::op::v0::Constant::create(ov::element::i64, ov::Shape{2}, {2 * 16 * 24, 24}),
+        false);
+    auto matrix = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{24, 64}, std::vector<float>(24 * 64, 0.1f));
+    auto matmul = std::make_shared<ov::op::v0::MatMul>(reshape, matrix);
+    auto reduce = std::make_shared<ov::op::v1::ReduceSum>(
+        matmul,
+        ov::op::v0::Constant::create(ov::element::i64, ov::Shape{1}, {1}),
+        false);
+
+    return std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(concat),
+                                                        std::make_shared<ov::op::v0::Result>(reduce)},
+                                       ov::ParameterVector{param});
+}
+
+TEST(TemplateParallelExecutionTests, SameResultsAsSequential) {
+    auto core = ov::test::utils::PluginCache::get().core("TEMPLATE");
+    const auto model = make_branches_model();
+
+    auto sequential = core->compile_model(model, "TEMPLATE").create_infer_request();
+    auto compiled = core->compile_model(model, "TEMPLATE", ov::template_plugin::parallel_execution(true));
+    ASSERT_TRUE(compiled.get_property(ov::template_plugin::parallel_execution));
+    auto parallel = compiled.create_infer_request();
+
+    const auto input = ov::test::utils::create_and_fill_tensor(ov::element::f32, ov::Shape{2, 16, 24, 24});
+    sequential.set_input_tensor(input);
+    parallel.set_input_tensor(input);
+    sequential.infer();
+    parallel.infer();
+
+    for (size_t i = 0; i < model->outputs().size(); ++i) {
+        const auto& expected = sequential.get_output_tensor(i);
+        const auto& actual = parallel.get_output_tensor(i);
+        ASSERT_EQ(expected.get_shape(), actual.get_shape());
+        // the parallel kernels keep the order of the accumulation, so the results are bit exact
+        ASSERT_EQ(0, std::memcmp(expected.data(), actual.data(), expected.get_byte_size())) << "output " << i;
+    }
+}
+
+}  // namespace